@@ -34,4 +34,4 @@ chmod +x game_server
 
 # 启动服务器
 echo "正在启动服务器..."
-./game_server 
\ No newline at end of file
+./game_server "$@"
\ No newline at end of file
@@ -10,6 +10,14 @@ local buffer = f:read "*a"
 f:close()
 assert(pb.load(buffer))
 
+-- 优先使用 C++ 侧已解析的消息视图（msg.proto，只读），没有时才自行解码
+local function decode_network_message(msg)
+    if msg.proto then
+        return true, msg.proto
+    end
+    return pcall(pb.decode, "NetworkMessage", msg.body)
+end
+
 
 --有个全局变量map[id] = PlayerData
 local player_data_map = {}
@@ -22,14 +30,17 @@ function handle_player_update(msg)
     print("Lua handling player update message start")
 
     -- 先解码 NetworkMessage
-    local success,network_msg = pcall(pb.decode, "NetworkMessage", msg.body)
+    local success,network_msg = decode_network_message(msg)
     if not success then
         print("消息解码失败")
         return false
     end
 
-    -- 从 data 字段获取 player_update
+    -- 从 data 字段获取 player_update；紧凑格式（player_update_compact）还原为相同字段
     local data = network_msg.player_update
+    if not data and network_msg.player_update_compact then
+        data = compact.decode_player_update(network_msg.player_update_compact)
+    end
 
     if not data then
         print("无效的player_update数据")
@@ -84,7 +95,7 @@ end
 function handle_player_join(msg)
     print("Lua handling player join message")
     -- 先解码 NetworkMessage
-    local success,network_msg = pcall(pb.decode, "NetworkMessage", msg.body)
+    local success,network_msg = decode_network_message(msg)
     if not success then
         print("消息解码失败")
         return false
@@ -108,18 +119,18 @@ function handle_player_join(msg)
     local state = player_data:getState()
     
     -- 创建PlayerStateMessage
+    local position = {
+        x = state.x,
+        y = state.y,
+        z = state.z
+    }
+    local rotation = {
+        x = state.rotation_x,
+        y = state.rotation_y,
+        z = state.rotation_z
+    }
     local player_state = {
         player_id = tonumber(player_id_str),
-        position = {
-            x = state.x,
-            y = state.y,
-            z = state.z
-        },
-        rotation = {
-            x = state.rotation_x,
-            y = state.rotation_y,
-            z = state.rotation_z
-        },
         attributes = {
             player_id = tonumber(player_id_str),
             health = state.health,
@@ -132,6 +143,13 @@ function handle_player_join(msg)
         is_alive = true,
         team_id = 0
     }
+    -- 客户端声明支持紧凑编码时，坐标和朝向量化打包，否则发送完整的 Vector3
+    if compact.enabled() then
+        player_state.compact_transform = compact.encode_transform(position, rotation)
+    else
+        player_state.position = position
+        player_state.rotation = rotation
+    end
     
     -- 创建NetworkMessage
     local network_response = {
@@ -145,8 +163,8 @@ function handle_player_join(msg)
     print("Sending response:")
     print("Message Type:", network_response.msg_id)
     print("Player ID:", network_response.player_id)
-    print("Position:", player_state.position.x, player_state.position.y, player_state.position.z)
-    print("Rotation:", player_state.rotation.x, player_state.rotation.y, player_state.rotation.z)
+    print("Position:", position.x, position.y, position.z)
+    print("Rotation:", rotation.x, rotation.y, rotation.z)
     print("Health:", player_state.attributes.health)
     
     -- 编码并发送响应
@@ -1,18 +1,40 @@
 #include "EventLoop.h"
+#include <event2/thread.h>
 #include <iostream>
+#include <mutex>
 
-EventLoop::EventLoop() : base_(nullptr), running_(false) {}
+EventLoop::EventLoop() : base_(nullptr), running_(false), timer_wheel_event_(nullptr), task_event_(nullptr) {}
 
 EventLoop::~EventLoop() {
     stop();
 }
 
+void EventLoop::enableThreading() {
+    static std::once_flag once;
+    std::call_once(once, []() { evthread_use_pthreads(); });
+}
+
 bool EventLoop::init() {
-    base_ = event_base_new();
+    enableThreading();
+
+    // 精确定时器（timerfd），逻辑帧定时不受 epoll 毫秒精度限制
+    struct event_config* config = event_config_new();
+    if (config) {
+        event_config_set_flag(config, EVENT_BASE_FLAG_PRECISE_TIMER);
+        base_ = event_base_new_with_config(config);
+        event_config_free(config);
+    }
     if (!base_) {
         std::cerr << "Failed to create event base" << std::endl;
         return false;
     }
+
+    // 任务事件不加入循环，只由 post() 通过 event_active 激活，因此不会让 run() 一直阻塞
+    task_event_ = event_new(base_, -1, 0, taskCallback, this);
+    if (!task_event_) {
+        std::cerr << "Failed to create task event" << std::endl;
+        return false;
+    }
     return true;
 }
 
@@ -25,9 +47,110 @@ void EventLoop::run() {
     running_ = true;
     std::cout << "Event loop started" << std::endl;
     event_base_dispatch(base_);
+    running_ = false;
+}
+
+void EventLoop::quit() {
+    if (base_) {
+        event_base_loopbreak(base_);
+    }
+}
+
+bool EventLoop::addSignal(int signo, std::function<void(int)> cb) {
+    if (!base_) {
+        std::cerr << "Event loop not initialized" << std::endl;
+        return false;
+    }
+
+    auto handler = std::make_unique<SignalHandler>();
+    handler->cb = std::move(cb);
+    handler->ev = evsignal_new(base_, signo, signalCallback, handler.get());
+    if (!handler->ev || evsignal_add(handler->ev, nullptr) < 0) {
+        std::cerr << "Failed to add signal handler for " << signo << std::endl;
+        if (handler->ev) {
+            event_free(handler->ev);
+        }
+        return false;
+    }
+    signals_.push_back(std::move(handler));
+    return true;
+}
+
+void EventLoop::signalCallback(evutil_socket_t signo, short events, void* ctx) {
+    auto handler = static_cast<SignalHandler*>(ctx);
+    handler->cb(static_cast<int>(signo));
+}
+
+void EventLoop::post(std::function<void()> task) {
+    bool first;
+    {
+        std::lock_guard<std::mutex> lock(task_mutex_);
+        first = tasks_.empty();
+        tasks_.push_back(std::move(task));
+    }
+    // 已有待执行的任务时事件必然已被激活
+    if (first && task_event_) {
+        event_active(task_event_, EV_TIMEOUT, 0);
+    }
+}
+
+void EventLoop::taskCallback(evutil_socket_t fd, short events, void* ctx) {
+    static_cast<EventLoop*>(ctx)->runTasks();
+}
+
+void EventLoop::runTasks() {
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(task_mutex_);
+        tasks.swap(tasks_);
+    }
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+bool EventLoop::enableTimerWheel(uint32_t tick_ms) {
+    if (!base_) {
+        std::cerr << "Event loop not initialized" << std::endl;
+        return false;
+    }
+    if (timer_wheel_) {
+        return true;
+    }
+
+    timer_wheel_ = std::make_unique<TimerWheel>(tick_ms);
+    timer_wheel_event_ = event_new(base_, -1, EV_PERSIST, timerWheelCallback, this);
+    struct timeval tv = {static_cast<time_t>(tick_ms / 1000), static_cast<suseconds_t>((tick_ms % 1000) * 1000)};
+    if (!timer_wheel_event_ || event_add(timer_wheel_event_, &tv) < 0) {
+        std::cerr << "Failed to start timer wheel" << std::endl;
+        if (timer_wheel_event_) {
+            event_free(timer_wheel_event_);
+            timer_wheel_event_ = nullptr;
+        }
+        timer_wheel_.reset();
+        return false;
+    }
+    return true;
+}
+
+void EventLoop::timerWheelCallback(evutil_socket_t fd, short events, void* ctx) {
+    auto loop = static_cast<EventLoop*>(ctx);
+    loop->timer_wheel_->advance(TimerWheel::nowMs());
 }
 
 void EventLoop::stop() {
+    for (auto& handler : signals_) {
+        event_free(handler->ev);
+    }
+    signals_.clear();
+    if (task_event_) {
+        event_free(task_event_);
+        task_event_ = nullptr;
+    }
+    if (timer_wheel_event_) {
+        event_free(timer_wheel_event_);
+        timer_wheel_event_ = nullptr;
+    }
     if (base_) {
         event_base_loopbreak(base_);
         event_base_free(base_);
@@ -4,8 +4,9 @@
  * 
  * 该模块基于 libevent 实现事件循环系统，用于处理：
  * - 网络事件（连接、数据收发）
- * - 定时器事件
+ * - 定时器事件（大量同类定时器挂在时间轮上，由单个持久定时器驱动）
  * - 信号处理
+ * - 其他线程投递到循环线程执行的任务
  * 
  * @author Nevermore1102
  * @date 2025-05-05
@@ -14,8 +15,12 @@
 #pragma once
 
 #include <event2/event.h>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+#include "TimerWheel.h"
 
 class EventLoop {
 public:
@@ -23,12 +28,47 @@ public:
     ~EventLoop();
 
     bool init();
+    // 阻塞运行直到 quit() 或没有任何事件
     void run();
+    // 让 run() 尽快返回，可在任意线程（包括信号回调中）调用
+    void quit();
+    // 释放所有事件和 event_base
     void stop();
+
+    // 在循环线程上处理信号（需在 init() 之后调用）
+    bool addSignal(int signo, std::function<void(int)> cb);
+
+    // 投递任务到循环线程执行，线程安全；按投递顺序执行
+    void post(std::function<void()> task);
+
+    // 开启 libevent 多线程支持（全局一次），跨线程使用 event_base/bufferevent/evbuffer 前必须调用
+    static void enableThreading();
     
     struct event_base* getBase() const { return base_; }
 
+    // 启用时间轮（需在 init() 之后调用），tick_ms 为精度
+    bool enableTimerWheel(uint32_t tick_ms = 100);
+    TimerWheel* getTimerWheel() const { return timer_wheel_.get(); }
+
 private:
+    struct SignalHandler {
+        struct event* ev = nullptr;
+        std::function<void(int)> cb;
+    };
+
+    static void timerWheelCallback(evutil_socket_t fd, short events, void* ctx);
+    static void signalCallback(evutil_socket_t signo, short events, void* ctx);
+    static void taskCallback(evutil_socket_t fd, short events, void* ctx);
+    void runTasks();
+
     struct event_base* base_;
     bool running_;
+    std::unique_ptr<TimerWheel> timer_wheel_;
+    struct event* timer_wheel_event_;
+    std::vector<std::unique_ptr<SignalHandler>> signals_;
+
+    // 跨线程任务：投递方入队后激活 task_event_，循环线程整批取出执行
+    struct event* task_event_;
+    std::mutex task_mutex_;
+    std::vector<std::function<void()>> tasks_;
 }; 
\ No newline at end of file
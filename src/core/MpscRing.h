@@ -0,0 +1,96 @@
+/**
+ * @file MpscRing.h
+ * @brief 有界无锁多生产者单消费者环形队列
+ *
+ * 该模块负责：
+ * - 多个线程并发入队，单个线程出队，全程无锁
+ * - 每个槽位带序号：生产者用 CAS 抢占位置，写完后发布序号；消费者按序号判断槽位是否就绪
+ * - 容量固定（向上取整到 2 的幂），满时 tryPush 返回 false，由调用方决定等待还是丢弃
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+template <typename T>
+class MpscRing {
+public:
+    explicit MpscRing(size_t capacity)
+        : mask_(roundUp(capacity) - 1)
+        , cells_(new Cell[mask_ + 1])
+        , head_(0)
+        , tail_(0) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // 任意线程调用，队列满时返回 false（value 保持不变）
+    bool tryPush(T&& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 只能由消费者线程调用，队列空（或队首槽位尚未写完）时返回 false
+    bool tryPop(T& out) {
+        Cell& cell = cells_[head_ & mask_];
+        size_t seq = cell.seq.load(std::memory_order_acquire);
+        if (seq != head_ + 1) {
+            return false;
+        }
+        out = std::move(cell.value);
+        // 立即释放槽位中的资源（如 shared_ptr），不等下一轮覆盖
+        cell.value = T();
+        cell.seq.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    static size_t roundUp(size_t n) {
+        size_t size = 2;
+        while (size < n) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    // 生产者与消费者的游标放在不同缓存行，避免伪共享
+    alignas(64) size_t head_;
+    alignas(64) std::atomic<size_t> tail_;
+};
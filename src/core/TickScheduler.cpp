@@ -0,0 +1,185 @@
+#include "TickScheduler.h"
+#include "EventLoop.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+
+TickScheduler::TickScheduler(EventLoop& loop, uint32_t tick_rate_hz)
+    : loop_(loop)
+    , tick_rate_hz_(std::clamp(tick_rate_hz, MIN_TICK_RATE_HZ, MAX_TICK_RATE_HZ))
+    , interval_us_(1000000 / tick_rate_hz_)
+    , max_catch_up_ticks_(DEFAULT_MAX_CATCH_UP_TICKS)
+    , timer_event_(nullptr)
+    , running_(false)
+    , base_us_(0)
+    , base_tick_(0)
+    , next_tick_(0)
+    , stats_ticks_(0)
+    , stats_overruns_(0)
+    , stats_catch_up_(0)
+    , stats_skipped_(0)
+    , stats_last_us_(0)
+    , stats_max_us_(0)
+    , stats_total_us_(0)
+    , reported_overruns_(0)
+    , reported_skipped_(0) {
+    if (tick_rate_hz_ != tick_rate_hz) {
+        spdlog::warn("Tick rate {} Hz out of range [{}, {}], using {} Hz",
+                     tick_rate_hz, MIN_TICK_RATE_HZ, MAX_TICK_RATE_HZ, tick_rate_hz_);
+    }
+}
+
+TickScheduler::~TickScheduler() {
+    stop();
+}
+
+uint64_t TickScheduler::nowUs() {
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+void TickScheduler::addSystem(Phase phase, const std::string& name, System system) {
+    SystemEntry entry{phase, name, std::move(system)};
+    // 稳定插入：阶段有序，同阶段保持注册顺序
+    auto pos = std::upper_bound(systems_.begin(), systems_.end(), phase,
+                                [](Phase p, const SystemEntry& e) { return p < e.phase; });
+    systems_.insert(pos, std::move(entry));
+}
+
+bool TickScheduler::start() {
+    if (running_) {
+        return true;
+    }
+    if (!loop_.getBase()) {
+        spdlog::error("Tick scheduler requires an initialized event loop");
+        return false;
+    }
+
+    timer_event_ = evtimer_new(loop_.getBase(), timerCallback, this);
+    if (!timer_event_) {
+        spdlog::error("Failed to create tick timer");
+        return false;
+    }
+
+    running_ = true;
+    base_us_ = nowUs();
+    base_tick_ = 0;
+    next_tick_ = 0;
+    scheduleNext();
+    spdlog::info("Tick scheduler started at {} Hz ({} us per tick)", tick_rate_hz_, interval_us_);
+    return true;
+}
+
+void TickScheduler::stop() {
+    if (timer_event_) {
+        event_free(timer_event_);
+        timer_event_ = nullptr;
+    }
+    running_ = false;
+}
+
+TickScheduler::Stats TickScheduler::getStats() const {
+    Stats stats;
+    stats.ticks = stats_ticks_.load(std::memory_order_relaxed);
+    stats.overruns = stats_overruns_.load(std::memory_order_relaxed);
+    stats.catch_up_ticks = stats_catch_up_.load(std::memory_order_relaxed);
+    stats.skipped_ticks = stats_skipped_.load(std::memory_order_relaxed);
+    stats.last_tick_us = stats_last_us_.load(std::memory_order_relaxed);
+    stats.max_tick_us = stats_max_us_.load(std::memory_order_relaxed);
+    stats.total_tick_us = stats_total_us_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint64_t TickScheduler::deadlineUs(uint64_t tick) const {
+    // 按起点绝对计算，避免整数帧间隔的舍入误差累积
+    return base_us_ + (tick - base_tick_) * 1000000ULL / tick_rate_hz_;
+}
+
+void TickScheduler::timerCallback(evutil_socket_t fd, short events, void* ctx) {
+    static_cast<TickScheduler*>(ctx)->onTimer();
+}
+
+void TickScheduler::onTimer() {
+    uint32_t ran = 0;
+    uint64_t now = nowUs();
+    while (running_ && now >= deadlineUs(next_tick_)) {
+        if (ran == max_catch_up_ticks_) {
+            // 落后过多（如长时间卡顿），丢弃积压的帧，从当前时间重新对齐
+            uint64_t behind = (now - deadlineUs(next_tick_)) / interval_us_ + 1;
+            stats_skipped_.fetch_add(behind, std::memory_order_relaxed);
+            spdlog::warn("Tick scheduler fell behind, skipping {} tick(s)", behind);
+            base_us_ = now;
+            base_tick_ = next_tick_;
+            break;
+        }
+        runTick();
+        ++ran;
+        now = nowUs();
+    }
+    if (ran > 1) {
+        stats_catch_up_.fetch_add(ran - 1, std::memory_order_relaxed);
+    }
+
+    if (running_) {
+        scheduleNext();
+    }
+}
+
+void TickScheduler::runTick() {
+    TickContext ctx{next_tick_, interval_us_, static_cast<float>(interval_us_) / 1000000.0f};
+    uint64_t start = nowUs();
+    uint64_t system_start = start;
+    uint64_t slowest_us = 0;
+    const SystemEntry* slowest = nullptr;
+    for (auto& entry : systems_) {
+        entry.system(ctx);
+        uint64_t system_end = nowUs();
+        if (system_end - system_start >= slowest_us) {
+            slowest_us = system_end - system_start;
+            slowest = &entry;
+        }
+        system_start = system_end;
+    }
+    uint64_t elapsed = system_start - start;
+    ++next_tick_;
+
+    stats_ticks_.fetch_add(1, std::memory_order_relaxed);
+    stats_last_us_.store(elapsed, std::memory_order_relaxed);
+    stats_total_us_.fetch_add(elapsed, std::memory_order_relaxed);
+    if (elapsed > stats_max_us_.load(std::memory_order_relaxed)) {
+        stats_max_us_.store(elapsed, std::memory_order_relaxed);
+    }
+    if (elapsed > interval_us_) {
+        stats_overruns_.fetch_add(1, std::memory_order_relaxed);
+        spdlog::debug("Tick {} over budget: {} us (budget {} us), slowest system: {} ({} us)",
+                      ctx.tick, elapsed, interval_us_, slowest ? slowest->name : "-", slowest_us);
+    }
+
+    if (next_tick_ % (static_cast<uint64_t>(tick_rate_hz_) * STATS_REPORT_SECONDS) == 0) {
+        reportStats();
+    }
+}
+
+void TickScheduler::scheduleNext() {
+    uint64_t now = nowUs();
+    uint64_t deadline = deadlineUs(next_tick_);
+    uint64_t wait = deadline > now ? deadline - now : 0;
+    struct timeval tv = {static_cast<time_t>(wait / 1000000), static_cast<suseconds_t>(wait % 1000000)};
+    evtimer_add(timer_event_, &tv);
+}
+
+void TickScheduler::reportStats() {
+    Stats stats = getStats();
+    uint64_t overruns = stats.overruns - reported_overruns_;
+    uint64_t skipped = stats.skipped_ticks - reported_skipped_;
+    reported_overruns_ = stats.overruns;
+    reported_skipped_ = stats.skipped_ticks;
+
+    uint64_t avg = stats.ticks > 0 ? stats.total_tick_us / stats.ticks : 0;
+    if (overruns > 0 || skipped > 0) {
+        spdlog::warn("Tick stats: {} ticks, avg {} us, max {} us, {} over budget and {} skipped in last {}s",
+                     stats.ticks, avg, stats.max_tick_us, overruns, skipped, STATS_REPORT_SECONDS);
+    } else {
+        spdlog::debug("Tick stats: {} ticks, avg {} us, max {} us", stats.ticks, avg, stats.max_tick_us);
+    }
+}
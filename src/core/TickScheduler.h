@@ -0,0 +1,119 @@
+/**
+ * @file TickScheduler.h
+ * @brief 固定频率的权威逻辑帧调度器
+ *
+ * 该模块负责：
+ * - 在 EventLoop 上以固定频率（如 30/60/128 Hz）驱动逻辑帧
+ * - 帧截止时间按起点绝对计算，定时器误差不会累积（漂移补偿）
+ * - 落后时连续补帧，超过补帧上限则丢弃积压的帧并重新对齐
+ * - 各系统按阶段（输入 → 模拟 → 输出）依次执行，同一阶段内按注册顺序
+ * - 统计每帧耗时和超出帧预算的次数，可在任意线程读取
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <event2/event.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class EventLoop;
+
+class TickScheduler {
+public:
+    // 执行阶段，按声明顺序运行
+    enum class Phase : uint8_t {
+        INPUT = 0,      // 取出本帧之前到达的消息
+        SIMULATION,     // 推进游戏状态
+        OUTPUT,         // 下发状态、刷新输出
+        COUNT
+    };
+
+    struct TickContext {
+        uint64_t tick;          // 帧序号，从 0 开始
+        uint32_t interval_us;   // 帧间隔
+        float dt;               // 帧间隔（秒）
+    };
+
+    using System = std::function<void(const TickContext&)>;
+
+    struct Stats {
+        uint64_t ticks = 0;             // 已执行的帧数
+        uint64_t overruns = 0;          // 单帧耗时超过帧间隔的次数
+        uint64_t catch_up_ticks = 0;    // 为追赶进度连续执行的帧数
+        uint64_t skipped_ticks = 0;     // 超过补帧上限被丢弃的帧数
+        uint64_t last_tick_us = 0;
+        uint64_t max_tick_us = 0;
+        uint64_t total_tick_us = 0;
+    };
+
+    // 帧频率限制在 [MIN_TICK_RATE_HZ, MAX_TICK_RATE_HZ] 内，超出时取边界值
+    TickScheduler(EventLoop& loop, uint32_t tick_rate_hz);
+    ~TickScheduler();
+
+    // 需在 start() 之前注册
+    void addSystem(Phase phase, const std::string& name, System system);
+
+    // 启动和停止，只能在事件循环线程（或循环运行前）调用
+    bool start();
+    void stop();
+
+    // 一次唤醒中最多连续执行的帧数，超出部分丢弃
+    void setMaxCatchUpTicks(uint32_t max_ticks) { max_catch_up_ticks_ = max_ticks > 0 ? max_ticks : 1; }
+
+    uint32_t getTickRate() const { return tick_rate_hz_; }
+    uint64_t getCurrentTick() const { return stats_ticks_.load(std::memory_order_relaxed); }
+    Stats getStats() const;
+
+    static uint64_t nowUs();
+
+    // 支持的帧频率范围：帧间隔至少 1ms，远高于实际需要的 128 Hz
+    static constexpr uint32_t MIN_TICK_RATE_HZ = 1;
+    static constexpr uint32_t MAX_TICK_RATE_HZ = 1000;
+
+private:
+    struct SystemEntry {
+        Phase phase;
+        std::string name;
+        System system;
+    };
+
+    static void timerCallback(evutil_socket_t fd, short events, void* ctx);
+    void onTimer();
+    void runTick();
+    void scheduleNext();
+    uint64_t deadlineUs(uint64_t tick) const;
+    void reportStats();
+
+    EventLoop& loop_;
+    uint32_t tick_rate_hz_;
+    uint32_t interval_us_;
+    uint32_t max_catch_up_ticks_;
+    struct event* timer_event_;
+    bool running_;
+    std::vector<SystemEntry> systems_;      // 按阶段排序
+
+    // 帧时间基准：第 tick 帧的截止时间为 base_us_ + (tick - base_tick_) * 1e6 / hz
+    uint64_t base_us_;
+    uint64_t base_tick_;
+    uint64_t next_tick_;
+
+    // 统计（逻辑线程写，任意线程读）
+    std::atomic<uint64_t> stats_ticks_;
+    std::atomic<uint64_t> stats_overruns_;
+    std::atomic<uint64_t> stats_catch_up_;
+    std::atomic<uint64_t> stats_skipped_;
+    std::atomic<uint64_t> stats_last_us_;
+    std::atomic<uint64_t> stats_max_us_;
+    std::atomic<uint64_t> stats_total_us_;
+    uint64_t reported_overruns_;
+    uint64_t reported_skipped_;
+
+    static constexpr uint32_t DEFAULT_MAX_CATCH_UP_TICKS = 5;
+    static constexpr uint32_t STATS_REPORT_SECONDS = 10;
+};
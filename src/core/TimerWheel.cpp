@@ -0,0 +1,130 @@
+#include "TimerWheel.h"
+#include <chrono>
+#include <cstring>
+
+void TimerNode::cancel() {
+    if (pprev_) {
+        unlink();
+        wheel_->size_--;
+    }
+}
+
+void TimerNode::unlink() {
+    *pprev_ = next_;
+    if (next_) {
+        next_->pprev_ = pprev_;
+    }
+    next_ = nullptr;
+    pprev_ = nullptr;
+}
+
+TimerWheel::TimerWheel(uint32_t tick_ms)
+    : tick_ms_(tick_ms > 0 ? tick_ms : 1)
+    , current_(nowMs() / tick_ms_)
+    , size_(0)
+    , expire_budget_(0)
+    , expired_(nullptr) {
+    memset(slots_, 0, sizeof(slots_));
+}
+
+TimerWheel::~TimerWheel() {
+    // 摘除所有节点，避免节点析构时访问已释放的时间轮
+    auto clear = [](TimerNode*& head) {
+        while (head) {
+            head->unlink();
+        }
+    };
+    for (auto& level : slots_) {
+        for (auto& head : level) {
+            clear(head);
+        }
+    }
+    clear(expired_);
+}
+
+uint64_t TimerWheel::nowMs() {
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+void TimerWheel::schedule(TimerNode& node, uint64_t delay_ms) {
+    if (node.pprev_) {
+        node.unlink();
+    } else {
+        size_++;
+    }
+
+    // 当前 tick 已经过去了一部分，多算一个 tick 保证不会提前触发
+    uint64_t ticks = (delay_ms + tick_ms_ - 1) / tick_ms_ + 1;
+    if (ticks > MAX_TICKS) {
+        ticks = MAX_TICKS;
+    }
+    node.wheel_ = this;
+    node.expire_ = current_ + ticks;
+    insert(node);
+}
+
+void TimerWheel::insert(TimerNode& node) {
+    // 放在与当前 tick 处于同一上层块的最低一层，块边界到来时再下沉
+    int level = 0;
+    while (level < LEVELS - 1 &&
+           (node.expire_ >> (SLOT_BITS * (level + 1))) != (current_ >> (SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+    TimerNode*& head = slots_[level][(node.expire_ >> (SLOT_BITS * level)) & SLOT_MASK];
+    node.next_ = head;
+    if (head) {
+        head->pprev_ = &node.next_;
+    }
+    head = &node;
+    node.pprev_ = &head;
+}
+
+void TimerWheel::cascade(int level) {
+    TimerNode*& head = slots_[level][(current_ >> (SLOT_BITS * level)) & SLOT_MASK];
+    while (head) {
+        TimerNode* node = head;
+        node->unlink();
+        insert(*node);
+    }
+}
+
+size_t TimerWheel::advance(uint64_t now_ms) {
+    uint64_t target = now_ms / tick_ms_;
+    while (current_ < target) {
+        ++current_;
+        // 进入新的上层块时，先由高到低把对应槽下沉
+        for (int level = LEVELS - 1; level > 0; --level) {
+            if ((current_ & ((1ULL << (SLOT_BITS * level)) - 1)) == 0) {
+                cascade(level);
+            }
+        }
+
+        // 本 tick 到期的节点转入待触发链表
+        TimerNode*& head = slots_[0][current_ & SLOT_MASK];
+        while (head) {
+            TimerNode* node = head;
+            node->unlink();
+            node->next_ = expired_;
+            if (expired_) {
+                expired_->pprev_ = &node->next_;
+            }
+            expired_ = node;
+            node->pprev_ = &expired_;
+        }
+    }
+
+    // 逐个取出再回调：回调中可能重新挂入、取消其他节点或销毁自身
+    size_t fired = 0;
+    while (expired_ && (expire_budget_ == 0 || fired < expire_budget_)) {
+        TimerNode* node = expired_;
+        node->unlink();
+        size_--;
+        ++fired;
+        if (node->callback_) {
+            TimerNode::Callback cb = node->callback_;
+            cb();
+        }
+    }
+    return fired;
+}
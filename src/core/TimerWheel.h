@@ -0,0 +1,94 @@
+/**
+ * @file TimerWheel.h
+ * @brief 分层时间轮
+ *
+ * 该模块负责：
+ * - 以固定精度（tick）管理大量定时器，挂入/重置/取消均为 O(1)
+ * - 4 层 × 64 槽，覆盖 2^24 个 tick，高层槽到期时逐级下沉
+ * - 每次推进只触发有限数量的到期回调，剩余的留到下一次推进，避免一次性处理过多
+ *
+ * 定时器节点侵入式地嵌在使用者对象中，时间轮本身不分配内存。
+ * 时间轮不是线程安全的，只能在驱动它的事件循环线程上使用。
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+class TimerWheel;
+
+// 侵入式定时器节点
+class TimerNode {
+public:
+    using Callback = std::function<void()>;
+
+    TimerNode() = default;
+    ~TimerNode() { cancel(); }
+
+    TimerNode(const TimerNode&) = delete;
+    TimerNode& operator=(const TimerNode&) = delete;
+
+    void setCallback(Callback cb) { callback_ = std::move(cb); }
+    bool isActive() const { return pprev_ != nullptr; }
+    void cancel();
+
+private:
+    friend class TimerWheel;
+
+    void unlink();
+
+    TimerNode* next_ = nullptr;
+    TimerNode** pprev_ = nullptr;   // 指向前一个节点的 next_ 或槽头，O(1) 摘除
+    TimerWheel* wheel_ = nullptr;
+    uint64_t expire_ = 0;           // 到期 tick
+    Callback callback_;
+};
+
+class TimerWheel {
+public:
+    explicit TimerWheel(uint32_t tick_ms = 100);
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // 在 delay_ms 后触发（按 tick 向上取整，最多晚一个 tick），已挂入的节点会被重置
+    void schedule(TimerNode& node, uint64_t delay_ms);
+    void cancel(TimerNode& node) { node.cancel(); }
+
+    // 推进到 now_ms，触发到期的定时器；返回本次触发的数量
+    size_t advance(uint64_t now_ms);
+
+    // 每次推进最多触发的回调数量，0 表示不限制
+    void setExpireBudget(size_t budget) { expire_budget_ = budget; }
+
+    uint32_t getTickMs() const { return tick_ms_; }
+    size_t size() const { return size_; }
+
+    // 单调时钟（毫秒）
+    static uint64_t nowMs();
+
+private:
+    friend class TimerNode;
+
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint64_t SLOTS = 1ULL << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+    static constexpr uint64_t MAX_TICKS = (1ULL << (LEVELS * SLOT_BITS)) - 1;
+
+    void insert(TimerNode& node);
+    void cascade(int level);
+
+    uint32_t tick_ms_;
+    uint64_t current_;              // 当前 tick
+    size_t size_;
+    size_t expire_budget_;
+    TimerNode* slots_[LEVELS][SLOTS];
+    TimerNode* expired_;            // 已到期但超出本次预算、等待触发的节点
+};
@@ -1,36 +1,40 @@
 #include "CppEngine.h"
 #include <spdlog/spdlog.h>
+#include "proto/CompactCodec.h"
 #include "proto/Message.h"
 #include "proto/NetworkMessage.pb.h"
 
+namespace {
+
+// 编译期生成的分发表，未登记的消息类型为空
+constexpr DispatchTable<CppEngine::Handler> makeHandlers() {
+    DispatchTable<CppEngine::Handler> table{};
+    table[MessageType::HEARTBEAT] = &CppEngine::onHeartbeat;
+    table[MessageType::PLAYER_UPDATE] = &CppEngine::onPlayerUpdate;
+    table[MessageType::PLAYER_ATTRIBUTE] = &CppEngine::onPlayerAttribute;
+    table[MessageType::PLAYER_STATE] = &CppEngine::onPlayerState;
+    table[MessageType::PLAYER_JOIN] = &CppEngine::onPlayerJoin;
+    table[MessageType::PLAYER_LEAVE] = &CppEngine::onPlayerLeave;
+    table[MessageType::UDP_BIND] = &CppEngine::onUdpBind;
+    return table;
+}
+
+constexpr DispatchTable<CppEngine::Handler> HANDLERS = makeHandlers();
+
+} // namespace
+
 CppEngine::CppEngine() {
     // 可在此初始化需要的成员
 }
 
 bool CppEngine::handleMessage(const std::shared_ptr<Connection>& conn, const Message& msg) {
-    switch (msg.getType()) {
-        case MessageType::HEARTBEAT:
-            onHeartbeat(conn, msg);
-            break;
-        case MessageType::PLAYER_UPDATE:
-            onPlayerUpdate(conn, msg);
-            break;
-        case MessageType::PLAYER_ATTRIBUTE:
-            onPlayerAttribute(conn, msg);
-            break;
-        case MessageType::PLAYER_STATE:
-            onPlayerState(conn, msg);
-            break;
-        case MessageType::PLAYER_JOIN:
-            onPlayerJoin(conn, msg);
-            break;
-        case MessageType::PLAYER_LEAVE:
-            onPlayerLeave(conn, msg);
-            break;
-        default:
-            spdlog::warn("Unknown message type: {}", static_cast<uint32_t>(msg.getType()));
-            return false;
+    size_t index = dispatchIndex(msg.getType());
+    Handler handler = index < MESSAGE_TYPE_COUNT ? HANDLERS[index] : nullptr;
+    if (!handler) {
+        spdlog::warn("Unknown message type: {}", static_cast<uint32_t>(msg.getType()));
+        return false;
     }
+    (this->*handler)(conn, msg);
     return true;
 }
 
@@ -38,58 +42,67 @@ void CppEngine::onHeartbeat(const std::shared_ptr<Connection>& conn, const Messa
     spdlog::debug("Received heartbeat from {}", conn->getId());
     
     // 发送心跳响应
-    NetworkMessage pb_msg;
-    pb_msg.set_msg_id(MessageType::HEARTBEAT);
-    pb_msg.set_timestamp(static_cast<uint32_t>(time(nullptr)));
+    auto pb_msg = google::protobuf::Arena::CreateMessage<NetworkMessage>(&arena_);
+    pb_msg->set_msg_id(MessageType::HEARTBEAT);
+    pb_msg->set_timestamp(static_cast<uint32_t>(time(nullptr)));
     
     // 创建心跳消息体
-    HeartbeatMessage* heartbeat = pb_msg.mutable_heartbeat();
-    
-    Message response;
-    response.setBodyFromProto(pb_msg);
+    pb_msg->mutable_heartbeat();
     
-    if (!conn->sendMessage(response)) {
+    if (!conn->sendProto(*pb_msg)) {
         spdlog::error("Failed to send heartbeat response");
     }
 }
 
 void CppEngine::onPlayerUpdate(const std::shared_ptr<Connection>& conn, const Message& msg) {
-    NetworkMessage pb_msg;
-    if (!msg.getBodyAsProto(pb_msg)) {
+    const NetworkMessage* pb_msg = msg.getProto();
+    if (!pb_msg) {
         spdlog::error("Failed to parse player update message");
         return;
     }
     
-    if (pb_msg.has_player_update()) {
-        const auto& update = pb_msg.player_update();
+    // 紧凑格式先还原成 PlayerUpdateMessage，之后两种格式按同一逻辑处理
+    PlayerUpdateMessage decoded;
+    const PlayerUpdateMessage* update = nullptr;
+    if (pb_msg->has_player_update()) {
+        update = &pb_msg->player_update();
+    } else if (pb_msg->has_player_update_compact()) {
+        if (!CompactCodec::decodePlayerUpdate(pb_msg->player_update_compact(), &decoded)) {
+            spdlog::warn("Invalid compact player update from {}", conn->getId());
+            return;
+        }
+        update = &decoded;
+    }
+
+    if (update) {
         spdlog::debug("Player update: pos=({}, {}, {}), rot=({}, {}, {})", 
-                     update.position_x(), update.position_y(), update.position_z(),
-                     update.rotation_x(), update.rotation_y(), update.rotation_z());
+                     update->position_x(), update->position_y(), update->position_z(),
+                     update->rotation_x(), update->rotation_y(), update->rotation_z());
     }
 }
 
 void CppEngine::onPlayerAttribute(const std::shared_ptr<Connection>& conn, const Message& msg) {
-    NetworkMessage pb_msg;
-    if (!msg.getBodyAsProto(pb_msg)) {
+    const NetworkMessage* pb_msg = msg.getProto();
+    if (!pb_msg) {
         spdlog::error("Failed to parse player attribute message");
         return;
     }
     
-    if (pb_msg.has_player_attribute()) {
-        const auto& attr = pb_msg.player_attribute();
+    if (pb_msg->has_player_attribute()) {
+        const auto& attr = pb_msg->player_attribute();
         spdlog::debug("Player attribute: health={}, armor={}", attr.health(), attr.armor());
     }
 }
 
 void CppEngine::onPlayerState(const std::shared_ptr<Connection>& conn, const Message& msg) {
-    NetworkMessage pb_msg;
-    if (!msg.getBodyAsProto(pb_msg)) {
+    const NetworkMessage* pb_msg = msg.getProto();
+    if (!pb_msg) {
         spdlog::error("Failed to parse player state message");
         return;
     }
     
-    if (pb_msg.has_player_state()) {
-        const auto& state = pb_msg.player_state();
+    if (pb_msg->has_player_state()) {
+        const auto& state = pb_msg->player_state();
         spdlog::debug("Player state: alive={}, team={}", state.is_alive(), state.team_id());
     }
 }
@@ -100,4 +113,23 @@ void CppEngine::onPlayerJoin(const std::shared_ptr<Connection>& conn, const Mess
 
 void CppEngine::onPlayerLeave(const std::shared_ptr<Connection>& conn, const Message& msg) {
     spdlog::info("Player left: {}", conn->getId());
-} 
\ No newline at end of file
+}
+
+void CppEngine::onUdpBind(const std::shared_ptr<Connection>& conn, const Message& msg) {
+    if (!udp_server_) {
+        spdlog::warn("UDP bind requested by {} but UDP is disabled", conn->getId());
+        return;
+    }
+
+    // 通过可靠的TCP下发会话令牌，客户端随后在每个UDP数据报前附带该令牌
+    auto pb_msg = google::protobuf::Arena::CreateMessage<NetworkMessage>(&arena_);
+    pb_msg->set_msg_id(MessageType::UDP_BIND);
+    pb_msg->set_timestamp(static_cast<uint32_t>(time(nullptr)));
+    UdpBindMessage* bind = pb_msg->mutable_udp_bind();
+    bind->set_token(udp_server_->bindSession(conn));
+    bind->set_port(udp_server_->getPort());
+
+    if (!conn->sendProto(*pb_msg)) {
+        spdlog::error("Failed to send UDP bind response");
+    }
+}
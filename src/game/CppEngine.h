@@ -11,22 +11,39 @@
 
 #pragma once
 #include <memory>
+#include <google/protobuf/arena.h>
 #include "proto/Message.h"
+#include "proto/MessageDispatch.h"
 #include "net/Connection.h"
+#include "net/UdpServer.h"
 
 class CppEngine {
 public:
     CppEngine();
     ~CppEngine() = default;
 
-    // 处理消息
+    // 设置UDP通道，用于响应 UDP_BIND
+    void setUdpServer(std::shared_ptr<UdpServer> udp_server) { udp_server_ = udp_server; }
+
+    using Handler = void (CppEngine::*)(const std::shared_ptr<Connection>&, const Message&);
+
+    // 处理消息：按消息类型查分发表，没有对应处理函数时返回 false
     bool handleMessage(const std::shared_ptr<Connection>& conn, const Message& msg);
 
-    // 可扩展的C++处理函数
+    // 释放本帧处理器中分配的所有响应消息，在每帧结束时调用
+    void resetArena() { arena_.Reset(); }
+
+    // 可扩展的C++处理函数，新增后在 CppEngine.cpp 的 makeHandlers() 中登记
     void onHeartbeat(const std::shared_ptr<Connection>& conn, const Message& msg);
     void onPlayerUpdate(const std::shared_ptr<Connection>& conn, const Message& msg);
     void onPlayerAttribute(const std::shared_ptr<Connection>& conn, const Message& msg);
     void onPlayerState(const std::shared_ptr<Connection>& conn, const Message& msg);
     void onPlayerJoin(const std::shared_ptr<Connection>& conn, const Message& msg);
     void onPlayerLeave(const std::shared_ptr<Connection>& conn, const Message& msg);
+    void onUdpBind(const std::shared_ptr<Connection>& conn, const Message& msg);
+
+private:
+    std::shared_ptr<UdpServer> udp_server_;
+    // 逐帧复用的响应消息内存，只在逻辑线程上使用
+    google::protobuf::Arena arena_;
 }; 
\ No newline at end of file
@@ -2,20 +2,45 @@
 #include <event2/event.h>
 #include <spdlog/spdlog.h>
 #include "net/TcpServer.h"
+#include "net/UdpServer.h"
 #include "core/EventLoop.h"
+#include "core/TickScheduler.h"
 #include "proto/Message.h"
 #include "LuaEngine.h"
 #include "MessageProcessor.h"
 #include "CppEngine.h"
+#include "InboundQueue.h"
+#include "SnapshotManager.h"
+#include <algorithm>
+#include <csignal>
 #include <memory>
+#include <vector>
 
 class GameServer {
 public:
-    GameServer() 
+    static constexpr uint32_t DEFAULT_TICK_RATE_HZ = 30;
+
+    explicit GameServer(size_t reactor_count = 1,
+                        TcpServer::Backend backend = TcpServer::Backend::LIBEVENT,
+                        uint32_t tick_rate_hz = DEFAULT_TICK_RATE_HZ)
         : port_(8888)
-        , tcp_server_("0.0.0.0", port_)
+        , tick_scheduler_(event_loop_, tick_rate_hz)
+        , tcp_server_(event_loop_, "0.0.0.0", port_)
+        , udp_server_(std::make_shared<UdpServer>("0.0.0.0", port_))
         , lua_engine_(std::make_shared<LuaEngine>())
-        , cpp_engine_(std::make_shared<CppEngine>()) {
+        , cpp_engine_(std::make_shared<CppEngine>())
+        , snapshots_(std::make_shared<SnapshotManager>()) {
+        tcp_server_.setReactorCount(reactor_count);
+        tcp_server_.setBackend(backend);
+        // 网络收发和解码都在 I/O 线程上完成，主循环只运行逻辑帧（Lua 保持单线程）
+        tcp_server_.setDedicatedIoThreads(true);
+        tcp_server_.setIdleTimeout(IDLE_TIMEOUT_MS);
+        // 每个连接一帧内的出站数据在输出阶段末尾合并写出（flush_writes），定时器只作兜底
+        tcp_server_.setWriteCoalescing(std::max<uint32_t>(1, 1000 / tick_scheduler_.getTickRate()));
+    }
+
+    ~GameServer() {
+        shutdown();
     }
 
     bool init() {
@@ -31,6 +56,12 @@ public:
             return false;
         }
 
+        // 初始化逻辑帧
+        if (!initTick()) {
+            spdlog::error("Failed to init tick scheduler");
+            return false;
+        }
+
         // 初始化网络
         if (!initNetwork()) {
             spdlog::error("Failed to init network");
@@ -40,8 +71,24 @@ public:
         return true;
     }
 
+    // 在当前线程运行事件循环：逻辑帧和信号共用这一个循环，收到 SIGINT/SIGTERM 后退出
     void run() {
+        auto on_signal = [this](int signo) {
+            spdlog::info("Received signal {}, shutting down", signo);
+            event_loop_.quit();
+        };
+        event_loop_.addSignal(SIGINT, on_signal);
+        event_loop_.addSignal(SIGTERM, on_signal);
+
         event_loop_.run();
+        shutdown();
+    }
+
+    // 依次停止网络和逻辑帧，需在事件循环线程上调用（或循环已退出）
+    void shutdown() {
+        tcp_server_.stop();
+        udp_server_->stop();
+        tick_scheduler_.stop();
     }
 
 private:
@@ -61,35 +108,120 @@ private:
         return true;
     }
 
-    bool initNetwork() {
+    bool initTick() {
         // 初始化消息处理器成员变量，确保共用同一个 LuaEngine 和 CppEngine 实例
         message_processor_ = std::make_shared<MessageProcessor>(lua_engine_->getLuaVM(), cpp_engine_);
 
-        // 设置消息回调，捕获 this
-        tcp_server_.setMessageCallback(
-            [this](const std::shared_ptr<Connection>& conn, const Message& msg) {
-                spdlog::info("Received message from {}, type: {}", 
-                            conn->getId(), static_cast<int>(msg.getType()));
-                // 使用成员变量处理消息
-                if (!message_processor_->processMessage(conn, msg)) {
-                    spdlog::warn("Message not handled: {}", static_cast<int>(msg.getType()));
+        // 输入阶段：处理上一帧以来到达的全部消息
+        tick_scheduler_.addSystem(TickScheduler::Phase::INPUT, "inbound_messages",
+            [this](const TickScheduler::TickContext&) {
+                inbound_.drain(inbound_batch_);
+                for (const auto& item : inbound_batch_) {
+                    spdlog::info("Received message from {}, type: {}",
+                                item.conn->getId(), static_cast<int>(item.msg.getType()));
+                    // 玩家移动同时写入世界状态；快照确认只用于同步，不再分发给处理器
+                    if (snapshots_->onMessage(item.conn, item.msg)) {
+                        continue;
+                    }
+                    // 使用成员变量处理消息
+                    if (!message_processor_->processMessage(item.conn, item.msg)) {
+                        spdlog::warn("Message not handled: {}", static_cast<int>(item.msg.getType()));
+                    }
+                }
+                inbound_batch_.clear();
+            });
+
+        // 输出阶段：冻结本帧世界状态，按各客户端确认的基线发送增量快照
+        tick_scheduler_.addSystem(TickScheduler::Phase::OUTPUT, "world_snapshot",
+            [this](const TickScheduler::TickContext&) {
+                snapshots_->publish();
+            });
+
+        // 输出阶段：开启写合并时，本帧暂存在各连接上的帧在这里一次写出
+        tick_scheduler_.addSystem(TickScheduler::Phase::OUTPUT, "flush_writes",
+            [this](const TickScheduler::TickContext&) {
+                tcp_server_.flushWrites();
+            });
+
+        // 输出阶段末尾：本帧处理器分配的响应消息整体释放
+        tick_scheduler_.addSystem(TickScheduler::Phase::OUTPUT, "reset_arenas",
+            [this](const TickScheduler::TickContext&) {
+                cpp_engine_->resetArena();
+            });
+
+        return tick_scheduler_.start();
+    }
+
+    bool initNetwork() {
+        // 设置消息回调：TCP 和 UDP 共用，网络线程只负责入队，由逻辑帧统一处理
+        auto on_message = [this](const std::shared_ptr<Connection>& conn, const Message& msg) {
+            // 需要消息体的在 I/O 线程上解析好（结果随消息缓存），心跳不解析
+            if (msg.getType() != MessageType::HEARTBEAT && !msg.getProto()) {
+                spdlog::warn("Dropping malformed message from {}, type: {}", conn->getId(), static_cast<int>(msg.getType()));
+                return;
+            }
+            inbound_.push(conn, msg);
+        };
+        tcp_server_.setMessageCallback(on_message);
+        udp_server_->setMessageCallback(on_message);
+
+        // 批次帧：整组校验后移入入站队列，不再逐条复制消息体
+        tcp_server_.setMessageBatchCallback(
+            [this](const std::shared_ptr<Connection>& conn, std::vector<Message>& batch) {
+                for (auto& msg : batch) {
+                    if (msg.getType() != MessageType::HEARTBEAT && !msg.getProto()) {
+                        spdlog::warn("Dropping malformed message from {}, type: {}", conn->getId(), static_cast<int>(msg.getType()));
+                        continue;
+                    }
+                    inbound_.push(conn, std::move(msg));
                 }
             });
 
+        // 未知类型的消息在解析前直接丢弃
+        tcp_server_.setMessageFilter([](const Connection& conn, const MessageHeader& header) {
+            if (MessageType_IsValid(header.type)) {
+                return true;
+            }
+            spdlog::debug("Filtered message with unknown type {} from {}", static_cast<int>(header.type), conn.getId());
+            return false;
+        });
+
+        // TCP 连接关闭时解除 UDP 会话
+        tcp_server_.setCloseCallback(
+            [this](const std::shared_ptr<Connection>& conn) {
+                udp_server_->unbindSession(conn->getId());
+            });
+
+        // 启动 UDP 通道（PLAYER_UPDATE 和状态快照），失败时仅使用 TCP
+        if (udp_server_->start()) {
+            cpp_engine_->setUdpServer(udp_server_);
+            snapshots_->setUdpServer(udp_server_);
+        } else {
+            spdlog::warn("UDP transport disabled");
+        }
+
         // 设置新连接回调
         tcp_server_.setNewConnectionCallback(
             [](const std::shared_ptr<Connection>& conn) {
                 spdlog::info("New connection: {}", conn->getId());
             });
 
-        // 启动服务器
+        // 启动服务器，连接在 run() 开始驱动事件循环后才会被接受
         return tcp_server_.start();
     }
 
     uint16_t port_;
     EventLoop event_loop_;
+    TickScheduler tick_scheduler_;
+    InboundQueue inbound_;
+    std::vector<InboundQueue::Item> inbound_batch_;
     TcpServer tcp_server_;
+    std::shared_ptr<UdpServer> udp_server_;
     std::shared_ptr<LuaEngine> lua_engine_;
     std::shared_ptr<CppEngine> cpp_engine_;
+    std::shared_ptr<SnapshotManager> snapshots_;
     std::shared_ptr<MessageProcessor> message_processor_;
+
+    // 客户端心跳间隔远小于该值，超时未收到任何数据视为掉线
+    static constexpr uint32_t IDLE_TIMEOUT_MS = 30000;
 };
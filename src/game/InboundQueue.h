@@ -0,0 +1,104 @@
+#pragma once
+#include "core/MpscRing.h"
+#include "net/Connection.h"
+#include "proto/Message.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+// 入站消息队列：网络线程（各 reactor、UDP）投递已解码的消息，逻辑线程在每帧开始时整批取出。
+// 基于无锁 MPSC 环，网络线程之间、网络线程与逻辑线程之间都不争用锁。
+// 环满时网络线程不等待：位置更新（后一条会覆盖前一条）直接丢弃并计数，
+// 其余消息暂存到溢出表并暂停该连接的读取，逻辑线程取走溢出的消息后再恢复
+class InboundQueue {
+public:
+    struct Item {
+        std::shared_ptr<Connection> conn;
+        Message msg;
+    };
+
+    explicit InboundQueue(size_t capacity = DEFAULT_CAPACITY)
+        : ring_(capacity), overflowed_(false), stalls_(0), drops_(0) {}
+
+    void push(const std::shared_ptr<Connection>& conn, const Message& msg) {
+        pushItem(Item{conn, msg});
+    }
+
+    // 同上，移走消息（批次中的消息不再复制消息体）
+    void push(const std::shared_ptr<Connection>& conn, Message&& msg) {
+        pushItem(Item{conn, std::move(msg)});
+    }
+
+    // 取出当前全部消息（只能在逻辑线程调用）；最多取一个容量，之后到达的留到下一帧。
+    // 环取空后再取溢出的消息（它们晚于环中的消息到达），并恢复被暂停的连接
+    void drain(std::vector<Item>& out) {
+        out.clear();
+        Item item;
+        while (out.size() < ring_.capacity() && ring_.tryPop(item)) {
+            out.push_back(std::move(item));
+        }
+        if (out.size() >= ring_.capacity() || !overflowed_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        std::vector<std::shared_ptr<Connection>> paused;
+        {
+            std::lock_guard<std::mutex> lock(overflow_mutex_);
+            for (auto& pending : overflow_) {
+                if (paused.empty() || paused.back() != pending.conn) {
+                    paused.push_back(pending.conn);
+                }
+                out.push_back(std::move(pending));
+            }
+            overflow_.clear();
+            overflowed_.store(false, std::memory_order_release);
+        }
+        for (const auto& conn : paused) {
+            conn->resumeReading();
+        }
+    }
+
+    // 因队列满而暂存到溢出表（并暂停所属连接读取）的消息数
+    uint64_t getStallCount() const { return stalls_.load(std::memory_order_relaxed); }
+    // 因队列满而丢弃的位置更新数
+    uint64_t getDropCount() const { return drops_.load(std::memory_order_relaxed); }
+
+private:
+    static bool isDroppable(const Message& msg) {
+        return msg.getType() == MessageType::PLAYER_UPDATE;
+    }
+
+    void pushItem(Item&& item) {
+        // 已有消息溢出时后续消息也进入溢出表，保证同一连接的消息不乱序
+        if (!overflowed_.load(std::memory_order_acquire) && ring_.tryPush(std::move(item))) {
+            return;
+        }
+        if (isDroppable(item.msg)) {
+            if (drops_.fetch_add(1, std::memory_order_relaxed) == 0) {
+                spdlog::warn("Inbound queue full ({} messages), dropping player updates", ring_.capacity());
+            }
+            return;
+        }
+
+        // 在所属 I/O 线程上调用时，当前消息处理完后即停止拆包和读取 socket
+        item.conn->pauseReading();
+        if (stalls_.fetch_add(1, std::memory_order_relaxed) == 0) {
+            spdlog::warn("Inbound queue full ({} messages), pausing reads until simulation catches up", ring_.capacity());
+        }
+        std::lock_guard<std::mutex> lock(overflow_mutex_);
+        overflow_.push_back(std::move(item));
+        overflowed_.store(true, std::memory_order_release);
+    }
+
+    MpscRing<Item> ring_;
+    // 溢出表只在环满后使用，受锁保护；每个连接暂停前最多积压一帧中的消息
+    std::mutex overflow_mutex_;
+    std::vector<Item> overflow_;
+    std::atomic<bool> overflowed_;
+    std::atomic<uint64_t> stalls_;
+    std::atomic<uint64_t> drops_;
+
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+};
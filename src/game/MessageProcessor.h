@@ -15,6 +15,12 @@ public:
             return false;
         }
 
+        // 只在逻辑帧线程上调用（lua_State 不是线程安全的）
+        // 记录客户端声明的可选编码，之后发给该连接的消息据此选择格式
+        if (msg.getCapabilities()) {
+            conn->addCapabilities(msg.getCapabilities());
+        }
+
         // 设置当前连接
         lua_vm->setCurrentConnection(conn);
 
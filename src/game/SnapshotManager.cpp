@@ -0,0 +1,398 @@
+#include "SnapshotManager.h"
+#include <ctime>
+#include <map>
+#include <utility>
+#include <google/protobuf/util/message_differencer.h>
+#include <spdlog/spdlog.h>
+#include "net/SharedFrame.h"
+#include "proto/CompactCodec.h"
+
+namespace {
+
+constexpr uint32_t fieldBit(int number) {
+    return 1u << number;
+}
+
+constexpr uint32_t POSITION_BIT = fieldBit(PlayerStateMessage::kPositionFieldNumber);
+constexpr uint32_t ROTATION_BIT = fieldBit(PlayerStateMessage::kRotationFieldNumber);
+constexpr uint32_t ATTRIBUTES_BIT = fieldBit(PlayerStateMessage::kAttributesFieldNumber);
+constexpr uint32_t IS_ALIVE_BIT = fieldBit(PlayerStateMessage::kIsAliveFieldNumber);
+constexpr uint32_t TEAM_ID_BIT = fieldBit(PlayerStateMessage::kTeamIdFieldNumber);
+constexpr uint32_t COMPACT_TRANSFORM_BIT = fieldBit(PlayerStateMessage::kCompactTransformFieldNumber);
+constexpr uint32_t ALL_FIELDS = POSITION_BIT | ROTATION_BIT | ATTRIBUTES_BIT | IS_ALIVE_BIT | TEAM_ID_BIT;
+
+// 序号按 32 位回绕比较
+bool isNewer(uint32_t a, uint32_t b) {
+    return static_cast<int32_t>(a - b) > 0;
+}
+
+bool sameVector(const Vector3& a, const Vector3& b) {
+    return a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+}
+
+uint32_t diffFields(const PlayerStateMessage& base, const PlayerStateMessage& cur) {
+    uint32_t changed = 0;
+    if (base.has_position() != cur.has_position() || !sameVector(base.position(), cur.position())) {
+        changed |= POSITION_BIT;
+    }
+    if (base.has_rotation() != cur.has_rotation() || !sameVector(base.rotation(), cur.rotation())) {
+        changed |= ROTATION_BIT;
+    }
+    if (base.has_attributes() != cur.has_attributes() ||
+        !google::protobuf::util::MessageDifferencer::Equals(base.attributes(), cur.attributes())) {
+        changed |= ATTRIBUTES_BIT;
+    }
+    if (base.is_alive() != cur.is_alive()) {
+        changed |= IS_ALIVE_BIT;
+    }
+    if (base.team_id() != cur.team_id()) {
+        changed |= TEAM_ID_BIT;
+    }
+    return changed;
+}
+
+// 按掩码写出变化的字段（置位但未填写的子消息表示已清除）；compact 时坐标和朝向合并为一个 compact_transform
+void writeEntity(const PlayerStateMessage& from, uint32_t changed, bool compact, EntityDelta* out) {
+    PlayerStateMessage* state = out->mutable_state();
+    state->set_player_id(from.player_id());
+    if (compact && (changed & (POSITION_BIT | ROTATION_BIT))) {
+        CompactCodec::encodeTransform(from.position(), from.rotation(), state->mutable_compact_transform());
+        changed = (changed & ~(POSITION_BIT | ROTATION_BIT)) | COMPACT_TRANSFORM_BIT;
+    } else {
+        if ((changed & POSITION_BIT) && from.has_position()) {
+            *state->mutable_position() = from.position();
+        }
+        if ((changed & ROTATION_BIT) && from.has_rotation()) {
+            *state->mutable_rotation() = from.rotation();
+        }
+    }
+    if ((changed & ATTRIBUTES_BIT) && from.has_attributes()) {
+        *state->mutable_attributes() = from.attributes();
+    }
+    if (changed & IS_ALIVE_BIT) {
+        state->set_is_alive(from.is_alive());
+    }
+    if (changed & TEAM_ID_BIT) {
+        state->set_team_id(from.team_id());
+    }
+    out->set_changed(changed);
+}
+
+bool mergeEntity(const EntityDelta& delta, PlayerStateMessage* to) {
+    const PlayerStateMessage& from = delta.state();
+    uint32_t changed = delta.changed();
+    to->set_player_id(from.player_id());
+    if (changed & COMPACT_TRANSFORM_BIT) {
+        if (!CompactCodec::decodeTransform(from.compact_transform(), to->mutable_position(), to->mutable_rotation())) {
+            return false;
+        }
+    }
+    if (changed & POSITION_BIT) {
+        if (from.has_position()) {
+            *to->mutable_position() = from.position();
+        } else {
+            to->clear_position();
+        }
+    }
+    if (changed & ROTATION_BIT) {
+        if (from.has_rotation()) {
+            *to->mutable_rotation() = from.rotation();
+        } else {
+            to->clear_rotation();
+        }
+    }
+    if (changed & ATTRIBUTES_BIT) {
+        if (from.has_attributes()) {
+            *to->mutable_attributes() = from.attributes();
+        } else {
+            to->clear_attributes();
+        }
+    }
+    if (changed & IS_ALIVE_BIT) {
+        to->set_is_alive(from.is_alive());
+    }
+    if (changed & TEAM_ID_BIT) {
+        to->set_team_id(from.team_id());
+    }
+    return true;
+}
+
+} // namespace
+
+SnapshotManager::SnapshotManager(size_t history)
+    : history_(history > 0 ? history : 1)
+    , sequence_(0) {
+}
+
+bool SnapshotManager::onMessage(const std::shared_ptr<Connection>& conn, const Message& msg) {
+    switch (msg.getType()) {
+        case MessageType::PLAYER_JOIN:
+            // 冒用他人 player_id 的加入不再交给处理器
+            if (!join(conn, msg.getPlayerId())) {
+                stats_.rejected++;
+                return true;
+            }
+            return false;
+        case MessageType::PLAYER_UPDATE: {
+            // player_id 由客户端填写，只接受发送连接加入时绑定的玩家
+            if (!isBoundTo(conn, msg.getPlayerId())) {
+                stats_.rejected++;
+                spdlog::debug("Dropping PLAYER_UPDATE for player {} from connection {}", msg.getPlayerId(), conn->getId());
+                return true;
+            }
+            const NetworkMessage* pb_msg = msg.getProto();
+            if (!pb_msg) {
+                return false;
+            }
+            if (pb_msg->has_player_update()) {
+                applyPlayerUpdate(conn, pb_msg->player_id(), pb_msg->player_update());
+            } else if (pb_msg->has_player_update_compact()) {
+                PlayerUpdateMessage update;
+                if (CompactCodec::decodePlayerUpdate(pb_msg->player_update_compact(), &update)) {
+                    applyPlayerUpdate(conn, pb_msg->player_id(), update);
+                }
+            }
+            return false;
+        }
+        case MessageType::PLAYER_LEAVE:
+            if (!isBoundTo(conn, msg.getPlayerId())) {
+                stats_.rejected++;
+                spdlog::debug("Dropping PLAYER_LEAVE for player {} from connection {}", msg.getPlayerId(), conn->getId());
+                return true;
+            }
+            sessions_.erase(conn->getId());
+            removePlayer(msg.getPlayerId());
+            return false;
+        case MessageType::SNAPSHOT_ACK: {
+            const NetworkMessage* pb_msg = msg.getProto();
+            if (pb_msg && pb_msg->has_snapshot_ack()) {
+                acknowledge(conn, pb_msg->snapshot_ack().sequence());
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool SnapshotManager::join(const std::shared_ptr<Connection>& conn, uint32_t player_id) {
+    for (const auto& pair : sessions_) {
+        if (pair.second.player_id != player_id || pair.first == conn->getId()) {
+            continue;
+        }
+        auto owner = pair.second.conn.lock();
+        if (owner && owner != conn) {
+            spdlog::warn("Player {} already joined on connection {}, ignoring join from {}",
+                         player_id, owner->getId(), conn->getId());
+            return false;
+        }
+    }
+
+    // 连接 ID 被新连接复用时视为首次加入
+    Session& session = sessions_[conn->getId()];
+    if (session.conn.lock() == conn && session.player_id != player_id) {
+        removePlayer(session.player_id);
+    }
+    session.conn = conn;
+    session.player_id = player_id;
+    return true;
+}
+
+bool SnapshotManager::isBoundTo(const std::shared_ptr<Connection>& conn, uint32_t player_id) const {
+    auto it = sessions_.find(conn->getId());
+    return it != sessions_.end() && it->second.player_id == player_id && it->second.conn.lock() == conn;
+}
+
+PlayerStateMessage* SnapshotManager::mutablePlayer(uint32_t player_id, const std::shared_ptr<Connection>& owner) {
+    Entity& entity = world_[player_id];
+    entity.state.set_player_id(player_id);
+    if (owner) {
+        entity.owner = owner;
+        entity.has_owner = true;
+    }
+    return &entity.state;
+}
+
+void SnapshotManager::removePlayer(uint32_t player_id) {
+    world_.erase(player_id);
+}
+
+void SnapshotManager::applyPlayerUpdate(const std::shared_ptr<Connection>& conn, uint32_t player_id,
+                                        const PlayerUpdateMessage& update) {
+    PlayerStateMessage* state = mutablePlayer(player_id, conn);
+    Vector3* position = state->mutable_position();
+    position->set_x(update.position_x());
+    position->set_y(update.position_y());
+    position->set_z(update.position_z());
+    Vector3* rotation = state->mutable_rotation();
+    rotation->set_x(update.rotation_x());
+    rotation->set_y(update.rotation_y());
+    rotation->set_z(update.rotation_z());
+    PlayerAttributeMessage* attributes = state->mutable_attributes();
+    attributes->set_player_id(player_id);
+    attributes->set_health(update.health());
+    state->set_is_alive(update.health() > 0.0f);
+}
+
+void SnapshotManager::acknowledge(const std::shared_ptr<Connection>& conn, uint32_t sequence) {
+    // 首次确认即订阅；连接 ID 被新连接复用时从完整快照重新开始
+    Client& client = clients_[conn->getId()];
+    if (client.conn.lock() != conn) {
+        client.conn = conn;
+        client.acked = 0;
+    }
+    // 乱序到达的旧确认和尚未发布的序号都忽略
+    if (sequence != 0 && isNewer(sequence, client.acked) && !isNewer(sequence, sequence_)) {
+        client.acked = sequence;
+    }
+}
+
+const SnapshotManager::Snapshot* SnapshotManager::findSnapshot(uint32_t sequence) const {
+    if (sequence == 0) {
+        return nullptr;
+    }
+    const auto& snapshot = history_[sequence % history_.size()];
+    return snapshot && snapshot->sequence == sequence ? snapshot.get() : nullptr;
+}
+
+void SnapshotManager::publish() {
+    // 所属连接已断开的玩家不再出现在快照中，其绑定一并清除
+    for (auto it = world_.begin(); it != world_.end();) {
+        if (it->second.has_owner && it->second.owner.expired()) {
+            it = world_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = sessions_.begin(); it != sessions_.end();) {
+        if (it->second.conn.expired()) {
+            it = sessions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (clients_.empty()) {
+        return;
+    }
+
+    // 冻结当前世界，0 保留为“无基线”
+    if (++sequence_ == 0) {
+        sequence_ = 1;
+    }
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->sequence = sequence_;
+    snapshot->players.reserve(world_.size());
+    for (const auto& pair : world_) {
+        snapshot->players.push_back(pair.second.state);
+    }
+    history_[sequence_ % history_.size()] = snapshot;
+    stats_.published++;
+
+    // 同一基线、同一编码方式的客户端共享编码结果
+    struct Encoded {
+        std::string body;
+        SharedFrame* frame = nullptr;
+    };
+    std::map<std::pair<uint32_t, bool>, Encoded> encoded;
+    NetworkMessage message;
+    message.set_msg_id(MessageType::WORLD_SNAPSHOT);
+    message.set_timestamp(static_cast<uint32_t>(time(nullptr)));
+
+    for (auto it = clients_.begin(); it != clients_.end();) {
+        // 连接关闭后由连接池释放，这里只看弱引用（连接状态属于 I/O 线程）
+        auto conn = it->second.conn.lock();
+        if (!conn) {
+            it = clients_.erase(it);
+            continue;
+        }
+
+        const Snapshot* baseline = findSnapshot(it->second.acked);
+        bool compact = conn->hasCapability(Capability::CAPABILITY_COMPACT_TRANSFORM);
+        Encoded& entry = encoded[{baseline ? baseline->sequence : 0, compact}];
+        if (entry.body.empty()) {
+            encodeDelta(baseline, *snapshot, compact, message.mutable_world_snapshot());
+            message.SerializeToString(&entry.body);
+            stats_.encoded_bytes += entry.body.size();
+        }
+        if (baseline) {
+            stats_.delta_sent++;
+        } else {
+            stats_.full_sent++;
+        }
+
+        // 优先走 UDP；没有 UDP 会话时经 TCP 发送，输出积压时旧快照被新快照替换
+        if (!udp_server_ || !udp_server_->sendBody(conn->getId(), entry.body)) {
+            if (!entry.frame) {
+                entry.frame = SharedFrame::fromBody(entry.body.data(), entry.body.size());
+            }
+            if (entry.frame) {
+                conn->sendStateUpdate(SNAPSHOT_ENTITY_KEY, entry.frame);
+            }
+        }
+        ++it;
+    }
+
+    for (auto& pair : encoded) {
+        if (pair.second.frame) {
+            pair.second.frame->release();
+        }
+    }
+}
+
+void SnapshotManager::encodeDelta(const Snapshot* baseline, const Snapshot& current, bool compact, WorldSnapshot* out) {
+    out->Clear();
+    out->set_sequence(current.sequence);
+    out->set_baseline(baseline ? baseline->sequence : 0);
+
+    // 两个快照都按 player_id 升序，归并一遍即可
+    static const std::vector<PlayerStateMessage> empty;
+    const auto& base = baseline ? baseline->players : empty;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < base.size() || j < current.players.size()) {
+        if (j == current.players.size() ||
+            (i < base.size() && base[i].player_id() < current.players[j].player_id())) {
+            out->add_removed(base[i].player_id());
+            ++i;
+        } else if (i == base.size() || current.players[j].player_id() < base[i].player_id()) {
+            writeEntity(current.players[j], ALL_FIELDS, compact, out->add_entities());
+            ++j;
+        } else {
+            uint32_t changed = diffFields(base[i], current.players[j]);
+            if (changed) {
+                writeEntity(current.players[j], changed, compact, out->add_entities());
+            }
+            ++i;
+            ++j;
+        }
+    }
+}
+
+bool SnapshotManager::applyDelta(const Snapshot* baseline, const WorldSnapshot& delta, Snapshot* out) {
+    std::map<uint32_t, PlayerStateMessage> players;
+    if (delta.baseline() != 0) {
+        if (!baseline || baseline->sequence != delta.baseline()) {
+            return false;
+        }
+        for (const auto& player : baseline->players) {
+            players.emplace(player.player_id(), player);
+        }
+    }
+
+    for (uint32_t player_id : delta.removed()) {
+        players.erase(player_id);
+    }
+    for (const auto& entity : delta.entities()) {
+        if (!mergeEntity(entity, &players[entity.state().player_id()])) {
+            return false;
+        }
+    }
+
+    out->sequence = delta.sequence();
+    out->players.clear();
+    out->players.reserve(players.size());
+    for (auto& pair : players) {
+        out->players.push_back(std::move(pair.second));
+    }
+    return true;
+}
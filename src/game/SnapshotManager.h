@@ -0,0 +1,114 @@
+/**
+ * @file SnapshotManager.h
+ * @brief 世界快照与增量同步
+ *
+ * 该模块负责：
+ * - 维护当前世界状态（各玩家的 PlayerStateMessage），由玩家上报的移动和离开消息更新；
+ *   连接在 PLAYER_JOIN 时绑定 player_id，之后只接受该连接针对这个 player_id 的移动和离开
+ * - 每帧末冻结为一个带序号的不可变快照，保存最近 history 帧
+ * - 记录每个订阅客户端最后确认（SNAPSHOT_ACK）的快照，下发时只编码相对该基线变化的
+ *   字段和实体；从未确认或基线已移出历史时发送完整快照
+ * - 基线相同（且编码方式相同）的客户端共享同一份编码结果
+ *
+ * 发送优先走已绑定地址的 UDP 会话，否则经 TCP 以可替换的状态更新发送（慢客户端只保留最新快照）。
+ * 所有方法只在逻辑线程上调用。
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "net/Connection.h"
+#include "net/UdpServer.h"
+#include "proto/Message.h"
+
+class SnapshotManager {
+public:
+    // 一帧的世界状态，按 player_id 升序
+    struct Snapshot {
+        uint32_t sequence = 0;
+        std::vector<PlayerStateMessage> players;
+    };
+
+    struct Stats {
+        uint64_t published = 0;        // 已冻结的快照数
+        uint64_t full_sent = 0;        // 发出的完整快照
+        uint64_t delta_sent = 0;       // 发出的增量快照
+        uint64_t encoded_bytes = 0;    // 编码后的消息体字节数（共享的编码只计一次）
+        uint64_t rejected = 0;         // player_id 已被占用或与发送连接不符而丢弃的消息
+    };
+
+    explicit SnapshotManager(size_t history = DEFAULT_HISTORY);
+
+    void setUdpServer(std::shared_ptr<UdpServer> udp_server) { udp_server_ = std::move(udp_server); }
+
+    // 处理与世界状态相关的入站消息：PLAYER_JOIN 为连接绑定 player_id，PLAYER_UPDATE 更新玩家状态，
+    // PLAYER_LEAVE 移除玩家，SNAPSHOT_ACK 记录确认。返回 true 表示消息已处理完毕、无需再分发
+    // （SNAPSHOT_ACK，以及 player_id 已被占用或与发送连接不符而被丢弃的消息）
+    bool onMessage(const std::shared_ptr<Connection>& conn, const Message& msg);
+
+    // 把 player_id 绑定到连接；已被另一个仍在线的连接占用时返回 false。
+    // 同一连接换用新的 player_id 时原玩家离开
+    bool join(const std::shared_ptr<Connection>& conn, uint32_t player_id);
+    // 连接已加入且绑定的正是 player_id
+    bool isBoundTo(const std::shared_ptr<Connection>& conn, uint32_t player_id) const;
+
+    // 当前世界状态，供逻辑代码直接修改；owner 断开后该玩家在下一次 publish 时移除
+    PlayerStateMessage* mutablePlayer(uint32_t player_id, const std::shared_ptr<Connection>& owner);
+    void removePlayer(uint32_t player_id);
+
+    // 客户端确认收到 sequence（0 表示订阅），只接受比当前确认更新的序号
+    void acknowledge(const std::shared_ptr<Connection>& conn, uint32_t sequence);
+
+    // 冻结当前世界为新快照，并按各客户端的基线编码发送
+    void publish();
+
+    // 编码 current 相对 baseline 的增量（baseline 为空时编码完整快照）
+    static void encodeDelta(const Snapshot* baseline, const Snapshot& current, bool compact, WorldSnapshot* out);
+    // 客户端侧的逆过程：把增量应用到基线上得到新快照，基线序号不符时返回 false
+    static bool applyDelta(const Snapshot* baseline, const WorldSnapshot& delta, Snapshot* out);
+
+    uint32_t getSequence() const { return sequence_; }
+    size_t getClientCount() const { return clients_.size(); }
+    const Stats& getStats() const { return stats_; }
+
+    static constexpr size_t DEFAULT_HISTORY = 64;
+    // TCP 上快照使用的状态更新键
+    static constexpr uint64_t SNAPSHOT_ENTITY_KEY = ~0ULL;
+
+private:
+    struct Entity {
+        PlayerStateMessage state;
+        std::weak_ptr<Connection> owner;
+        bool has_owner = false;   // 没有 owner 的实体（逻辑代码创建）只能显式移除
+    };
+
+    struct Client {
+        std::weak_ptr<Connection> conn;
+        uint32_t acked = 0;
+    };
+
+    // 连接加入时声明的玩家
+    struct Session {
+        std::weak_ptr<Connection> conn;
+        uint32_t player_id = 0;
+    };
+
+    // 序号在历史中时返回对应快照
+    const Snapshot* findSnapshot(uint32_t sequence) const;
+    void applyPlayerUpdate(const std::shared_ptr<Connection>& conn, uint32_t player_id, const PlayerUpdateMessage& update);
+
+    std::map<uint32_t, Entity> world_;
+    std::vector<std::shared_ptr<const Snapshot>> history_;
+    uint32_t sequence_;
+    std::unordered_map<ConnectionId, Client> clients_;
+    std::unordered_map<ConnectionId, Session> sessions_;
+    std::shared_ptr<UdpServer> udp_server_;
+    Stats stats_;
+};
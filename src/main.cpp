@@ -12,20 +12,32 @@
  */
 
 #include <iostream>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <signal.h>
 #include <event2/event.h>
 #include <spdlog/spdlog.h>
 #include "net/TcpServer.h"
 #include "core/EventLoop.h"
+#include "core/TickScheduler.h"
 #include "proto/Message.h"
 #include "script/LuaVM.h"
 #include "game/GameServer.h"
 #include "test/TestStorage.h"
+#include "test/TestUdpTransport.h"
+#include "test/TestMessageHeader.h"
+#include "test/TestCompactCodec.h"
+#include "test/TestSnapshotManager.h"
+#include "test/TestFrameCompressor.h"
+#include "test/TestTimerWheel.h"
+#include "test/TestOutboundQueue.h"
 
 // 定义是否运行测试的宏
 #define RUN_TESTS 1
 
-int main() {
+int main(int argc, char* argv[]) {
     // 忽略 SIGPIPE 信号
     signal(SIGPIPE, SIG_IGN);
 
@@ -39,11 +51,71 @@ int main() {
         spdlog::error("存储模块测试失败");
         return -1;
     }
+    if (!test::TestUdpTransport::runAllTests()) {
+        spdlog::error("UDP 通道测试失败");
+        return -1;
+    }
+    if (!test::TestMessageHeader::runAllTests()) {
+        spdlog::error("消息头快速解析测试失败");
+        return -1;
+    }
+    if (!test::TestCompactCodec::runAllTests()) {
+        spdlog::error("量化编解码测试失败");
+        return -1;
+    }
+    if (!test::TestSnapshotManager::runAllTests()) {
+        spdlog::error("世界快照测试失败");
+        return -1;
+    }
+    if (!test::TestFrameCompressor::runAllTests()) {
+        spdlog::error("帧压缩测试失败");
+        return -1;
+    }
+    if (!test::TestTimerWheel::runAllTests()) {
+        spdlog::error("时间轮测试失败");
+        return -1;
+    }
+    if (!test::TestOutboundQueue::runAllTests()) {
+        spdlog::error("出站队列测试失败");
+        return -1;
+    }
     spdlog::info("所有测试通过");
 #endif
 
+    // 可选参数：reactor 线程数，默认单线程
+    size_t reactor_count = 1;
+    if (argc > 1) {
+        reactor_count = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    // 可选参数：网络后端，libevent（默认）或 io_uring
+    TcpServer::Backend backend = TcpServer::Backend::LIBEVENT;
+    if (argc > 2) {
+        if (std::strcmp(argv[2], "io_uring") == 0) {
+            backend = TcpServer::Backend::IO_URING;
+        } else if (std::strcmp(argv[2], "libevent") != 0) {
+            spdlog::warn("Unknown backend '{}', using libevent", argv[2]);
+        }
+    }
+
+    // 可选参数：逻辑帧频率（Hz），如 30/60/128
+    uint32_t tick_rate = GameServer::DEFAULT_TICK_RATE_HZ;
+    if (argc > 3) {
+        char* end = nullptr;
+        errno = 0;
+        unsigned long value = std::strtoul(argv[3], &end, 10);
+        // strtoul 会跳过前导空白并接受负号，要求以数字开头
+        if (!std::isdigit(static_cast<unsigned char>(argv[3][0])) || *end != '\0' || errno == ERANGE ||
+            value < TickScheduler::MIN_TICK_RATE_HZ || value > TickScheduler::MAX_TICK_RATE_HZ) {
+            spdlog::error("Invalid tick rate '{}', expected an integer in [{}, {}] Hz",
+                          argv[3], TickScheduler::MIN_TICK_RATE_HZ, TickScheduler::MAX_TICK_RATE_HZ);
+            return 1;
+        }
+        tick_rate = static_cast<uint32_t>(value);
+    }
+
     // 创建并运行服务器
-    GameServer server;
+    GameServer server(reactor_count, backend, tick_rate);
     if (!server.init()) {
         spdlog::error("Failed to init server");
         return 1;
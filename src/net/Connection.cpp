@@ -1,88 +1,535 @@
 #include "Connection.h"
+#include "UringReactor.h"
+#include "proto/CodecDiagnostics.h"
 #include <event2/bufferevent.h>
 #include <event2/buffer.h>
 #include <event2/event.h>
 #include <spdlog/spdlog.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <cstring>
-#include <uuid/uuid.h>
 #include <arpa/inet.h>  // for htonl/ntohl
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <cerrno>
 
 // 最大消息大小限制（10MB）
 constexpr size_t MAX_MESSAGE_SIZE = 10 * 1024 * 1024;
 
 Connection::Connection(struct bufferevent* bev) 
-    : bev_(bev), connected_(true) {
-    // 生成唯一ID
-    uuid_t uuid;
-    uuid_generate(uuid);
-    char uuid_str[37];
-    uuid_unparse_lower(uuid, uuid_str);
-    id_ = uuid_str;
-
+    : bev_(bev), uring_(nullptr), uring_key_(0), input_(nullptr), output_(nullptr), outbox_(nullptr)
+    , id_(INVALID_CONNECTION_ID), connected_(true), read_paused_(false), filtered_messages_(0), compress_threshold_(0)
+    , coalesce_(false), flush_event_(nullptr), flush_interval_{0, 0}
+    , pending_frames_(0), mss_(1460)
+    , pending_bytes_(0), overflowed_(false)
+    , idle_wheel_(nullptr), idle_timeout_ms_(0), last_activity_ms_(TimerWheel::nowMs())
+    , capabilities_(0) {
     // 设置回调
-    bufferevent_setcb(bev_, readCallback, nullptr, errorCallback, this);
+    bufferevent_setcb(bev_, readCallback, writeCallback, errorCallback, this);
     bufferevent_enable(bev_, BEV_EVENT_READING | BEV_EVENT_WRITING);
+    setOutputLimits(limits_);
+}
+
+Connection::Connection(UringReactor* uring, uint64_t uring_key)
+    : bev_(nullptr), uring_(uring), uring_key_(uring_key)
+    , input_(evbuffer_new()), output_(evbuffer_new()), outbox_(nullptr)
+    , id_(INVALID_CONNECTION_ID), connected_(true), read_paused_(false), filtered_messages_(0), compress_threshold_(0)
+    , coalesce_(false), flush_event_(nullptr), flush_interval_{0, 0}
+    , pending_frames_(0), mss_(1460)
+    , pending_bytes_(0), overflowed_(false)
+    , idle_wheel_(nullptr), idle_timeout_ms_(0), last_activity_ms_(TimerWheel::nowMs())
+    , capabilities_(0) {
+    // 输出缓冲区可能被其他线程写入（广播、UDP 响应）
+    evbuffer_enable_locking(output_, nullptr);
 }
 
 Connection::~Connection() {
     close();
+    if (input_) {
+        evbuffer_free(input_);
+    }
+    if (output_) {
+        evbuffer_free(output_);
+    }
 }
 
 void Connection::close() {
-    if (connected_) {
-        connected_ = false;
+    if (connected_ && needsHandoff()) {
+        // 析构过程中无法再转交，只能就地关闭
+        if (auto self = weak_from_this().lock()) {
+            outbox_->push(OutboundQueue::Item{self, nullptr, 0, OutboundQueue::Kind::CLOSE});
+            return;
+        }
+    }
+    // 只在所属线程上执行，之后其他线程的发送在 isOpen() 处返回
+    if (connected_.exchange(false)) {
         if (close_cb_) {
             // 在调用回调之前先保存一个智能指针，防止提前释放
             auto self = shared_from_this();
             close_cb_(self);
         }
+        if (flush_event_) {
+            event_free(flush_event_);
+            flush_event_ = nullptr;
+        }
+        idle_timer_.cancel();
+        for (auto& pending : pending_updates_) {
+            pending.second->release();
+        }
+        pending_updates_.clear();
+        pending_bytes_ = 0;
         if (bev_) {
             bufferevent_free(bev_);
             bev_ = nullptr;
         }
+        if (uring_) {
+            // 由 reactor 在其线程上关闭 socket 并在未完成的收发结束后释放
+            uring_->closeConnection(uring_key_);
+        }
     }
 }
 
 bool Connection::sendMessage(const Message& msg) {
-    if (!connected_ || !bev_) {
+    const auto& body = msg.getBody();
+    return sendBody(body.data(), body.size());
+}
+
+bool Connection::sendBody(const void* body, size_t len) {
+    if (!isOpen()) {
         return false;
     }
+    if (needsHandoff()) {
+        return handoff(SharedFrame::fromBody(body, len), OutboundQueue::Kind::FRAME);
+    }
+    if (wantsCompression(len)) {
+        SharedFrame* frame = SharedFrame::fromBody(body, len);
+        bool ok = sendFrame(frame);
+        if (frame) {
+            frame->release();
+        }
+        return ok;
+    }
+
+    if (!admitFrame(sizeof(uint32_t) + len)) {
+        return false;
+    }
+
+    struct evbuffer_iovec vec;
+    uint8_t* out = beginFrame(len, vec);
+    if (!out) {
+        return false;
+    }
+    if (len > 0) {
+        std::memcpy(out, body, len);
+    }
+    return commitFrame(vec);
+}
 
-    // 序列化消息
-    std::vector<uint8_t> data;
-    if (!msg.serialize(data)) {
-        spdlog::error("Failed to serialize message");
+bool Connection::sendProto(const google::protobuf::MessageLite& proto) {
+    if (!isOpen()) {
         return false;
     }
+    if (needsHandoff()) {
+        return handoff(SharedFrame::fromProto(proto), OutboundQueue::Kind::FRAME);
+    }
 
-    // 发送数据
-    if (bufferevent_write(bev_, data.data(), data.size()) < 0) {
+    // 只序列化一次，直接写入输出缓冲区
+    size_t len = proto.ByteSizeLong();
+    if (wantsCompression(len)) {
+        SharedFrame* frame = SharedFrame::fromProto(proto);
+        bool ok = sendFrame(frame);
+        if (frame) {
+            frame->release();
+        }
+        return ok;
+    }
+    if (!admitFrame(sizeof(uint32_t) + len)) {
+        return false;
+    }
+
+    struct evbuffer_iovec vec;
+    uint8_t* out = beginFrame(len, vec);
+    if (!out) {
+        return false;
+    }
+    proto.SerializeWithCachedSizesToArray(out);
+    return commitFrame(vec);
+}
+
+bool Connection::sendFrame(SharedFrame* frame) {
+    if (!isOpen() || !frame) {
+        return false;
+    }
+    if (needsHandoff()) {
+        frame->retain();
+        return handoff(frame, OutboundQueue::Kind::FRAME);
+    }
+    if (wantsCompression(frame->size() - sizeof(uint32_t))) {
+        frame = frame->compressed();
+    }
+    if (!admitFrame(frame->size())) {
+        return false;
+    }
+
+    frame->retain();
+    if (evbuffer_add_reference(outputBuffer(), frame->data(), frame->size(),
+                               SharedFrame::releaseCallback, frame) < 0) {
+        frame->release();
         spdlog::error("Failed to write to buffer");
         return false;
     }
+    onFrameQueued();
+    return true;
+}
+
+bool Connection::sendStateUpdate(uint64_t entity_key, SharedFrame* frame) {
+    if (!isOpen() || !frame) {
+        return false;
+    }
+    if (needsHandoff()) {
+        frame->retain();
+        return handoff(frame, OutboundQueue::Kind::STATE_UPDATE, entity_key);
+    }
+    if (wantsCompression(frame->size() - sizeof(uint32_t))) {
+        frame = frame->compressed();
+    }
+
+    evbuffer_lock(outputBuffer());
+    size_t out_len = evbuffer_get_length(outputBuffer());
+    // 已有暂存的更新时也继续暂存，保证同一实体的更新不会乱序
+    bool backlogged = limits_.high_watermark > 0 &&
+                      (out_len >= limits_.high_watermark || !pending_updates_.empty());
+    if (!backlogged) {
+        evbuffer_unlock(outputBuffer());
+        return sendFrame(frame);
+    }
+
+    if (!admitFrame(frame->size())) {
+        evbuffer_unlock(outputBuffer());
+        return false;
+    }
 
+    frame->retain();
+    auto it = pending_updates_.find(entity_key);
+    if (it != pending_updates_.end()) {
+        // 替换该实体尚未发出的旧状态
+        backpressure_stats_.updates_coalesced++;
+        backpressure_stats_.bytes_coalesced += it->second->size();
+        pending_bytes_ -= it->second->size();
+        it->second->release();
+        it->second = frame;
+    } else {
+        pending_updates_.emplace(entity_key, frame);
+    }
+    pending_bytes_ += frame->size();
+    // 写合并模式下没有写事件，由 flush 定时器在缓冲区降下来后补发
+    if (coalesce_) {
+        armFlushTimer();
+    }
+    evbuffer_unlock(outputBuffer());
     return true;
 }
 
-void Connection::onRead() {
-    struct evbuffer* input = bufferevent_get_input(bev_);
-    size_t len = evbuffer_get_length(input);
-    
-    if (len == 0) {
+bool Connection::sendBatch(SharedFrame* const* frames, size_t count) {
+    // 需要压缩的帧单独发送，沿用共享帧缓存的压缩版本；其间相邻的普通帧合成批次帧
+    bool ok = true;
+    size_t start = 0;
+    for (size_t i = 0; i <= count; ++i) {
+        if (i < count && frames[i]->flags() == 0 && !wantsCompression(frames[i]->size() - sizeof(uint32_t))) {
+            continue;
+        }
+        ok = writeBatch(frames + start, i - start) && ok;
+        if (i < count) {
+            ok = sendFrame(frames[i]) && ok;
+        }
+        start = i + 1;
+    }
+    return ok;
+}
+
+bool Connection::writeBatch(SharedFrame* const* frames, size_t count) {
+    if (count == 0) {
+        return true;
+    }
+    if (count == 1) {
+        return sendFrame(frames[0]);
+    }
+
+    // 每项编码为 MessageBatch.messages：1 字节 tag + varint 长度 + 消息体
+    size_t len = 0;
+    for (size_t i = 0; i < count; ++i) {
+        size_t body_len = frames[i]->size() - sizeof(uint32_t);
+        len += 1 + google::protobuf::io::CodedOutputStream::VarintSize64(body_len) + body_len;
+    }
+    if (len > ::MAX_MESSAGE_SIZE) {
+        bool ok = true;
+        for (size_t i = 0; i < count; ++i) {
+            ok = sendFrame(frames[i]) && ok;
+        }
+        return ok;
+    }
+    if (!admitFrame(sizeof(uint32_t) + len)) {
+        return false;
+    }
+
+    // 先在临时缓冲区拼好整帧再整体移入输出缓冲区（只移动块，不拷贝），中途失败不会留下半帧。
+    // 较大的消息体以引用挂入，与其他连接共享同一份数据；较小的直接拷贝，比单独一个引用块更省
+    struct evbuffer* batch = evbuffer_new();
+    if (!batch) {
+        spdlog::error("Failed to allocate batch buffer");
+        return false;
+    }
+    uint32_t net_len = htonl(static_cast<uint32_t>(len) | FRAME_FLAG_BATCH);
+    bool ok = evbuffer_add(batch, &net_len, sizeof(net_len)) == 0;
+    for (size_t i = 0; ok && i < count; ++i) {
+        SharedFrame* frame = frames[i];
+        const uint8_t* body = frame->data() + sizeof(uint32_t);
+        size_t body_len = frame->size() - sizeof(uint32_t);
+        uint8_t prefix[1 + 10];
+        prefix[0] = static_cast<uint8_t>((MessageBatch::kMessagesFieldNumber << 3) | 2);
+        uint8_t* end = google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(body_len, prefix + 1);
+        ok = evbuffer_add(batch, prefix, end - prefix) == 0;
+        if (!ok || body_len == 0) {
+            continue;
+        }
+        if (body_len < BATCH_COPY_THRESHOLD) {
+            ok = evbuffer_add(batch, body, body_len) == 0;
+            continue;
+        }
+        frame->retain();
+        ok = evbuffer_add_reference(batch, body, body_len, SharedFrame::releaseCallback, frame) == 0;
+        if (!ok) {
+            frame->release();
+        }
+    }
+    ok = ok && evbuffer_add_buffer(outputBuffer(), batch) == 0;
+    evbuffer_free(batch);
+    if (!ok) {
+        spdlog::error("Failed to write batch to buffer");
+        return false;
+    }
+    onFrameQueued();
+    return true;
+}
+
+bool Connection::handoff(SharedFrame* frame, OutboundQueue::Kind kind, uint64_t entity_key) {
+    if (!frame) {
+        return false;
+    }
+    // 硬上限、背压等检查都在所属线程上执行
+    outbox_->push(OutboundQueue::Item{shared_from_this(), frame, entity_key, kind});
+    return true;
+}
+
+void Connection::setOutputLimits(const OutputLimits& limits) {
+    limits_ = limits;
+    if (bev_) {
+        // 输出缓冲区降到低水位时触发 writeCallback 补发暂存的更新
+        bufferevent_setwatermark(bev_, EV_WRITE, limits_.low_watermark, 0);
+    }
+}
+
+bool Connection::admitFrame(size_t frame_len) {
+    if (limits_.hard_cap == 0) {
+        return true;
+    }
+
+    evbuffer_lock(outputBuffer());
+    size_t queued = evbuffer_get_length(outputBuffer()) + pending_bytes_;
+    if (queued + frame_len <= limits_.hard_cap) {
+        evbuffer_unlock(outputBuffer());
+        return true;
+    }
+
+    backpressure_stats_.frames_dropped++;
+    backpressure_stats_.bytes_dropped += frame_len;
+    if (!overflowed_) {
+        overflowed_ = true;
+        spdlog::warn("Connection {} output exceeds hard cap ({} bytes queued, cap {}), dropping client",
+                     id_, queued, limits_.hard_cap);
+        // 可能在其他 reactor 线程上发送，断开操作交给连接所属的事件循环执行
+        std::weak_ptr<Connection> weak = shared_from_this();
+        if (uring_) {
+            uring_->post([weak]() {
+                if (auto conn = weak.lock()) {
+                    conn->closeSlowClient();
+                }
+            });
+        } else {
+            auto ctx = new std::weak_ptr<Connection>(weak);
+            if (event_base_once(bufferevent_get_base(bev_), -1, EV_TIMEOUT, overflowCallback, ctx, nullptr) < 0) {
+                delete ctx;
+            }
+        }
+    }
+    evbuffer_unlock(outputBuffer());
+    return false;
+}
+
+void Connection::drainPendingUpdates() {
+    evbuffer_lock(outputBuffer());
+    if (pending_updates_.empty()) {
+        evbuffer_unlock(outputBuffer());
+        return;
+    }
+
+    struct evbuffer* output = outputBuffer();
+    for (auto& pending : pending_updates_) {
+        // 暂存时持有的引用直接转交给 evbuffer
+        SharedFrame* frame = pending.second;
+        if (evbuffer_add_reference(output, frame->data(), frame->size(),
+                                   SharedFrame::releaseCallback, frame) < 0) {
+            frame->release();
+            continue;
+        }
+        onFrameQueued();
+    }
+    pending_updates_.clear();
+    pending_bytes_ = 0;
+    evbuffer_unlock(outputBuffer());
+}
+
+void Connection::enableWriteCoalescing(uint32_t flush_interval_ms) {
+    if (coalesce_ || !bev_) {
+        if (uring_) {
+            spdlog::debug("Write coalescing is not used with io_uring backend: {}", id_);
+        }
+        return;
+    }
+
+    flush_event_ = evtimer_new(bufferevent_get_base(bev_), flushCallback, this);
+    if (!flush_event_) {
+        spdlog::error("Failed to create flush timer: {}", id_);
+        return;
+    }
+    flush_interval_.tv_sec = flush_interval_ms / 1000;
+    flush_interval_.tv_usec = (flush_interval_ms % 1000) * 1000;
+
+    // 用于估算节省的分段数
+    int mss = 0;
+    socklen_t optlen = sizeof(mss);
+    if (getsockopt(bufferevent_getfd(bev_), IPPROTO_TCP, TCP_MAXSEG, &mss, &optlen) == 0 && mss > 0) {
+        mss_ = static_cast<size_t>(mss);
+    }
+
+    // 关闭写事件：出站数据只在 flush() 时写出
+    coalesce_ = true;
+    bufferevent_disable(bev_, EV_WRITE);
+}
+
+void Connection::flush() {
+    if (!coalesce_ || !isOpen()) {
+        return;
+    }
+    if (needsHandoff()) {
+        outbox_->push(OutboundQueue::Item{shared_from_this(), nullptr, 0, OutboundQueue::Kind::FLUSH});
+        return;
+    }
+
+    evbuffer_lock(outputBuffer());
+    event_del(flush_event_);
+    struct evbuffer* output = outputBuffer();
+    if (evbuffer_get_length(output) <= limits_.low_watermark) {
+        drainPendingUpdates();
+    }
+    size_t len = evbuffer_get_length(output);
+    if (len == 0 || pending_frames_ == 0) {
+        evbuffer_unlock(outputBuffer());
         return;
     }
 
-    // 读取数据到缓冲区
-    size_t old_size = read_buffer_.size();
-    read_buffer_.resize(old_size + len);
-    evbuffer_remove(input, read_buffer_.data() + old_size, len);
+    // 一次 writev 写出本 tick 暂存的所有帧
+    int n = evbuffer_write(output, bufferevent_getfd(bev_));
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        spdlog::error("Failed to flush connection {}: {}", id_, strerror(errno));
+    }
+
+    coalesce_stats_.flushes++;
+    coalesce_stats_.bytes += len;
+    coalesce_stats_.syscalls_saved += pending_frames_ - 1;
+    size_t packets = (len + mss_ - 1) / mss_;
+    if (pending_frames_ > packets) {
+        coalesce_stats_.packets_saved += pending_frames_ - packets;
+    }
+    pending_frames_ = 0;
+
+    // 没写完（内核缓冲区满）或写出出错时交给 bufferevent 处理，写空后在 writeCallback 中再次关闭写事件
+    if (n < 0 || evbuffer_get_length(output) > 0) {
+        bufferevent_enable(bev_, EV_WRITE);
+    }
+    evbuffer_unlock(outputBuffer());
+}
+
+void Connection::onFrameQueued() {
+    if (uring_) {
+        // 由 reactor 在本轮事件循环末尾批量提交发送
+        uring_->scheduleSend(uring_key_);
+        return;
+    }
+    if (!coalesce_) {
+        return;
+    }
+
+    evbuffer_lock(outputBuffer());
+    pending_frames_++;
+    coalesce_stats_.frames++;
+    armFlushTimer();
+    evbuffer_unlock(outputBuffer());
+}
+
+void Connection::armFlushTimer() {
+    if (!evtimer_pending(flush_event_, nullptr)) {
+        evtimer_add(flush_event_, &flush_interval_);
+    }
+}
+
+uint8_t* Connection::beginFrame(size_t body_len, struct evbuffer_iovec& vec) {
+    // 出站大小限制与 Message::serialize 保持一致
+    if (body_len > ::MAX_MESSAGE_SIZE) {
+        spdlog::error("Message body too large: {} bytes (max: {})", body_len, ::MAX_MESSAGE_SIZE);
+        return nullptr;
+    }
+
+    size_t total_size = sizeof(uint32_t) + body_len;
+    struct evbuffer* output = outputBuffer();
+    evbuffer_lock(output);
+    if (evbuffer_reserve_space(output, static_cast<ev_ssize_t>(total_size), &vec, 1) < 1) {
+        evbuffer_unlock(outputBuffer());
+        spdlog::error("Failed to reserve output buffer: {} bytes", total_size);
+        return nullptr;
+    }
+
+    // 写4字节body长度（网络字节序）
+    uint32_t net_len = htonl(static_cast<uint32_t>(body_len));
+    std::memcpy(vec.iov_base, &net_len, sizeof(net_len));
+    vec.iov_len = total_size;
+    return static_cast<uint8_t*>(vec.iov_base) + sizeof(net_len);
+}
 
-    // 处理消息
-    while (read_buffer_.size() >= sizeof(uint32_t)) {  // 至少要有4字节长度字段
+bool Connection::commitFrame(struct evbuffer_iovec& vec) {
+    int rc = evbuffer_commit_space(outputBuffer(), &vec, 1);
+    evbuffer_unlock(outputBuffer());
+    if (rc < 0) {
+        spdlog::error("Failed to write to buffer");
+        return false;
+    }
+    onFrameQueued();
+    return true;
+}
+
+void Connection::onRead() {
+    // 回调中可能关闭并移除连接，保证处理期间对象存活
+    auto self = shared_from_this();
+    struct evbuffer* input = inputBuffer();
+    touch();
+
+    // 直接在 evbuffer 上拆包：先窥视4字节长度，完整帧再 pullup 成连续内存交给解码器
+    while (connected_ && !isReadPaused() && evbuffer_get_length(input) >= sizeof(uint32_t)) {  // 至少要有4字节长度字段
         // 读取4字节长度（网络字节序）
         uint32_t net_len = 0;
-        std::memcpy(&net_len, read_buffer_.data(), sizeof(uint32_t));
-        uint32_t body_len = ntohl(net_len);
+        evbuffer_copyout(input, &net_len, sizeof(uint32_t));
+        uint32_t flags = ntohl(net_len) & FRAME_FLAGS_MASK;
+        uint32_t body_len = ntohl(net_len) & FRAME_LENGTH_MASK;
         size_t total_size = sizeof(uint32_t) + body_len;
 
         if (body_len > MAX_MESSAGE_SIZE) {
@@ -90,18 +537,80 @@ void Connection::onRead() {
             close();
             return;
         }
+        if (flags & ~(FRAME_FLAG_BATCH | FRAME_FLAG_COMPRESSED)) {
+            spdlog::error("Unsupported frame flags {:#x} from {}", flags, id_);
+            close();
+            return;
+        }
 
-        if (read_buffer_.size() < total_size) {
+        if (evbuffer_get_length(input) < total_size) {
             break;  // 等待更多数据
         }
 
-        // 处理完整消息
-        std::vector<uint8_t> message_data(read_buffer_.begin(), read_buffer_.begin() + total_size);
-        handleMessage(message_data);
+        // 处理完整消息，帧已连续时 pullup 不会发生拷贝
+        const uint8_t* frame = evbuffer_pullup(input, static_cast<ev_ssize_t>(total_size));
+        if (!frame) {
+            spdlog::error("Failed to pull up message frame: {} bytes", total_size);
+            close();
+            return;
+        }
+        const uint8_t* body = frame + sizeof(uint32_t);
+        size_t len = body_len;
+        BufferSlice inflated;
+        bool ok = true;
+        if (flags & FRAME_FLAG_COMPRESSED) {
+            // 直接解压到 slab 中，其中的消息引用解压结果；解压失败时只丢弃这一帧
+            if (!decompressor_) {
+                decompressor_ = std::make_unique<FrameCompressor>();
+            }
+            ok = decompressor_->decompress(body, len, MAX_MESSAGE_SIZE, inflated);
+            if (ok) {
+                body = inflated.data();
+                len = inflated.size();
+            } else {
+                spdlog::error("Failed to decompress frame from {}", id_);
+            }
+        }
+        const BufferSlice* owner = (flags & FRAME_FLAG_COMPRESSED) ? &inflated : nullptr;
+        if (ok && (flags & FRAME_FLAG_BATCH)) {
+            handleBatch(body, len, owner);
+        } else if (ok) {
+            handleMessage(body, len, owner);
+        }
+
+        // 回调中连接可能已被关闭
+        if (!connected_) {
+            return;
+        }
 
         // 移除已处理的数据
-        read_buffer_.erase(read_buffer_.begin(), read_buffer_.begin() + total_size);
+        evbuffer_drain(input, total_size);
+    }
+
+    // 读取已暂停：停止从 socket 读取，让 TCP 窗口把压力反馈给对端（io_uring 后端由 reactor 处理）
+    if (bev_ && isReadPaused()) {
+        bufferevent_disable(bev_, EV_READ);
+    }
+}
+
+void Connection::resumeReading() {
+    if (!isOpen()) {
+        return;
+    }
+    if (needsHandoff()) {
+        outbox_->push(OutboundQueue::Item{shared_from_this(), nullptr, 0, OutboundQueue::Kind::RESUME_READ});
+        return;
+    }
+    if (!read_paused_.exchange(false)) {
+        return;
+    }
+    if (bev_) {
+        bufferevent_enable(bev_, EV_READ);
+    } else if (uring_) {
+        uring_->resumeRecv(uring_key_);
     }
+    // 暂停期间已收到的完整帧不会再触发读回调，这里补处理
+    onRead();
 }
 
 void Connection::onError(short events) {
@@ -113,34 +622,38 @@ void Connection::onError(short events) {
     close();
 }
 
-void Connection::handleMessage(const std::vector<uint8_t>& data) {
-    if (data.size() < sizeof(uint32_t)) {
-        spdlog::error("Message too small: {} bytes", data.size());
-        return;
+bool Connection::decodeMessage(const uint8_t* body, size_t len, const BufferSlice* owner, Message& msg) {
+    // 先只读消息头，被过滤的消息不复制也不解析
+    if (message_filter_) {
+        MessageHeader header;
+        if (!Message::peekHeader(body, len, header)) {
+            spdlog::error("Failed to deserialize message");
+            return false;
+        }
+        if (!message_filter_(*this, header)) {
+            filtered_messages_++;
+            return false;
+        }
     }
 
-    // 读取4字节长度（网络字节序）
-    uint32_t net_len = 0;
-    std::memcpy(&net_len, data.data(), sizeof(uint32_t));
-    uint32_t body_len = ntohl(net_len);
-
-    if (data.size() != sizeof(uint32_t) + body_len) {
-        spdlog::error("Invalid message size: got {} bytes, expected {} bytes", 
-                     data.size(), sizeof(uint32_t) + body_len);
-        return;
+    // 反序列化：引用 owner 的切片，或复制出帧后释放的输入缓冲区
+    BufferSlice slice = owner ? owner->slice(static_cast<size_t>(body - owner->data()), len)
+                              : BufferSlice::copyOf(body, len);
+    if (!msg.deserializeBody(std::move(slice))) {
+        spdlog::error("Failed to deserialize message");
+        return false;
     }
 
-    // 创建消息对象并反序列化
+    CODEC_TRACE("Received message type: {}", static_cast<uint32_t>(msg.getType()));
+    return true;
+}
+
+void Connection::handleMessage(const uint8_t* body, size_t len, const BufferSlice* owner) {
     Message msg;
-    if (!msg.deserialize(data)) {
-        spdlog::error("Failed to deserialize message");
+    if (!decodeMessage(body, len, owner, msg)) {
         return;
     }
 
-    // 获取消息类型（确保使用正确的字节序）
-    MessageType type = msg.getType();
-    spdlog::debug("Received message type: {}", static_cast<uint32_t>(type));
-
     // 调用消息回调
     if (message_cb_) {
         auto self = shared_from_this();
@@ -148,11 +661,120 @@ void Connection::handleMessage(const std::vector<uint8_t>& data) {
     }
 }
 
+void Connection::handleBatch(const uint8_t* body, size_t len, const BufferSlice* owner) {
+    // 整批复制一次，批内消息都引用这份拷贝
+    BufferSlice copy;
+    if (!owner) {
+        copy = BufferSlice::copyOf(body, len);
+        owner = &copy;
+        body = copy.data();
+    }
+
+    // 先拆出并解码整批，批次格式非法时整批丢弃
+    batch_.clear();
+    const uint8_t* p = body;
+    const uint8_t* end = body + len;
+    while (p < end) {
+        const uint8_t* msg_body;
+        size_t msg_len;
+        if (!Message::nextInBatch(p, end, msg_body, msg_len)) {
+            spdlog::error("Malformed message batch from {}", id_);
+            batch_.clear();
+            return;
+        }
+        batch_.emplace_back();
+        if (!decodeMessage(msg_body, msg_len, owner, batch_.back())) {
+            batch_.pop_back();
+        }
+    }
+    if (batch_.empty()) {
+        return;
+    }
+
+    auto self = shared_from_this();
+    if (batch_cb_) {
+        batch_cb_(self, batch_);
+    } else if (message_cb_) {
+        for (const auto& msg : batch_) {
+            message_cb_(self, msg);
+            if (!connected_) {
+                break;
+            }
+        }
+    }
+    batch_.clear();
+}
+
 void Connection::readCallback(struct bufferevent* bev, void* ctx) {
     auto conn = static_cast<Connection*>(ctx);
     conn->onRead();
 }
 
+void Connection::writeCallback(struct bufferevent* bev, void* ctx) {
+    auto conn = static_cast<Connection*>(ctx);
+    // 输出缓冲区降到低水位以下，补发暂存的状态更新
+    conn->onOutputWritten();
+
+    // 写合并模式：输出缓冲区已写空，恢复暂存模式
+    if (conn->coalesce_ && evbuffer_get_length(bufferevent_get_output(bev)) == 0) {
+        bufferevent_disable(bev, EV_WRITE);
+    }
+}
+
+void Connection::overflowCallback(evutil_socket_t fd, short events, void* ctx) {
+    auto weak = static_cast<std::weak_ptr<Connection>*>(ctx);
+    if (auto conn = weak->lock()) {
+        conn->closeSlowClient();
+    }
+    delete weak;
+}
+
+void Connection::closeSlowClient() {
+    const auto& stats = backpressure_stats_;
+    spdlog::warn("Closing slow connection {}: dropped {} frames ({} bytes), coalesced {} updates ({} bytes)",
+                 id_, stats.frames_dropped, stats.bytes_dropped,
+                 stats.updates_coalesced, stats.bytes_coalesced);
+    close();
+}
+
+void Connection::enableIdleTimeout(TimerWheel* wheel, uint32_t idle_timeout_ms) {
+    if (!wheel || idle_timeout_ms == 0) {
+        return;
+    }
+    idle_wheel_ = wheel;
+    idle_timeout_ms_ = idle_timeout_ms;
+    touch();
+    idle_timer_.setCallback([this]() { onIdleTimer(); });
+    idle_wheel_->schedule(idle_timer_, idle_timeout_ms_);
+}
+
+void Connection::onIdleTimer() {
+    if (!connected_) {
+        return;
+    }
+
+    uint64_t idle = TimerWheel::nowMs() - last_activity_ms_.load(std::memory_order_relaxed);
+    if (idle < idle_timeout_ms_) {
+        idle_wheel_->schedule(idle_timer_, idle_timeout_ms_ - idle);
+        return;
+    }
+
+    auto self = shared_from_this();
+    spdlog::info("Closing idle connection {}: no activity for {} ms", id_, idle);
+    close();
+}
+
+void Connection::onOutputWritten() {
+    if (evbuffer_get_length(outputBuffer()) <= limits_.low_watermark) {
+        drainPendingUpdates();
+    }
+}
+
+void Connection::flushCallback(evutil_socket_t fd, short events, void* ctx) {
+    auto conn = static_cast<Connection*>(ctx);
+    conn->flush();
+}
+
 void Connection::errorCallback(struct bufferevent* bev, short events, void* ctx) {
     auto conn = static_cast<Connection*>(ctx);
     conn->onError(events);
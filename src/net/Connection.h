@@ -1,47 +1,233 @@
 #pragma once
 
 #include <event2/bufferevent.h>
+#include <event2/buffer.h>
+#include <atomic>
 #include <string>
 #include <memory>
 #include <functional>
+#include <unordered_map>
 #include "proto/Message.h"
+#include "core/TimerWheel.h"
+#include "SharedFrame.h"
+#include "FrameCompressor.h"
+#include "OutboundQueue.h"
+
+class UringReactor;
+
+// 连接句柄，由 ConnectionPool 分配（高32位代数 + 低32位槽位）
+using ConnectionId = uint64_t;
+constexpr ConnectionId INVALID_CONNECTION_ID = 0;
+
+// 写合并统计
+struct WriteCoalesceStats {
+    uint64_t frames = 0;          // 暂存的帧数
+    uint64_t flushes = 0;         // 合并写出次数（每次一个 writev）
+    uint64_t bytes = 0;           // 合并写出的字节数
+    uint64_t syscalls_saved = 0;  // 相比逐帧写出节省的系统调用
+    uint64_t packets_saved = 0;   // 按 MSS 估算节省的 TCP 分段
+};
+
+// 输出缓冲区限制，0 表示不限制
+struct OutputLimits {
+    size_t low_watermark = 64 * 1024;      // 低于此值时补发暂存的状态更新
+    size_t high_watermark = 256 * 1024;    // 高于此值时状态更新按实体合并，只保留最新
+    size_t hard_cap = 4 * 1024 * 1024;     // 超过此值断开连接
+};
+
+// 背压统计
+struct BackpressureStats {
+    uint64_t updates_coalesced = 0;  // 被更新的状态替换掉的帧数
+    uint64_t bytes_coalesced = 0;
+    uint64_t frames_dropped = 0;     // 超过硬上限被丢弃的帧数
+    uint64_t bytes_dropped = 0;
+};
 
 class Connection : public std::enable_shared_from_this<Connection> {
+    friend class UringReactor;
+
 public:
     using MessageCallback = std::function<void(const std::shared_ptr<Connection>&, const Message&)>;
     using CloseCallback = std::function<void(const std::shared_ptr<Connection>&)>;
+    // 在复制和解析消息体之前按消息头决定是否接收，返回 false 时丢弃该消息
+    using MessageFilter = std::function<bool(const Connection&, const MessageHeader&)>;
+    // 批次帧中的消息整组交给回调（可移走其中的消息）；未设置时逐条调用 MessageCallback
+    using MessageBatchCallback = std::function<void(const std::shared_ptr<Connection>&, std::vector<Message>&)>;
 
+    // libevent 后端：基于 bufferevent
     Connection(struct bufferevent* bev);
+    // io_uring 后端：收发由 UringReactor 驱动，连接自己持有输入输出 evbuffer
+    Connection(UringReactor* uring, uint64_t uring_key);
     ~Connection();
 
     // 连接管理
     void setMessageCallback(MessageCallback cb) { message_cb_ = cb; }
     void setCloseCallback(CloseCallback cb) { close_cb_ = cb; }
+    void setMessageFilter(MessageFilter filter) { message_filter_ = filter; }
+    void setMessageBatchCallback(MessageBatchCallback cb) { batch_cb_ = cb; }
+    // 被过滤器丢弃的消息数（只在所属 I/O 线程上更新）
+    uint64_t getFilteredCount() const { return filtered_messages_; }
     void close();
     
-    // 消息发送
+    // 消息发送：长度前缀和消息体直接写入输出 evbuffer 预留的空间
     bool sendMessage(const Message& msg);
+    bool sendBody(const void* body, size_t len);
+    bool sendProto(const google::protobuf::MessageLite& proto);
+    // 发送共享帧：只增加引用计数并挂到输出缓冲区，不拷贝数据
+    bool sendFrame(SharedFrame* frame);
+    // 发送可被替换的实体状态更新：输出缓冲区超过高水位后，同一 entity_key
+    // 只保留最新一帧，待缓冲区降到低水位以下再发出
+    bool sendStateUpdate(uint64_t entity_key, SharedFrame* frame);
+    // 把多个普通帧合成批次帧发送，对端需支持 CAPABILITY_BATCH。消息体不拷贝（较小的除外），
+    // 直接引用各共享帧；需要压缩的帧不并入批次，单独发送其共享的压缩版本
+    bool sendBatch(SharedFrame* const* frames, size_t count);
+
+    // 帧压缩：对端声明了 CAPABILITY_COMPRESSION 时，消息体不小于 threshold 字节的出站帧压缩后发送，
+    // 0 表示关闭。压缩在所属 I/O 线程写入输出缓冲区时进行，共享帧的压缩结果缓存复用。入站压缩帧总是接受
+    void setCompressionThreshold(size_t threshold) { compress_threshold_ = threshold; }
+
+    // 输出背压
+    void setOutputLimits(const OutputLimits& limits);
+    const BackpressureStats& getBackpressureStats() const { return backpressure_stats_; }
     
+    // 写合并（可选，仅 libevent 后端）：开启后出站帧先暂存在输出缓冲区，在 flush() 或
+    // flush_interval_ms 到期时用一次 writev 合并写出；io_uring 后端本身按事件循环批量提交发送
+    void enableWriteCoalescing(uint32_t flush_interval_ms);
+    bool isWriteCoalescing() const { return coalesce_; }
+    // 可在任意线程调用（如逻辑帧末尾），其他线程上排在此前转交的帧之后执行
+    void flush();
+    const WriteCoalesceStats& getWriteCoalesceStats() const { return coalesce_stats_; }
+
+    // 空闲超时：挂在所属 reactor 的时间轮上，idle_timeout_ms 内没有任何入站数据则断开。
+    // 每条消息只记录活动时间，到期时若期间有活动则按剩余时间重新挂入
+    void enableIdleTimeout(TimerWheel* wheel, uint32_t idle_timeout_ms);
+    // 记录一次活动，可在其他线程调用（如 UDP 通道）
+    void touch() { last_activity_ms_.store(TimerWheel::nowMs(), std::memory_order_relaxed); }
+
+    // 客户端声明的可选编码（Capability 位掩码），只增不减，可在任意线程调用
+    void addCapabilities(uint32_t caps) { capabilities_.fetch_or(caps, std::memory_order_relaxed); }
+    bool hasCapability(Capability cap) const {
+        return (capabilities_.load(std::memory_order_relaxed) & static_cast<uint32_t>(cap)) != 0;
+    }
+
+    // 绑定所属 I/O 线程的出站队列（需在连接对其他线程可见之前设置）：其他线程上的发送和关闭
+    // 请求先编码成帧，经队列交给所属线程执行，bufferevent 只在所属线程上写入和释放。
+    // TcpServer 总会设置；为空时调用方需自行保证只在一个线程上使用连接
+    void setOutbox(OutboundQueue* outbox) { outbox_ = outbox; }
+
+    // 入站流控（如入站队列已满）：暂停后当前消息处理完即不再拆包，并停止从 socket 读取，
+    // 未处理的数据留在输入缓冲区。可在任意线程调用，在所属线程的下一次读回调中生效
+    void pauseReading() { read_paused_.store(true, std::memory_order_release); }
+    // 恢复读取并处理输入缓冲区中积压的消息，其他线程上经出站队列转交
+    void resumeReading();
+    bool isReadPaused() const { return read_paused_.load(std::memory_order_acquire); }
+
     // 连接信息
-    const std::string& getId() const { return id_; }
-    bool isConnected() const { return connected_; }
+    ConnectionId getId() const { return id_; }
+    void setId(ConnectionId id) { id_ = id; }
+    bool isConnected() const { return connected_.load(std::memory_order_acquire); }
     struct bufferevent* getBev() const { return bev_; }
 
 private:
     void onRead();
     void onError(short events);
-    void handleMessage(const std::vector<uint8_t>& data);
+    // 按消息头过滤并解码一条消息体，被过滤或非法时返回 false。body 位于 owner 中时消息直接引用
+    // 其切片；owner 为空（body 指向输入缓冲区）时通过过滤后复制到 slab
+    bool decodeMessage(const uint8_t* body, size_t len, const BufferSlice* owner, Message& msg);
+    void handleMessage(const uint8_t* body, size_t len, const BufferSlice* owner);
+    // 一次扫描拆出批次帧中的全部消息，整组分发；整个批次只复制一次，各消息为其切片
+    void handleBatch(const uint8_t* body, size_t len, const BufferSlice* owner);
+
+    // 输出缓冲区已部分写出，低于低水位时补发暂存的状态更新
+    void onOutputWritten();
+    // 超过硬上限后在连接所属线程上断开
+    void closeSlowClient();
+    void onIdleTimer();
+
+    // 与后端无关的缓冲区访问
+    struct evbuffer* inputBuffer() const { return bev_ ? bufferevent_get_input(bev_) : input_; }
+    struct evbuffer* outputBuffer() const { return bev_ ? bufferevent_get_output(bev_) : output_; }
+    // 可在任意线程调用：bev_ 只在所属线程上关闭时清空，其他线程只读 connected_
+    bool isOpen() const { return connected_.load(std::memory_order_acquire); }
+
+    // 在输出缓冲区预留一帧的连续空间并写好长度前缀，返回消息体写入位置；
+    // 成功后必须调用 commitFrame 提交（两者之间持有 bufferevent 锁）
+    uint8_t* beginFrame(size_t body_len, struct evbuffer_iovec& vec);
+    bool commitFrame(struct evbuffer_iovec& vec);
+
+    bool wantsCompression(size_t body_len) const {
+        return compress_threshold_ > 0 && body_len >= compress_threshold_ &&
+               hasCapability(Capability::CAPABILITY_COMPRESSION);
+    }
+
+    // 当前线程不是连接所属的 I/O 线程，需经出站队列转交
+    bool needsHandoff() const { return outbox_ && !outbox_->inOwnerThread(); }
+    // 把已编码的帧（转交一个引用）交给所属线程发送
+    bool handoff(SharedFrame* frame, OutboundQueue::Kind kind, uint64_t entity_key = 0);
+
+    // 每帧入队后调用，写合并模式下记录并确保 flush 定时器已启动
+    void onFrameQueued();
+    // 写合并模式下启动 flush 定时器（已启动时不变），调用方持有输出缓冲区锁
+    void armFlushTimer();
+
+    // 把若干普通帧写成一个批次帧（只有一帧或总长度超限时逐帧发送）
+    bool writeBatch(SharedFrame* const* frames, size_t count);
+
+    // 入队前检查硬上限，超过时丢弃该帧并在连接所属线程上断开连接
+    bool admitFrame(size_t frame_len);
+    // 将暂存的状态更新写入输出缓冲区
+    void drainPendingUpdates();
+    static void overflowCallback(evutil_socket_t fd, short events, void* ctx);
     
     static void readCallback(struct bufferevent* bev, void* ctx);
+    static void writeCallback(struct bufferevent* bev, void* ctx);
     static void errorCallback(struct bufferevent* bev, short events, void* ctx);
+    static void flushCallback(evutil_socket_t fd, short events, void* ctx);
 
     struct bufferevent* bev_;
-    std::string id_;
-    bool connected_;
+    UringReactor* uring_;
+    uint64_t uring_key_;
+    struct evbuffer* input_;
+    struct evbuffer* output_;
+    OutboundQueue* outbox_;
+    ConnectionId id_;
+    std::atomic<bool> connected_;
+    std::atomic<bool> read_paused_;
     MessageCallback message_cb_;
     CloseCallback close_cb_;
-    
-    // 消息缓冲区
-    std::vector<uint8_t> read_buffer_;
+    MessageFilter message_filter_;
+    uint64_t filtered_messages_;
+    MessageBatchCallback batch_cb_;
+    std::vector<Message> batch_;   // 复用的批次解码缓冲（只在所属 I/O 线程上使用）
+
+    // 帧压缩（解压上下文只在所属 I/O 线程上使用，首个压缩帧到达时创建）
+    size_t compress_threshold_;
+    std::unique_ptr<FrameCompressor> decompressor_;
+
+    // 写合并
+    bool coalesce_;
+    struct event* flush_event_;
+    struct timeval flush_interval_;
+    size_t pending_frames_;
+    size_t mss_;
+    WriteCoalesceStats coalesce_stats_;
+
+    // 输出背压（受 bufferevent 锁保护）
+    OutputLimits limits_;
+    std::unordered_map<uint64_t, SharedFrame*> pending_updates_;
+    size_t pending_bytes_;
+    bool overflowed_;
+    BackpressureStats backpressure_stats_;
+
+    // 空闲超时（时间轮节点只在所属 reactor 线程上访问）
+    TimerWheel* idle_wheel_;
+    TimerNode idle_timer_;
+    uint32_t idle_timeout_ms_;
+    std::atomic<uint64_t> last_activity_ms_;
+
+    std::atomic<uint32_t> capabilities_;
+
     static constexpr size_t MAX_MESSAGE_SIZE = 1024 * 1024;  // 1MB
+    // 批次中小于该长度的消息体直接拷贝，其余以引用挂入
+    static constexpr size_t BATCH_COPY_THRESHOLD = 256;
 }; 
\ No newline at end of file
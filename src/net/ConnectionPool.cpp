@@ -1,50 +1,128 @@
 #include "ConnectionPool.h"
 #include <spdlog/spdlog.h>
 
+ConnectionPool::ConnectionPool()
+    : snapshot_(std::make_shared<const std::vector<std::shared_ptr<Connection>>>())
+    , version_(0)
+    , snapshot_version_(0) {
+}
+
 ConnectionPool& ConnectionPool::getInstance() {
 static ConnectionPool instance;
 return instance;
 }
 
-void ConnectionPool::addConnection(const std::shared_ptr<Connection>& conn) {
+ConnectionId ConnectionPool::addConnection(const std::shared_ptr<Connection>& conn) {
 if (!conn) {
-    return;
+    return INVALID_CONNECTION_ID;
 }
 
 std::lock_guard<std::mutex> lock(mutex_);
-connections_[conn->getId()] = conn;
+uint32_t slot_index;
+if (!free_slots_.empty()) {
+    slot_index = free_slots_.back();
+    free_slots_.pop_back();
+} else {
+    slot_index = static_cast<uint32_t>(slots_.size());
+    slots_.emplace_back();
+}
+
+Slot& slot = slots_[slot_index];
+slot.dense_index = static_cast<uint32_t>(dense_.size());
+dense_.push_back(conn);
+dense_to_slot_.push_back(slot_index);
+version_.fetch_add(1, std::memory_order_release);
+
+ConnectionId id = (static_cast<uint64_t>(slot.generation) << 32) | slot_index;
+conn->setId(id);
 spdlog::info("New connection added: {}, total connections: {}", 
-                conn->getId(), connections_.size());
+                id, dense_.size());
+return id;
 }
 
-void ConnectionPool::removeConnection(const std::string& id) {
+void ConnectionPool::removeConnection(ConnectionId id) {
 std::lock_guard<std::mutex> lock(mutex_);
-if (connections_.erase(id) > 0) {
-    spdlog::info("Connection removed: {}, total connections: {}", 
-                    id, connections_.size());
+Slot* slot = findSlot(id);
+if (!slot) {
+    return;
+}
+
+// 与紧凑数组末尾交换后弹出
+uint32_t index = slot->dense_index;
+uint32_t last = static_cast<uint32_t>(dense_.size() - 1);
+if (index != last) {
+    dense_[index] = std::move(dense_[last]);
+    dense_to_slot_[index] = dense_to_slot_[last];
+    slots_[dense_to_slot_[index]].dense_index = index;
 }
+dense_.pop_back();
+dense_to_slot_.pop_back();
+version_.fetch_add(1, std::memory_order_release);
+
+// 递增代数使旧句柄失效，跳过0
+slot->dense_index = INVALID_INDEX;
+if (++slot->generation == 0) {
+    slot->generation = 1;
+}
+free_slots_.push_back(static_cast<uint32_t>(id & 0xffffffffu));
+
+spdlog::info("Connection removed: {}, total connections: {}", 
+                id, dense_.size());
 }
 
-std::shared_ptr<Connection> ConnectionPool::getConnection(const std::string& id) {
+std::shared_ptr<Connection> ConnectionPool::getConnection(ConnectionId id) {
 std::lock_guard<std::mutex> lock(mutex_);
-auto it = connections_.find(id);
-if (it != connections_.end()) {
-    return it->second;
+Slot* slot = findSlot(id);
+if (slot) {
+    return dense_[slot->dense_index];
 }
 return nullptr;
 }
 
 std::vector<std::shared_ptr<Connection>> ConnectionPool::getAllConnections() {
 std::lock_guard<std::mutex> lock(mutex_);
-std::vector<std::shared_ptr<Connection>> result;
-result.reserve(connections_.size());
-for (const auto& pair : connections_) {
-    result.push_back(pair.second);
+return dense_;
 }
-return result;
+
+ConnectionPool::Snapshot ConnectionPool::getSnapshot() {
+// 连接池是单例，线程内缓存无需区分实例
+struct Cache {
+    uint64_t version = UINT64_MAX;
+    Snapshot snapshot;
+};
+thread_local Cache cache;
+
+uint64_t version = version_.load(std::memory_order_acquire);
+if (cache.version == version) {
+    return cache.snapshot;
+}
+
+// 版本已变：在锁内取最新快照，过期时先重建
+std::lock_guard<std::mutex> lock(mutex_);
+version = version_.load(std::memory_order_relaxed);
+if (snapshot_version_ != version) {
+    snapshot_ = std::make_shared<const std::vector<std::shared_ptr<Connection>>>(dense_);
+    snapshot_version_ = version;
+}
+cache.version = version;
+cache.snapshot = snapshot_;
+return cache.snapshot;
 }
 
 size_t ConnectionPool::getConnectionCount() const {
 std::lock_guard<std::mutex> lock(mutex_);
-return connections_.size();
-}
\ No newline at end of file
+return dense_.size();
+}
+
+ConnectionPool::Slot* ConnectionPool::findSlot(ConnectionId id) {
+uint32_t index = static_cast<uint32_t>(id & 0xffffffffu);
+uint32_t generation = static_cast<uint32_t>(id >> 32);
+if (index >= slots_.size()) {
+    return nullptr;
+}
+Slot& slot = slots_[index];
+if (slot.generation != generation || slot.dense_index == INVALID_INDEX) {
+    return nullptr;
+}
+return &slot;
+}
@@ -1,37 +1,73 @@
 #pragma once
 
 #include "Connection.h"
-#include <unordered_map>
+#include <vector>
 #include <memory>
 #include <mutex>
+#include <atomic>
 
+/**
+ * @brief 连接池
+ * 
+ * 以 slot map 存储连接：
+ * - ConnectionId 为64位句柄，高32位是代数(generation)，低32位是槽位下标
+ * - 查找只需下标访问并校验代数，无需字符串哈希
+ * - 连接本身保存在紧凑数组中，删除时与末尾交换，便于广播时顺序遍历
+ * - 读者通过 getSnapshot() 获取不可变快照（RCU 风格）：增删连接只递增版本号，
+ *   下一个读者在锁内重建快照；每个线程缓存最近取到的快照及其版本号，
+ *   版本未变时只读一次原子版本号、增加快照本身的一次引用计数，不加锁
+ */
 class ConnectionPool {
 public:
+    using Snapshot = std::shared_ptr<const std::vector<std::shared_ptr<Connection>>>;
+
     static ConnectionPool& getInstance();
 
-    // 添加新连接
-    void addConnection(const std::shared_ptr<Connection>& conn);
+    // 添加新连接，分配并写入连接句柄
+    ConnectionId addConnection(const std::shared_ptr<Connection>& conn);
     
     // 移除连接
-    void removeConnection(const std::string& id);
+    void removeConnection(ConnectionId id);
     
     // 获取连接
-    std::shared_ptr<Connection> getConnection(const std::string& id);
+    std::shared_ptr<Connection> getConnection(ConnectionId id);
     
     // 获取所有连接
     std::vector<std::shared_ptr<Connection>> getAllConnections();
+
+    // 获取所有连接的只读快照，版本未变时直接返回线程内缓存，不加锁。
+    // 缓存的快照持有连接引用，已移除的连接要到该线程下次调用时才会释放
+    Snapshot getSnapshot();
     
     // 获取连接数量
     size_t getConnectionCount() const;
 
 private:
-    ConnectionPool() = default;
+    ConnectionPool();
     ~ConnectionPool() = default;
     
     // 禁止拷贝和赋值
     ConnectionPool(const ConnectionPool&) = delete;
     ConnectionPool& operator=(const ConnectionPool&) = delete;
 
-    std::unordered_map<std::string, std::shared_ptr<Connection>> connections_;
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    struct Slot {
+        uint32_t generation = 1;             // 代数从1开始，保证有效句柄不为0
+        uint32_t dense_index = INVALID_INDEX; // 在紧凑数组中的位置，空闲时为 INVALID_INDEX
+    };
+
+    // 校验句柄并返回槽位，无效时返回 nullptr（需持有锁）
+    Slot* findSlot(ConnectionId id);
+
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_slots_;
+    std::vector<std::shared_ptr<Connection>> dense_;
+    std::vector<uint32_t> dense_to_slot_;
     mutable std::mutex mutex_;
-}; 
\ No newline at end of file
+
+    // 增删连接时在锁内递增；snapshot_ 及其版本只在锁内读写
+    std::atomic<uint64_t> version_;
+    Snapshot snapshot_;
+    uint64_t snapshot_version_;
+};
@@ -0,0 +1,97 @@
+#include "FrameCompressor.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <google/protobuf/io/coded_stream.h>
+
+namespace {
+
+// raw deflate（负的 windowBits），省掉 zlib 头和 adler32 校验，帧长度已由长度前缀保证
+constexpr int WINDOW_BITS = -15;
+constexpr int MEM_LEVEL = 8;
+
+} // namespace
+
+FrameCompressor::FrameCompressor()
+    : deflate_ready_(false), inflate_ready_(false) {
+    std::memset(&deflate_, 0, sizeof(deflate_));
+    std::memset(&inflate_, 0, sizeof(inflate_));
+}
+
+FrameCompressor::~FrameCompressor() {
+    if (deflate_ready_) {
+        deflateEnd(&deflate_);
+    }
+    if (inflate_ready_) {
+        inflateEnd(&inflate_);
+    }
+}
+
+FrameCompressor& FrameCompressor::forThread() {
+    thread_local FrameCompressor compressor;
+    return compressor;
+}
+
+bool FrameCompressor::compress(const uint8_t* body, size_t len, std::string& out) {
+    if (!deflate_ready_) {
+        if (deflateInit2(&deflate_, LEVEL, Z_DEFLATED, WINDOW_BITS, MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+            spdlog::error("Failed to init deflate: {}", deflate_.msg ? deflate_.msg : "");
+            return false;
+        }
+        deflate_ready_ = true;
+    } else {
+        deflateReset(&deflate_);
+    }
+
+    size_t prefix = google::protobuf::io::CodedOutputStream::VarintSize64(len);
+    size_t bound = deflateBound(&deflate_, static_cast<uLong>(len));
+    out.resize(prefix + bound);
+    uint8_t* dst = reinterpret_cast<uint8_t*>(&out[0]);
+    google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(len, dst);
+
+    deflate_.next_in = const_cast<Bytef*>(body);
+    deflate_.avail_in = static_cast<uInt>(len);
+    deflate_.next_out = dst + prefix;
+    deflate_.avail_out = static_cast<uInt>(bound);
+    if (deflate(&deflate_, Z_FINISH) != Z_STREAM_END) {
+        return false;
+    }
+
+    size_t total = prefix + deflate_.total_out;
+    if (total >= len) {
+        return false;
+    }
+    out.resize(total);
+    return true;
+}
+
+bool FrameCompressor::decompress(const uint8_t* body, size_t len, size_t max_len, BufferSlice& out) {
+    google::protobuf::io::CodedInputStream input(body, static_cast<int>(len));
+    uint64_t raw_len = 0;
+    if (!input.ReadVarint64(&raw_len) || raw_len > max_len) {
+        return false;
+    }
+    size_t prefix = static_cast<size_t>(input.CurrentPosition());
+
+    if (!inflate_ready_) {
+        if (inflateInit2(&inflate_, WINDOW_BITS) != Z_OK) {
+            spdlog::error("Failed to init inflate: {}", inflate_.msg ? inflate_.msg : "");
+            return false;
+        }
+        inflate_ready_ = true;
+    } else {
+        inflateReset(&inflate_);
+    }
+
+    // 多留 1 字节，原始长度与声明不符（数据更长）时不会返回 Z_STREAM_END
+    uint8_t* dst = nullptr;
+    BufferSlice buffer = BufferSlice::allocate(static_cast<size_t>(raw_len) + 1, dst);
+    inflate_.next_in = const_cast<Bytef*>(body + prefix);
+    inflate_.avail_in = static_cast<uInt>(len - prefix);
+    inflate_.next_out = dst;
+    inflate_.avail_out = static_cast<uInt>(buffer.size());
+    if (inflate(&inflate_, Z_FINISH) != Z_STREAM_END || inflate_.total_out != raw_len || inflate_.avail_in != 0) {
+        return false;
+    }
+    out = buffer.slice(0, static_cast<size_t>(raw_len));
+    return true;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file FrameCompressor.h
+ * @brief 帧压缩编解码
+ *
+ * 该模块负责：
+ * - 压缩帧的消息体格式：varint 原始长度 + raw deflate 数据（无 zlib 头尾），每帧独立解压
+ * - 压缩和解压的 z_stream 在首次使用时初始化，之后每帧只 reset；压缩输出写入调用方复用的缓冲区，
+ *   解压直接写入从 slab 切出的消息缓冲区
+ * - 压缩后不比原文短时放弃压缩
+ *
+ * 一个实例同一时间只能在一个线程上使用：连接各自持有一个用于解压入站帧，
+ * 共享帧的压缩使用 forThread() 返回的线程内实例。
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <zlib.h>
+#include "proto/MessageBuffer.h"
+
+class FrameCompressor {
+public:
+    FrameCompressor();
+    ~FrameCompressor();
+
+    FrameCompressor(const FrameCompressor&) = delete;
+    FrameCompressor& operator=(const FrameCompressor&) = delete;
+
+    // 压缩消息体写入 out（覆盖原内容），压缩失败或没有收益时返回 false
+    bool compress(const uint8_t* body, size_t len, std::string& out);
+    // 解压压缩帧的消息体到新的缓冲区切片，原始长度超过 max_len 或数据损坏时返回 false
+    bool decompress(const uint8_t* body, size_t len, size_t max_len, BufferSlice& out);
+
+    // 当前线程的实例
+    static FrameCompressor& forThread();
+
+    // 压缩级别：下行以带宽为主但不能拖慢 I/O 线程，取最快一级
+    static constexpr int LEVEL = Z_BEST_SPEED;
+
+private:
+    z_stream deflate_;
+    z_stream inflate_;
+    bool deflate_ready_;
+    bool inflate_ready_;
+};
@@ -0,0 +1,148 @@
+#include "OutboundQueue.h"
+#include "Connection.h"
+#include "SharedFrame.h"
+#include <spdlog/spdlog.h>
+
+OutboundQueue::OutboundQueue(Notify notify, size_t capacity)
+    : ring_(capacity)
+    , notify_(std::move(notify))
+    , notified_(false)
+    , owner_(std::thread::id())
+    , stalls_(0)
+    , overflowed_(false) {
+}
+
+OutboundQueue::~OutboundQueue() {
+    clear();
+}
+
+void OutboundQueue::push(Item&& item) {
+    // 已有请求溢出时后续请求也进入溢出表，保证不越过溢出表中更早的请求
+    if (overflowed_.load(std::memory_order_acquire) || !ring_.tryPush(std::move(item))) {
+        if (stalls_.fetch_add(1, std::memory_order_relaxed) == 0) {
+            spdlog::warn("Outbound queue full ({} requests), buffering until I/O thread catches up", ring_.capacity());
+        }
+        std::lock_guard<std::mutex> lock(overflow_mutex_);
+        overflow_.push_back(std::move(item));
+        overflowed_.store(true, std::memory_order_release);
+    }
+    if (!notified_.exchange(true)) {
+        notify_();
+    }
+}
+
+void OutboundQueue::drain() {
+    // 先清除通知标记：之后入队的请求要么在本轮取到，要么会再次通知
+    notified_.exchange(false);
+
+    Item item;
+    while (ring_.tryPop(item)) {
+        dispatch(std::move(item));
+        item = Item();
+    }
+
+    // 溢出期间环只出不进，环取空后溢出表中的请求都晚于已取出的请求
+    if (overflowed_.load(std::memory_order_acquire)) {
+        {
+            std::lock_guard<std::mutex> lock(overflow_mutex_);
+            overflow_drain_.swap(overflow_);
+            overflowed_.store(false, std::memory_order_release);
+        }
+        for (auto& pending : overflow_drain_) {
+            dispatch(std::move(pending));
+        }
+        overflow_drain_.clear();
+    }
+    flushBatches();
+}
+
+void OutboundQueue::dispatch(Item&& item) {
+    if (item.kind == Kind::FRAME && item.frame->flags() == 0 &&
+        item.conn->hasCapability(Capability::CAPABILITY_BATCH)) {
+        addToBatch(std::move(item));
+        return;
+    }
+
+    flushBatch(item.conn.get());
+    switch (item.kind) {
+    case Kind::FRAME:
+        item.conn->sendFrame(item.frame);
+        break;
+    case Kind::STATE_UPDATE:
+        item.conn->sendStateUpdate(item.entity_key, item.frame);
+        break;
+    case Kind::CLOSE:
+        item.conn->close();
+        break;
+    case Kind::FLUSH:
+        item.conn->flush();
+        break;
+    case Kind::RESUME_READ:
+        item.conn->resumeReading();
+        break;
+    }
+    if (item.frame) {
+        item.frame->release();
+    }
+}
+
+void OutboundQueue::addToBatch(Item&& item) {
+    auto it = batch_index_.find(item.conn.get());
+    if (it == batch_index_.end()) {
+        it = batch_index_.emplace(item.conn.get(), batches_.size()).first;
+        batches_.emplace_back();
+        batches_.back().conn = std::move(item.conn);
+    }
+    PendingBatch& batch = batches_[it->second];
+    if (batch.bytes + item.frame->size() > MAX_BATCH_BYTES) {
+        sendBatch(batch);
+    }
+    batch.frames.push_back(item.frame);
+    batch.bytes += item.frame->size();
+}
+
+void OutboundQueue::sendBatch(PendingBatch& batch) {
+    if (batch.frames.empty()) {
+        return;
+    }
+    batch.conn->sendBatch(batch.frames.data(), batch.frames.size());
+    for (SharedFrame* frame : batch.frames) {
+        frame->release();
+    }
+    batch.frames.clear();
+    batch.bytes = 0;
+}
+
+void OutboundQueue::flushBatch(Connection* conn) {
+    auto it = batch_index_.find(conn);
+    if (it != batch_index_.end()) {
+        sendBatch(batches_[it->second]);
+    }
+}
+
+void OutboundQueue::flushBatches() {
+    for (auto& batch : batches_) {
+        sendBatch(batch);
+    }
+    batches_.clear();
+    batch_index_.clear();
+}
+
+void OutboundQueue::clear() {
+    Item item;
+    while (ring_.tryPop(item)) {
+        if (item.frame) {
+            item.frame->release();
+        }
+        item = Item();
+    }
+
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    for (auto& pending : overflow_) {
+        if (pending.frame) {
+            pending.frame->release();
+        }
+    }
+    overflow_.clear();
+    overflowed_.store(false, std::memory_order_release);
+}
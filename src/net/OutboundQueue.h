@@ -0,0 +1,109 @@
+/**
+ * @file OutboundQueue.h
+ * @brief 发往某个 I/O 线程的出站队列
+ *
+ * 该模块负责：
+ * - 其他线程（逻辑线程、其他 reactor）对连接的发送和关闭请求先编码成 SharedFrame，
+ *   经无锁 MPSC 环交给连接所属的 I/O 线程，由它写入输出缓冲区
+ * - 队列由空变为非空时才通知 I/O 线程，一批请求只唤醒一次
+ * - 环满时调用方不等待：请求暂存到受锁保护的溢出表，I/O 线程取空环后再按顺序处理；
+ *   溢出表非空期间新请求也进入溢出表，保证同一线程发往同一连接的请求不乱序
+ * - 对支持批次帧的连接，一轮处理中发给它的普通帧合成一个批次帧写出
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "core/MpscRing.h"
+
+class Connection;
+class SharedFrame;
+
+class OutboundQueue {
+public:
+    enum class Kind : uint8_t {
+        FRAME,          // Connection::sendFrame
+        STATE_UPDATE,   // Connection::sendStateUpdate
+        CLOSE,          // Connection::close
+        FLUSH,          // Connection::flush
+        RESUME_READ     // Connection::resumeReading
+    };
+
+    struct Item {
+        std::shared_ptr<Connection> conn;
+        SharedFrame* frame = nullptr;   // 持有一个引用
+        uint64_t entity_key = 0;
+        Kind kind = Kind::FRAME;
+    };
+
+    // 通知 I/O 线程有待处理的请求，可在任意线程调用
+    using Notify = std::function<void()>;
+
+    explicit OutboundQueue(Notify notify, size_t capacity = DEFAULT_CAPACITY);
+    ~OutboundQueue();
+
+    OutboundQueue(const OutboundQueue&) = delete;
+    OutboundQueue& operator=(const OutboundQueue&) = delete;
+
+    // 由 I/O 线程在进入事件循环前调用；未绑定时任何线程都视为所属线程（直接发送）
+    void bindToCurrentThread() { owner_.store(std::this_thread::get_id(), std::memory_order_release); }
+    void unbind() { owner_.store(std::thread::id(), std::memory_order_release); }
+    bool inOwnerThread() const {
+        std::thread::id owner = owner_.load(std::memory_order_acquire);
+        return owner == std::thread::id() || owner == std::this_thread::get_id();
+    }
+
+    // 任意线程调用，从不阻塞等待 I/O 线程；环满时暂存到溢出表
+    void push(Item&& item);
+
+    // 在所属线程上执行所有待处理的请求
+    void drain();
+    // 丢弃所有待处理的请求（I/O 线程已退出时）
+    void clear();
+
+    // 因环满而暂存到溢出表的请求数
+    uint64_t getStallCount() const { return stalls_.load(std::memory_order_relaxed); }
+
+private:
+    // 一轮 drain 中发往同一连接、待合并的帧
+    struct PendingBatch {
+        std::shared_ptr<Connection> conn;
+        std::vector<SharedFrame*> frames;   // 各持有一个引用
+        size_t bytes = 0;
+    };
+
+    // 执行一个请求并释放它持有的帧引用
+    void dispatch(Item&& item);
+    void addToBatch(Item&& item);
+    void sendBatch(PendingBatch& batch);
+    // 先发出该连接已攒下的帧，保证与之后的请求不乱序
+    void flushBatch(Connection* conn);
+    void flushBatches();
+
+    MpscRing<Item> ring_;
+    Notify notify_;
+    std::atomic<bool> notified_;
+    std::atomic<std::thread::id> owner_;
+    std::atomic<uint64_t> stalls_;
+    // 溢出表只在环满后使用；overflowed_ 为 true 期间所有请求都进入溢出表
+    std::mutex overflow_mutex_;
+    std::vector<Item> overflow_;
+    std::atomic<bool> overflowed_;
+    std::vector<Item> overflow_drain_;  // 只在所属线程上使用，复用容量
+    std::vector<PendingBatch> batches_;
+    std::unordered_map<Connection*, size_t> batch_index_;
+
+    static constexpr size_t DEFAULT_CAPACITY = 16 * 1024;
+    // 单个批次帧的消息体上限，超过后先发出已攒的部分
+    static constexpr size_t MAX_BATCH_BYTES = 64 * 1024;
+};
@@ -0,0 +1,86 @@
+#include "SharedFrame.h"
+#include "FrameCompressor.h"
+#include "proto/Message.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <arpa/inet.h>  // for htonl
+
+// 最大消息大小限制（10MB）
+constexpr size_t MAX_MESSAGE_SIZE = 10 * 1024 * 1024;
+
+SharedFrame::SharedFrame(size_t body_len, uint32_t flags)
+    : refs_(1)
+    , data_(new uint8_t[sizeof(uint32_t) + body_len])
+    , size_(sizeof(uint32_t) + body_len)
+    , compressed_(nullptr) {
+    // 先写4字节body长度和标志位（网络字节序）
+    uint32_t net_len = htonl(static_cast<uint32_t>(body_len) | flags);
+    std::memcpy(data_.get(), &net_len, sizeof(net_len));
+}
+
+SharedFrame::~SharedFrame() {
+    SharedFrame* compressed = compressed_.load(std::memory_order_relaxed);
+    if (compressed && compressed != this) {
+        compressed->release();
+    }
+}
+
+SharedFrame* SharedFrame::fromBody(const void* body, size_t len) {
+    if (len > MAX_MESSAGE_SIZE) {
+        spdlog::error("Message body too large: {} bytes (max: {})", len, MAX_MESSAGE_SIZE);
+        return nullptr;
+    }
+
+    auto frame = new SharedFrame(len);
+    if (len > 0) {
+        std::memcpy(frame->body(), body, len);
+    }
+    return frame;
+}
+
+SharedFrame* SharedFrame::fromProto(const google::protobuf::MessageLite& proto) {
+    size_t len = proto.ByteSizeLong();
+    if (len > MAX_MESSAGE_SIZE) {
+        spdlog::error("Message body too large: {} bytes (max: {})", len, MAX_MESSAGE_SIZE);
+        return nullptr;
+    }
+
+    auto frame = new SharedFrame(len);
+    proto.SerializeWithCachedSizesToArray(frame->body());
+    return frame;
+}
+
+uint32_t SharedFrame::flags() const {
+    uint32_t net_len = 0;
+    std::memcpy(&net_len, data_.get(), sizeof(net_len));
+    return ntohl(net_len) & FRAME_FLAGS_MASK;
+}
+
+SharedFrame* SharedFrame::compressed() {
+    SharedFrame* existing = compressed_.load(std::memory_order_acquire);
+    if (existing) {
+        return existing;
+    }
+
+    // 压缩输出先写入线程内复用的缓冲区，只为结果分配一次帧
+    thread_local std::string scratch;
+    SharedFrame* result = this;
+    if (!(flags() & FRAME_FLAG_COMPRESSED) &&
+        FrameCompressor::forThread().compress(data() + sizeof(uint32_t), size_ - sizeof(uint32_t), scratch)) {
+        result = new SharedFrame(scratch.size(), flags() | FRAME_FLAG_COMPRESSED);
+        std::memcpy(result->body(), scratch.data(), scratch.size());
+    }
+
+    // 多个线程同时压缩时只保留第一个结果
+    if (!compressed_.compare_exchange_strong(existing, result, std::memory_order_acq_rel)) {
+        if (result != this) {
+            result->release();
+        }
+        return existing;
+    }
+    return result;
+}
+
+void SharedFrame::releaseCallback(const void* data, size_t len, void* extra) {
+    static_cast<SharedFrame*>(extra)->release();
+}
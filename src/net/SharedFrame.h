@@ -0,0 +1,61 @@
+/**
+ * @file SharedFrame.h
+ * @brief 引用计数的只读消息帧
+ * 
+ * 该模块负责：
+ * - 将消息（长度前缀+消息体）只编码一次
+ * - 通过 evbuffer_add_reference 挂到多个连接的输出缓冲区，不再逐连接拷贝
+ * - 最后一个引用释放时回收内存
+ * - 按需生成并缓存压缩版本，广播给多个连接时只压缩一次
+ * 
+ * @author Nevermore1102
+ * @date 2025-06-09
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <google/protobuf/message_lite.h>
+
+class SharedFrame {
+public:
+    // 编码一帧，引用计数初始为1，失败返回 nullptr
+    static SharedFrame* fromBody(const void* body, size_t len);
+    static SharedFrame* fromProto(const google::protobuf::MessageLite& proto);
+
+    void retain() { refs_.fetch_add(1, std::memory_order_relaxed); }
+    void release() {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    const uint8_t* data() const { return data_.get(); }
+    size_t size() const { return size_; }
+    // 长度前缀中的标志位（FRAME_FLAGS_MASK 部分）
+    uint32_t flags() const;
+
+    // 压缩版本（带 FRAME_FLAG_COMPRESSED），首次调用时生成并由本帧持有；没有压缩收益时返回本帧。
+    // 可在多个线程上并发调用
+    SharedFrame* compressed();
+
+    // evbuffer_add_reference 的释放回调，extra 为 SharedFrame*
+    static void releaseCallback(const void* data, size_t len, void* extra);
+
+private:
+    explicit SharedFrame(size_t body_len, uint32_t flags = 0);
+    ~SharedFrame();
+
+    SharedFrame(const SharedFrame&) = delete;
+    SharedFrame& operator=(const SharedFrame&) = delete;
+
+    uint8_t* body() { return data_.get() + sizeof(uint32_t); }
+
+    std::atomic<int> refs_;
+    std::unique_ptr<uint8_t[]> data_;
+    size_t size_;
+    std::atomic<SharedFrame*> compressed_;   // 为空表示尚未尝试压缩
+};
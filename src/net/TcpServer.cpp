@@ -9,9 +9,14 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 
-TcpServer::TcpServer(const std::string& host, uint16_t port)
-    : base_(nullptr)
-    , listener_(nullptr)
+TcpServer::TcpServer(EventLoop& loop, const std::string& host, uint16_t port)
+    : loop_(loop)
+    , reactor_count_(1)
+    , dedicated_io_threads_(false)
+    , backend_(Backend::LIBEVENT)
+    , coalesce_interval_ms_(0)
+    , idle_timeout_ms_(0)
+    , compress_threshold_(DEFAULT_COMPRESSION_THRESHOLD)
     , host_(host)
     , port_(port)
     , running_(false) {
@@ -25,15 +30,144 @@ bool TcpServer::start() {
     if (running_) {
         return true;
     }
-
-    // 创建事件基础
-    base_ = event_base_new();
-    if (!base_) {
-        spdlog::error("Failed to create event base");
+    if (!loop_.getBase()) {
+        spdlog::error("TcpServer requires an initialized event loop");
         return false;
     }
 
-    // 创建监听器
+    // 其他线程经出站队列唤醒 reactor（event_active），需开启 libevent 线程支持
+    EventLoop::enableThreading();
+
+    if (!createReactors()) {
+        if (backend_ != Backend::IO_URING) {
+            return false;
+        }
+        // 内核不支持或被禁用（如容器 seccomp）时回退到 libevent
+        spdlog::warn("io_uring backend unavailable, falling back to libevent");
+        backend_ = Backend::LIBEVENT;
+        if (!createReactors()) {
+            return false;
+        }
+    }
+
+    // 挂在共享循环上的 reactor 随 loop 运行，其余各占一个线程
+    running_ = true;
+    for (auto& reactor : reactors_) {
+        if (reactor->loop == &loop_) {
+            // 出站队列在循环线程上绑定之后才开始接受连接
+            loop_.post([this]() { bindSharedReactor(); });
+            continue;
+        }
+        Reactor* ctx = reactor.get();
+        reactor->thread = std::thread([ctx]() {
+            runReactor(*ctx);
+        });
+    }
+
+    spdlog::info("Server started on {}:{} with {} reactor(s), backend: {}{}", host_, port_, reactor_count_,
+                 backend_ == Backend::IO_URING ? "io_uring" : "libevent",
+                 dedicated_io_threads_ ? ", dedicated I/O threads" : "");
+    return true;
+}
+
+void TcpServer::runReactor(Reactor& reactor) {
+    if (reactor.outbox) {
+        reactor.outbox->bindToCurrentThread();
+    }
+    if (reactor.uring) {
+        reactor.uring->run();
+    } else {
+        event_base_dispatch(reactor.base);
+    }
+}
+
+void TcpServer::bindSharedReactor() {
+    // 投递后服务器可能已停止
+    if (!running_ || reactors_.empty() || reactors_[0]->loop != &loop_) {
+        return;
+    }
+    Reactor& reactor = *reactors_[0];
+    reactor.outbox->bindToCurrentThread();
+    evconnlistener_enable(reactor.listener);
+}
+
+TimerWheel* TcpServer::getTimerWheel(Reactor& reactor) {
+    if (reactor.uring) {
+        return reactor.uring->getTimerWheel();
+    }
+    return reactor.loop ? reactor.loop->getTimerWheel() : nullptr;
+}
+
+void TcpServer::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    // 先停掉工作线程，之后所有连接都只会被当前线程访问
+    for (auto& reactor : reactors_) {
+        if (reactor->uring) {
+            reactor->uring->stop();
+        } else if (reactor->loop != &loop_) {
+            event_base_loopbreak(reactor->base);
+        }
+    }
+    for (auto& reactor : reactors_) {
+        if (reactor->thread.joinable()) {
+            reactor->thread.join();
+        }
+        // I/O 线程已退出，之后的发送和关闭都在当前线程直接执行
+        if (reactor->outbox) {
+            reactor->outbox->unbind();
+            reactor->outbox->clear();
+        }
+    }
+
+    for (const auto& stats : getReactorStats()) {
+        spdlog::info("Reactor {} accepted {} connection(s), {} still open", stats.index, stats.accepted, stats.active);
+    }
+    closeConnections();
+    destroyReactors();
+
+    spdlog::info("Server stopped");
+}
+
+std::vector<TcpServer::ReactorStats> TcpServer::getReactorStats() const {
+    std::vector<ReactorStats> result;
+    result.reserve(reactors_.size());
+    for (const auto& reactor : reactors_) {
+        ReactorStats stats;
+        stats.index = reactor->index;
+        stats.accepted = reactor->accepted.load(std::memory_order_relaxed);
+        stats.active = reactor->active.load(std::memory_order_relaxed);
+        result.push_back(stats);
+    }
+    return result;
+}
+
+void TcpServer::closeConnections() {
+    // 关闭回调会修改连接池，先取快照；io_uring 连接的 socket 在 reactor 销毁时关闭
+    auto snapshot = ConnectionPool::getInstance().getSnapshot();
+    for (const auto& conn : *snapshot) {
+        conn->close();
+    }
+}
+
+bool TcpServer::createReactors() {
+    for (size_t i = 0; i < reactor_count_; ++i) {
+        if (!createReactor(i)) {
+            destroyReactors();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TcpServer::createReactor(size_t index) {
+    auto reactor = std::make_unique<Reactor>();
+    reactor->server = this;
+    reactor->index = index;
+
+    // 监听地址
     struct sockaddr_in sin;
     memset(&sin, 0, sizeof(sin));
     sin.sin_family = AF_INET;
@@ -44,56 +178,178 @@ bool TcpServer::start() {
         inet_pton(AF_INET, host_.c_str(), &sin.sin_addr);
     }
 
-    listener_ = evconnlistener_new_bind(base_,
-                                      acceptCallback,
-                                      this,
-                                      LEV_OPT_CLOSE_ON_FREE | LEV_OPT_REUSEABLE,
-                                      -1,
-                                      (struct sockaddr*)&sin,
-                                      sizeof(sin));
+    if (backend_ == Backend::IO_URING) {
+        if (!createUringReactor(*reactor, sin) || !createOutbox(*reactor)) {
+            return false;
+        }
+        reactors_.push_back(std::move(reactor));
+        return true;
+    }
+
+    // reactor 0 使用共享事件循环（独立 I/O 线程模式除外），其余 reactor 创建自己的
+    if (index == 0 && !dedicated_io_threads_) {
+        reactor->loop = &loop_;
+    } else {
+        reactor->owned_loop = std::make_unique<EventLoop>();
+        if (!reactor->owned_loop->init()) {
+            spdlog::error("Failed to create event base for reactor {}", index);
+            return false;
+        }
+        reactor->loop = reactor->owned_loop.get();
+    }
+    reactor->base = reactor->loop->getBase();
+    if (idle_timeout_ms_ > 0) {
+        if (!reactor->loop->enableTimerWheel(TIMER_WHEEL_TICK_MS)) {
+            return false;
+        }
+        reactor->loop->getTimerWheel()->setExpireBudget(IDLE_REAP_BATCH);
+    }
+
+    // 多个 reactor 各自绑定同一端口，由内核通过 SO_REUSEPORT 分发新连接
+    unsigned flags = LEV_OPT_CLOSE_ON_FREE | LEV_OPT_REUSEABLE;
+    if (reactor_count_ > 1) {
+        flags |= LEV_OPT_REUSEABLE_PORT | LEV_OPT_THREADSAFE;
+    }
+    // 共享循环上的 reactor 由 bindSharedReactor() 开始接受连接
+    if (reactor->loop == &loop_) {
+        flags |= LEV_OPT_DISABLED;
+    }
+
+    reactor->listener = evconnlistener_new_bind(reactor->base,
+                                              acceptCallback,
+                                              reactor.get(),
+                                              flags,
+                                              -1,
+                                              (struct sockaddr*)&sin,
+                                              sizeof(sin));
 
-    if (!listener_) {
-        spdlog::error("Failed to create listener");
-        event_base_free(base_);
-        base_ = nullptr;
+    if (!reactor->listener) {
+        spdlog::error("Failed to create listener for reactor {}", index);
         return false;
     }
 
-    evconnlistener_set_error_cb(listener_, acceptErrorCallback);
+    evconnlistener_set_error_cb(reactor->listener, acceptErrorCallback);
 
-    // 启动事件循环
-    running_ = true;
-    spdlog::info("Server started on {}:{}", host_, port_);
-    event_base_dispatch(base_);
+    // 连接只在所属 reactor 线程上写入和关闭，其他线程的请求一律经出站队列转交
+    if (!createOutbox(*reactor)) {
+        return false;
+    }
 
+    reactors_.push_back(std::move(reactor));
     return true;
 }
 
-void TcpServer::stop() {
-    if (!running_) {
-        return;
+bool TcpServer::createUringReactor(Reactor& reactor, const struct sockaddr_in& sin) {
+    auto uring = std::make_unique<UringReactor>(reactor.index);
+    if (!uring->init(sin, reactor_count_ > 1)) {
+        spdlog::error("Failed to create io_uring reactor {}", reactor.index);
+        return false;
     }
+    if (idle_timeout_ms_ > 0) {
+        uring->enableTimerWheel(TIMER_WHEEL_TICK_MS);
+        uring->getTimerWheel()->setExpireBudget(IDLE_REAP_BATCH);
+    }
+
+    Reactor* ctx = &reactor;
+    uring->setAcceptCallback([this, ctx](const std::shared_ptr<Connection>& conn, const struct sockaddr_in& addr) {
+        setupConnection(*ctx, conn, addr);
+    });
+    reactor.uring = std::move(uring);
+    return true;
+}
 
-    running_ = false;
+bool TcpServer::createOutbox(Reactor& reactor) {
+    if (reactor.uring) {
+        // io_uring reactor 通过任务队列唤醒，每批请求只投递一次
+        Reactor* ctx = &reactor;
+        reactor.outbox = std::make_unique<OutboundQueue>([ctx]() {
+            ctx->uring->post([ctx]() { ctx->outbox->drain(); });
+        });
+        return true;
+    }
 
-    if (listener_) {
-        evconnlistener_free(listener_);
-        listener_ = nullptr;
+    reactor.outbox_event = event_new(reactor.base, -1, 0, outboxCallback, &reactor);
+    if (!reactor.outbox_event) {
+        spdlog::error("Failed to create outbox event for reactor {}", reactor.index);
+        return false;
     }
+    struct event* ev = reactor.outbox_event;
+    reactor.outbox = std::make_unique<OutboundQueue>([ev]() {
+        event_active(ev, EV_TIMEOUT, 0);
+    });
+    return true;
+}
+
+void TcpServer::outboxCallback(evutil_socket_t fd, short events, void* ctx) {
+    static_cast<Reactor*>(ctx)->outbox->drain();
+}
 
-    if (base_) {
-        event_base_loopbreak(base_);
-        event_base_free(base_);
-        base_ = nullptr;
+TcpServer::Reactor::~Reactor() {
+    // 先释放 io_uring reactor，其上的连接会在这里关闭
+    uring.reset();
+    outbox.reset();
+    if (outbox_event) {
+        event_free(outbox_event);
+        outbox_event = nullptr;
     }
+    if (listener) {
+        evconnlistener_free(listener);
+        listener = nullptr;
+    }
+    owned_loop.reset();
+    loop = nullptr;
+    base = nullptr;
+}
 
-    spdlog::info("Server stopped");
+void TcpServer::destroyReactors() {
+    reactors_.clear();
 }
 
 void TcpServer::broadcast(const Message& msg) {
-    auto connections = ConnectionPool::getInstance().getAllConnections();
-    for (const auto& conn : connections) {
-        conn->sendMessage(msg);
+    const auto& body = msg.getBody();
+    SharedFrame* frame = SharedFrame::fromBody(body.data(), body.size());
+    if (!frame) {
+        return;
+    }
+    multicast(*ConnectionPool::getInstance().getSnapshot(), frame);
+    frame->release();
+}
+
+void TcpServer::broadcastProto(const google::protobuf::MessageLite& proto) {
+    SharedFrame* frame = SharedFrame::fromProto(proto);
+    if (!frame) {
+        return;
+    }
+    multicast(*ConnectionPool::getInstance().getSnapshot(), frame);
+    frame->release();
+}
+
+void TcpServer::broadcastStateUpdate(uint64_t entity_key, const google::protobuf::MessageLite& proto) {
+    SharedFrame* frame = SharedFrame::fromProto(proto);
+    if (!frame) {
+        return;
+    }
+    auto snapshot = ConnectionPool::getInstance().getSnapshot();
+    for (const auto& conn : *snapshot) {
+        conn->sendStateUpdate(entity_key, frame);
+    }
+    frame->release();
+}
+
+void TcpServer::flushWrites() {
+    if (coalesce_interval_ms_ == 0) {
+        return;
+    }
+    // 其他 reactor 上的连接经出站队列转交，排在本帧已转交的帧之后
+    auto snapshot = ConnectionPool::getInstance().getSnapshot();
+    for (const auto& conn : *snapshot) {
+        conn->flush();
+    }
+}
+
+void TcpServer::multicast(const std::vector<std::shared_ptr<Connection>>& targets, SharedFrame* frame) {
+    for (const auto& conn : targets) {
+        conn->sendFrame(frame);
     }
 }
 
@@ -102,18 +358,18 @@ void TcpServer::acceptCallback(struct evconnlistener* listener,
                              struct sockaddr* addr,
                              int socklen,
                              void* ctx) {
-    auto server = static_cast<TcpServer*>(ctx);
-    server->onAccept(fd, addr);
+    auto reactor = static_cast<Reactor*>(ctx);
+    reactor->server->onAccept(*reactor, fd, addr);
 }
 
 void TcpServer::acceptErrorCallback(struct evconnlistener* listener, void* ctx) {
-    auto server = static_cast<TcpServer*>(ctx);
-    server->onAcceptError();
+    auto reactor = static_cast<Reactor*>(ctx);
+    reactor->server->onAcceptError(*reactor);
 }
 
-void TcpServer::onAccept(evutil_socket_t fd, struct sockaddr* addr) {
-    // 创建新的 bufferevent
-    struct bufferevent* bev = bufferevent_socket_new(base_, fd, BEV_OPT_CLOSE_ON_FREE);
+void TcpServer::onAccept(Reactor& reactor, evutil_socket_t fd, struct sockaddr* addr) {
+    // 创建新的 bufferevent，连接绑定在接受它的 reactor 上
+    struct bufferevent* bev = bufferevent_socket_new(reactor.base, fd, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_THREADSAFE);
     if (!bev) {
         spdlog::error("Failed to create bufferevent");
         return;
@@ -121,19 +377,46 @@ void TcpServer::onAccept(evutil_socket_t fd, struct sockaddr* addr) {
 
     // 创建新的连接
     auto conn = std::make_shared<Connection>(bev);
-    
+    setupConnection(reactor, conn, *reinterpret_cast<struct sockaddr_in*>(addr));
+}
+
+void TcpServer::setupConnection(Reactor& reactor, const std::shared_ptr<Connection>& conn,
+                                const struct sockaddr_in& addr) {
+    conn->setOutbox(reactor.outbox.get());
+    conn->setOutputLimits(output_limits_);
+    conn->setCompressionThreshold(compress_threshold_);
+    if (coalesce_interval_ms_ > 0) {
+        conn->enableWriteCoalescing(coalesce_interval_ms_);
+    }
+    if (idle_timeout_ms_ > 0) {
+        conn->enableIdleTimeout(getTimerWheel(reactor), idle_timeout_ms_);
+    }
+
     // 设置消息回调
     if (message_cb_) {
         conn->setMessageCallback(message_cb_);
     }
+    if (message_filter_) {
+        conn->setMessageFilter(message_filter_);
+    }
+    if (batch_cb_) {
+        conn->setMessageBatchCallback(batch_cb_);
+    }
 
     // 设置关闭回调
-    conn->setCloseCallback([this](const std::shared_ptr<Connection>& conn) {
+    Reactor* owner = &reactor;
+    conn->setCloseCallback([this, owner](const std::shared_ptr<Connection>& conn) {
+        owner->active.fetch_sub(1, std::memory_order_relaxed);
         ConnectionPool::getInstance().removeConnection(conn->getId());
+        if (close_cb_) {
+            close_cb_(conn);
+        }
     });
 
     // 添加到连接池
     ConnectionPool::getInstance().addConnection(conn);
+    reactor.accepted.fetch_add(1, std::memory_order_relaxed);
+    reactor.active.fetch_add(1, std::memory_order_relaxed);
 
     // 通知新连接
     if (new_conn_cb_) {
@@ -142,12 +425,11 @@ void TcpServer::onAccept(evutil_socket_t fd, struct sockaddr* addr) {
 
     // 获取客户端地址
     char client_addr[INET_ADDRSTRLEN];
-    struct sockaddr_in* client_sin = (struct sockaddr_in*)addr;
-    inet_ntop(AF_INET, &client_sin->sin_addr, client_addr, sizeof(client_addr));
-    spdlog::info("New connection from {}:{}", client_addr, ntohs(client_sin->sin_port));
+    inet_ntop(AF_INET, &addr.sin_addr, client_addr, sizeof(client_addr));
+    spdlog::info("New connection from {}:{} on reactor {}", client_addr, ntohs(addr.sin_port), reactor.index);
 }
 
-void TcpServer::onAcceptError() {
+void TcpServer::onAcceptError(Reactor& reactor) {
     int err = EVUTIL_SOCKET_ERROR();
-    spdlog::error("Accept error: {}", evutil_socket_error_to_string(err));
+    spdlog::error("Accept error on reactor {}: {}", reactor.index, evutil_socket_error_to_string(err));
 } 
\ No newline at end of file
@@ -7,6 +7,15 @@
  * - 管理客户端连接的生命周期
  * - 处理数据的收发
  * - 提供回调机制处理连接事件
+ * - 多 reactor 模式：每个 reactor 持有独立的事件循环和 SO_REUSEPORT 监听器，
+ *   连接始终留在接受它的 reactor 上；reactor 0 直接挂在外部传入的 EventLoop 上，
+ *   与定时器、信号等共用同一个循环，其余 reactor 各占一个线程
+ * - 连接只在所属 reactor 的线程上写入和关闭：其他线程（其他 reactor 的广播、逻辑线程）的
+ *   发送和关闭请求经每个 reactor 的无锁出站队列转交给所属线程
+ * - 独立 I/O 线程模式：所有 reactor 都运行在自己的线程上，外部 EventLoop 只运行游戏逻辑
+ * - 可选 io_uring 后端（Linux），不可用时自动回退到 libevent
+ * - 每个 reactor 一个时间轮，回收长时间无活动的连接
+ * - 对声明了 CAPABILITY_COMPRESSION 的连接压缩超过阈值的出站帧
  * 
  * @author Nevermore1102
  * @date 2025-05-05
@@ -16,47 +25,161 @@
 
 #include <event2/listener.h>
 #include <event2/event.h>
+#include <atomic>
 #include <string>
 #include <memory>
 #include <functional>
+#include <thread>
+#include <vector>
 #include "Connection.h"
+#include "UringReactor.h"
+#include "core/EventLoop.h"
 
 class TcpServer {
 public:
+    // 网络 I/O 后端
+    enum class Backend {
+        LIBEVENT,
+        IO_URING
+    };
+
     using MessageCallback = Connection::MessageCallback;
     using NewConnectionCallback = std::function<void(const std::shared_ptr<Connection>&)>;
+    using CloseCallback = Connection::CloseCallback;
+
+    // 每个 reactor 的连接统计
+    struct ReactorStats {
+        size_t index = 0;
+        uint64_t accepted = 0;      // 累计接受的连接数
+        uint64_t active = 0;        // 当前连接数
+    };
 
-    TcpServer(const std::string& host, uint16_t port);
+    // loop 需先 init()，生命周期长于 TcpServer
+    TcpServer(EventLoop& loop, const std::string& host, uint16_t port);
     ~TcpServer();
 
-    // 启动和停止服务器
+    // 启动和停止服务器，start() 不阻塞：reactor 0 随 loop 运行，其余 reactor 各自占用一个工作线程
+    // （io_uring 后端的 reactor 自带轮询，全部运行在工作线程上）。
+    // stop() 需在 loop 所在线程调用（或 loop 未运行时），会等待工作线程退出并关闭所有连接
     bool start();
     void stop();
+    bool isRunning() const { return running_; }
+
+    // 设置 reactor 数量（需在 start() 之前调用），默认 1 即单线程模式
+    void setReactorCount(size_t count) { reactor_count_ = count > 0 ? count : 1; }
+    size_t getReactorCount() const { return reactor_count_; }
+
+    // 独立 I/O 线程模式（需在 start() 之前调用），默认关闭
+    void setDedicatedIoThreads(bool enabled) { dedicated_io_threads_ = enabled; }
+    bool hasDedicatedIoThreads() const { return dedicated_io_threads_; }
+
+    // 选择 I/O 后端（需在 start() 之前调用），默认 libevent
+    void setBackend(Backend backend) { backend_ = backend; }
+    Backend getBackend() const { return backend_; }
+
+    // 为新连接开启写合并，flush_interval_ms 为 0 时关闭（默认）
+    void setWriteCoalescing(uint32_t flush_interval_ms) { coalesce_interval_ms_ = flush_interval_ms; }
+    // 立即写出所有连接暂存的帧（逻辑帧末尾调用，flush_interval_ms 只作兜底），未开启写合并时不做任何事
+    void flushWrites();
+
+    // 新连接的输出缓冲区水位和硬上限
+    void setOutputLimits(const OutputLimits& limits) { output_limits_ = limits; }
+
+    // 新连接的压缩阈值（消息体字节数），0 表示不压缩；只对声明了 CAPABILITY_COMPRESSION 的连接生效
+    void setCompressionThreshold(size_t threshold) { compress_threshold_ = threshold; }
+
+    // 空闲超时（需在 start() 之前调用）：超过 idle_timeout_ms 未收到数据的连接会被断开，0 表示关闭（默认）
+    void setIdleTimeout(uint32_t idle_timeout_ms) { idle_timeout_ms_ = idle_timeout_ms; }
 
     // 设置回调
     void setMessageCallback(MessageCallback cb) { message_cb_ = cb; }
     void setNewConnectionCallback(NewConnectionCallback cb) { new_conn_cb_ = cb; }
+    void setCloseCallback(CloseCallback cb) { close_cb_ = cb; }
+    // 新连接的消息过滤器，在 I/O 线程上按消息头调用
+    void setMessageFilter(Connection::MessageFilter filter) { message_filter_ = filter; }
+    // 批次帧中的消息整组交给该回调，未设置时逐条调用消息回调
+    void setMessageBatchCallback(Connection::MessageBatchCallback cb) { batch_cb_ = cb; }
 
-    // 广播消息给所有连接
+    // 广播消息给所有连接：只编码一次，各连接共享同一帧
     void broadcast(const Message& msg);
+    void broadcastProto(const google::protobuf::MessageLite& proto);
+    // 广播实体状态更新，慢客户端上同一实体的旧状态会被替换
+    void broadcastStateUpdate(uint64_t entity_key, const google::protobuf::MessageLite& proto);
+
+    // 将同一帧发送给指定的一组连接
+    static void multicast(const std::vector<std::shared_ptr<Connection>>& targets, SharedFrame* frame);
+
+    // 各 reactor 的连接统计，需在 loop 所在线程调用
+    std::vector<ReactorStats> getReactorStats() const;
 
 private:
+    // 每个 reactor 拥有自己的事件循环和监听 socket
+    struct Reactor {
+        TcpServer* server = nullptr;
+        size_t index = 0;
+        EventLoop* loop = nullptr;             // 共享循环或 owned_loop
+        std::unique_ptr<EventLoop> owned_loop; // 运行在工作线程上的 reactor 独占的循环
+        struct event_base* base = nullptr;     // loop->getBase()
+        struct evconnlistener* listener = nullptr;
+        std::unique_ptr<UringReactor> uring;   // io_uring 后端时使用，替代 base/listener
+        std::unique_ptr<OutboundQueue> outbox; // 其他线程对本 reactor 上连接的发送和关闭请求
+        struct event* outbox_event = nullptr;  // libevent 后端由它唤醒 reactor 处理 outbox
+        std::thread thread;
+        std::atomic<uint64_t> accepted{0};
+        std::atomic<uint64_t> active{0};
+
+        // 按依赖顺序释放：io_uring reactor、出站队列及其事件、监听器，最后是事件循环；
+        // 创建中途失败时同样经这里释放已创建的部分
+        ~Reactor();
+    };
+
+    bool createReactors();
+    bool createReactor(size_t index);
+    bool createUringReactor(Reactor& reactor, const struct sockaddr_in& sin);
+    bool createOutbox(Reactor& reactor);
+    void destroyReactors();
+    void closeConnections();
+    static void runReactor(Reactor& reactor);
+    // 在 loop 线程上绑定 reactor 0 的出站队列并开始接受连接
+    void bindSharedReactor();
+    static TimerWheel* getTimerWheel(Reactor& reactor);
+
     static void acceptCallback(struct evconnlistener* listener,
                              evutil_socket_t fd,
                              struct sockaddr* addr,
                              int socklen,
                              void* ctx);
     static void acceptErrorCallback(struct evconnlistener* listener, void* ctx);
+    static void outboxCallback(evutil_socket_t fd, short events, void* ctx);
 
-    void onAccept(evutil_socket_t fd, struct sockaddr* addr);
-    void onAcceptError();
+    void onAccept(Reactor& reactor, evutil_socket_t fd, struct sockaddr* addr);
+    void onAcceptError(Reactor& reactor);
+    // 两种后端共用的新连接初始化
+    void setupConnection(Reactor& reactor, const std::shared_ptr<Connection>& conn,
+                         const struct sockaddr_in& addr);
 
-    struct event_base* base_;
-    struct evconnlistener* listener_;
+    EventLoop& loop_;
+    std::vector<std::unique_ptr<Reactor>> reactors_;
+    size_t reactor_count_;
+    bool dedicated_io_threads_;
+    Backend backend_;
+    uint32_t coalesce_interval_ms_;
+    uint32_t idle_timeout_ms_;
+    size_t compress_threshold_;
+    OutputLimits output_limits_;
     std::string host_;
     uint16_t port_;
-    bool running_;
+    std::atomic<bool> running_;
 
     MessageCallback message_cb_;
+    Connection::MessageFilter message_filter_;
+    Connection::MessageBatchCallback batch_cb_;
     NewConnectionCallback new_conn_cb_;
+    CloseCallback close_cb_;
+
+    // 时间轮精度，以及每个 tick 最多回收的空闲连接数（其余顺延到下一个 tick）
+    static constexpr uint32_t TIMER_WHEEL_TICK_MS = 100;
+    static constexpr size_t IDLE_REAP_BATCH = 256;
+    // 小于此值的帧压缩收益有限（单个 PlayerStateMessage 约 60 字节），主要针对快照和批次帧
+    static constexpr size_t DEFAULT_COMPRESSION_THRESHOLD = 512;
 }; 
\ No newline at end of file
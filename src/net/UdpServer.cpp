@@ -0,0 +1,249 @@
+#include "UdpServer.h"
+#include "core/EventLoop.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <cerrno>
+#include <arpa/inet.h>
+#include <endian.h>
+#include <sys/socket.h>
+
+UdpServer::UdpServer(const std::string& host, uint16_t port)
+    : host_(host)
+    , port_(port)
+    , fd_(-1)
+    , base_(nullptr)
+    , read_event_(nullptr)
+    , running_(false)
+    , rng_(std::random_device{}()) {
+}
+
+UdpServer::~UdpServer() {
+    stop();
+}
+
+bool UdpServer::start() {
+    if (running_) {
+        return true;
+    }
+
+    // stop() 可能在其他线程调用 event_base_loopbreak
+    EventLoop::enableThreading();
+
+    fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd_ < 0) {
+        spdlog::error("Failed to create UDP socket: {}", strerror(errno));
+        return false;
+    }
+    evutil_make_socket_nonblocking(fd_);
+    evutil_make_listen_socket_reuseable(fd_);
+
+    struct sockaddr_in sin;
+    memset(&sin, 0, sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_port = htons(port_);
+    if (host_.empty() || host_ == "0.0.0.0") {
+        sin.sin_addr.s_addr = INADDR_ANY;
+    } else {
+        inet_pton(AF_INET, host_.c_str(), &sin.sin_addr);
+    }
+
+    if (bind(fd_, (struct sockaddr*)&sin, sizeof(sin)) < 0) {
+        spdlog::error("Failed to bind UDP port {}: {}", port_, strerror(errno));
+        evutil_closesocket(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    base_ = event_base_new();
+    if (!base_) {
+        spdlog::error("Failed to create event base for UDP");
+        evutil_closesocket(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    read_event_ = event_new(base_, fd_, EV_READ | EV_PERSIST, readCallback, this);
+    event_add(read_event_, nullptr);
+
+    running_ = true;
+    thread_ = std::thread([this]() {
+        event_base_dispatch(base_);
+    });
+
+    spdlog::info("UDP server started on {}:{}", host_, port_);
+    return true;
+}
+
+void UdpServer::stop() {
+    if (!running_) {
+        return;
+    }
+
+    running_ = false;
+    event_base_loopbreak(base_);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    event_free(read_event_);
+    read_event_ = nullptr;
+    event_base_free(base_);
+    base_ = nullptr;
+    evutil_closesocket(fd_);
+    fd_ = -1;
+
+    spdlog::info("UDP server stopped");
+}
+
+uint64_t UdpServer::bindSession(const std::shared_ptr<Connection>& conn) {
+    if (!conn) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(conn->getId());
+    if (it != sessions_.end()) {
+        return it->second.token;
+    }
+
+    // 随机令牌，0 保留为无效值
+    uint64_t token = 0;
+    while (token == 0 || tokens_.count(token) > 0) {
+        token = rng_();
+    }
+
+    Session session;
+    session.conn = conn;
+    session.token = token;
+    sessions_.emplace(conn->getId(), session);
+    tokens_.emplace(token, conn->getId());
+    spdlog::info("UDP session bound for connection {}", conn->getId());
+    return token;
+}
+
+void UdpServer::unbindSession(ConnectionId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(id);
+    if (it == sessions_.end()) {
+        return;
+    }
+    tokens_.erase(it->second.token);
+    sessions_.erase(it);
+}
+
+bool UdpServer::sendProto(ConnectionId id, const google::protobuf::MessageLite& proto) {
+    return sendBody(id, proto.SerializeAsString());
+}
+
+bool UdpServer::sendBody(ConnectionId id, const std::string& body) {
+    struct sockaddr_in to;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(id);
+        if (it == sessions_.end() || !it->second.has_addr) {
+            return false;
+        }
+        to = it->second.addr;
+    }
+    return sendBody(body, to);
+}
+
+void UdpServer::broadcastProto(const google::protobuf::MessageLite& proto) {
+    // 只序列化一次
+    std::string body = proto.SerializeAsString();
+    std::vector<struct sockaddr_in> targets;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        targets.reserve(sessions_.size());
+        for (const auto& pair : sessions_) {
+            if (pair.second.has_addr) {
+                targets.push_back(pair.second.addr);
+            }
+        }
+    }
+    for (const auto& to : targets) {
+        sendBody(body, to);
+    }
+}
+
+bool UdpServer::sendBody(const std::string& body, const struct sockaddr_in& to) {
+    if (fd_ < 0 || body.size() > MAX_DATAGRAM_SIZE) {
+        return false;
+    }
+    ssize_t n = sendto(fd_, body.data(), body.size(), 0, (const struct sockaddr*)&to, sizeof(to));
+    if (n < 0) {
+        // 不可靠通道：发送缓冲区满时直接丢弃
+        spdlog::debug("UDP send failed: {}", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void UdpServer::readCallback(evutil_socket_t fd, short events, void* ctx) {
+    auto server = static_cast<UdpServer*>(ctx);
+    server->onRead();
+}
+
+void UdpServer::onRead() {
+    static thread_local uint8_t buffer[MAX_DATAGRAM_SIZE];
+
+    // 读到 EAGAIN 为止
+    while (true) {
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        ssize_t n = recvfrom(fd_, buffer, sizeof(buffer), 0, (struct sockaddr*)&from, &from_len);
+        if (n < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                spdlog::error("UDP receive error: {}", strerror(errno));
+            }
+            return;
+        }
+        handleDatagram(buffer, static_cast<size_t>(n), from);
+    }
+}
+
+void UdpServer::handleDatagram(const uint8_t* data, size_t len, const struct sockaddr_in& from) {
+    if (len < TOKEN_SIZE) {
+        spdlog::debug("UDP datagram too small: {} bytes", len);
+        return;
+    }
+
+    uint64_t net_token = 0;
+    std::memcpy(&net_token, data, TOKEN_SIZE);
+    uint64_t token = be64toh(net_token);
+
+    // 校验令牌，并记录（或更新，如 NAT 重映射）客户端地址
+    std::shared_ptr<Connection> conn;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto token_it = tokens_.find(token);
+        if (token_it == tokens_.end()) {
+            spdlog::debug("UDP datagram with unknown token");
+            return;
+        }
+        Session& session = sessions_[token_it->second];
+        conn = session.conn.lock();
+        if (!conn || !conn->isConnected()) {
+            return;
+        }
+        session.addr = from;
+        session.has_addr = true;
+    }
+
+    Message msg;
+    if (!msg.deserializeBody(data + TOKEN_SIZE, len - TOKEN_SIZE)) {
+        return;
+    }
+
+    // 仅接受可丢失的高频消息，加入/离开、属性等仍走 TCP
+    if (msg.getType() != MessageType::PLAYER_UPDATE) {
+        spdlog::debug("Ignoring UDP message type {}", static_cast<int>(msg.getType()));
+        return;
+    }
+
+    // UDP 上的活动同样刷新 TCP 连接的空闲计时
+    conn->touch();
+    if (message_cb_) {
+        message_cb_(conn, msg);
+    }
+}
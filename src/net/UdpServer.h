@@ -0,0 +1,87 @@
+/**
+ * @file UdpServer.h
+ * @brief UDP 不可靠传输通道
+ * 
+ * 该模块负责：
+ * - 在与 TCP 相同的端口上监听 UDP 数据报
+ * - 通过 TCP 下发的会话令牌将 UDP 地址绑定到已有的 TCP 连接（玩家身份）
+ * - 接收 PLAYER_UPDATE 并以所属的 TCP 连接为身份投递给消息回调
+ * - 不可靠地向客户端发送状态快照
+ * 
+ * 数据报格式：
+ * - 客户端 -> 服务器：8字节会话令牌（网络字节序）+ NetworkMessage
+ * - 服务器 -> 客户端：NetworkMessage
+ * 
+ * @author Nevermore1102
+ * @date 2025-06-09
+ */
+
+#pragma once
+
+#include <event2/event.h>
+#include <netinet/in.h>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include "Connection.h"
+
+class UdpServer {
+public:
+    using MessageCallback = Connection::MessageCallback;
+
+    UdpServer(const std::string& host, uint16_t port);
+    ~UdpServer();
+
+    // 启动和停止：UDP 通道运行在独立的事件循环线程上，start() 不阻塞
+    bool start();
+    void stop();
+
+    void setMessageCallback(MessageCallback cb) { message_cb_ = cb; }
+    uint16_t getPort() const { return port_; }
+
+    // 为 TCP 连接分配会话令牌（重复调用返回同一令牌）
+    uint64_t bindSession(const std::shared_ptr<Connection>& conn);
+    // TCP 连接关闭时解除绑定
+    void unbindSession(ConnectionId id);
+
+    // 不可靠发送，连接尚未通过 UDP 报到时返回 false
+    bool sendProto(ConnectionId id, const google::protobuf::MessageLite& proto);
+    // 同上，发送已编码的消息体（可在多个会话间共享同一份编码）
+    bool sendBody(ConnectionId id, const std::string& body);
+    // 发送给所有已绑定 UDP 地址的会话
+    void broadcastProto(const google::protobuf::MessageLite& proto);
+
+private:
+    struct Session {
+        std::weak_ptr<Connection> conn;
+        uint64_t token = 0;
+        struct sockaddr_in addr{};
+        bool has_addr = false;
+    };
+
+    static void readCallback(evutil_socket_t fd, short events, void* ctx);
+    void onRead();
+    void handleDatagram(const uint8_t* data, size_t len, const struct sockaddr_in& from);
+    bool sendBody(const std::string& body, const struct sockaddr_in& to);
+
+    std::string host_;
+    uint16_t port_;
+    evutil_socket_t fd_;
+    struct event_base* base_;
+    struct event* read_event_;
+    std::thread thread_;
+    bool running_;
+
+    MessageCallback message_cb_;
+
+    std::unordered_map<ConnectionId, Session> sessions_;
+    std::unordered_map<uint64_t, ConnectionId> tokens_;
+    std::mt19937_64 rng_;
+    std::mutex mutex_;
+
+    static constexpr size_t TOKEN_SIZE = sizeof(uint64_t);
+    static constexpr size_t MAX_DATAGRAM_SIZE = 65507;
+};
@@ -0,0 +1,772 @@
+#include "UringReactor.h"
+#include "Connection.h"
+#include <event2/buffer.h>
+#include <event2/bufferevent.h>
+#include <spdlog/spdlog.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t KEY_MASK = (1ULL << 56) - 1;
+
+int sysIoUringSetup(unsigned entries, struct io_uring_params* params) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sysIoUringEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int sysIoUringRegister(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+} // namespace
+
+UringReactor::UringReactor(size_t index)
+    : index_(index)
+    , ring_fd_(-1)
+    , listen_fd_(-1)
+    , wakeup_fd_(-1)
+    , wakeup_value_(0)
+    , stopping_(false)
+    , sq_ptr_(MAP_FAILED), sq_map_size_(0)
+    , cq_ptr_(MAP_FAILED), cq_map_size_(0)
+    , sqes_(nullptr), sqes_map_size_(0)
+    , sq_head_(nullptr), sq_tail_(nullptr), sq_mask_(nullptr), sq_array_(nullptr), sq_entries_(0)
+    , cq_head_(nullptr), cq_tail_(nullptr), cq_mask_(nullptr), cqes_(nullptr)
+    , sq_local_tail_(0)
+    , buf_ring_(nullptr), buf_ring_size_(0), buf_tail_(0)
+    , next_key_(1)
+    , wakeup_pending_(false)
+    , timer_ts_{0, 0} {
+}
+
+UringReactor::~UringReactor() {
+    teardown();
+}
+
+bool UringReactor::init(const struct sockaddr_in& addr, bool reuse_port) {
+    if (!setupRing() || !setupBufferRing() || !probeSupport() || !setupListener(addr, reuse_port)) {
+        teardown();
+        return false;
+    }
+
+    wakeup_fd_ = eventfd(0, EFD_CLOEXEC);
+    if (wakeup_fd_ < 0) {
+        spdlog::error("Failed to create eventfd for reactor {}: {}", index_, strerror(errno));
+        teardown();
+        return false;
+    }
+    return true;
+}
+
+bool UringReactor::setupRing() {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    // 多路 recv 可能短时间内产生大量完成事件，CQ 放大到 SQ 的 4 倍
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = RING_ENTRIES * 4;
+
+    ring_fd_ = sysIoUringSetup(RING_ENTRIES, &params);
+    if (ring_fd_ < 0) {
+        spdlog::error("io_uring_setup failed for reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+
+    sq_map_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_map_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_map_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    sq_ptr_ = mmap(nullptr, sq_map_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   ring_fd_, IORING_OFF_SQ_RING);
+    cq_ptr_ = mmap(nullptr, cq_map_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   ring_fd_, IORING_OFF_CQ_RING);
+    void* sqes = mmap(nullptr, sqes_map_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring_fd_, IORING_OFF_SQES);
+    if (sq_ptr_ == MAP_FAILED || cq_ptr_ == MAP_FAILED || sqes == MAP_FAILED) {
+        spdlog::error("Failed to map io_uring for reactor {}: {}", index_, strerror(errno));
+        if (sqes != MAP_FAILED) {
+            munmap(sqes, sqes_map_size_);
+        }
+        return false;
+    }
+    sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+
+    auto sq = static_cast<uint8_t*>(sq_ptr_);
+    sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    sq_entries_ = params.sq_entries;
+    sq_local_tail_ = *sq_tail_;
+
+    auto cq = static_cast<uint8_t*>(cq_ptr_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    return true;
+}
+
+bool UringReactor::setupBufferRing() {
+    buf_ring_size_ = BUFFER_COUNT * sizeof(struct io_uring_buf);
+    void* ring = mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED) {
+        spdlog::error("Failed to allocate buffer ring for reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+    buf_ring_ = static_cast<struct io_uring_buf*>(ring);
+
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = reinterpret_cast<uint64_t>(buf_ring_);
+    reg.ring_entries = BUFFER_COUNT;
+    reg.bgid = BUFFER_GROUP;
+    if (sysIoUringRegister(ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+        spdlog::error("Failed to register buffer ring for reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+
+    buffers_.reset(new uint8_t[BUFFER_COUNT * BUFFER_SIZE]);
+    for (unsigned bid = 0; bid < BUFFER_COUNT; ++bid) {
+        recycleBuffer(static_cast<uint16_t>(bid));
+    }
+    return true;
+}
+
+bool UringReactor::probeSupport() {
+    // 内核需支持本后端用到的全部操作码，否则返回 false 由 TcpServer 退回 libevent
+    constexpr unsigned PROBE_OPS = 256;
+    std::vector<uint8_t> probe_buf(sizeof(struct io_uring_probe) + PROBE_OPS * sizeof(struct io_uring_probe_op), 0);
+    auto probe = reinterpret_cast<struct io_uring_probe*>(probe_buf.data());
+    if (sysIoUringRegister(ring_fd_, IORING_REGISTER_PROBE, probe, PROBE_OPS) < 0) {
+        spdlog::error("IORING_REGISTER_PROBE failed for reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+    for (uint8_t op : {IORING_OP_ACCEPT, IORING_OP_RECV, IORING_OP_SENDMSG, IORING_OP_READ, IORING_OP_TIMEOUT}) {
+        if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+            spdlog::error("io_uring opcode {} not supported, reactor {} unavailable", op, index_);
+            return false;
+        }
+    }
+
+    // multishot recv 无法通过操作码探测：在 socketpair 上实际挂一次，
+    // 对端写 1 字节后关闭写端，支持时先收到带 F_MORE 的数据再收到 EOF
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0) {
+        spdlog::error("Failed to create socketpair for reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+    char byte = 0;
+    bool supported = false;
+    struct io_uring_sqe* sqe = nullptr;
+    if (write(fds[1], &byte, 1) == 1 && shutdown(fds[1], SHUT_WR) == 0 && (sqe = getSqe()) != nullptr) {
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = fds[0];
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = BUFFER_GROUP;
+        bool first = true;
+        bool more = true;
+        while (more) {
+            if (submit(1) < 0 && errno != EINTR) {
+                spdlog::error("io_uring_enter failed while probing reactor {}: {}", index_, strerror(errno));
+                break;
+            }
+            unsigned head = *cq_head_;
+            while (more && head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+                struct io_uring_cqe cqe = cqes_[head & *cq_mask_];
+                __atomic_store_n(cq_head_, ++head, __ATOMIC_RELEASE);
+                if (cqe.flags & IORING_CQE_F_BUFFER) {
+                    recycleBuffer(static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT));
+                }
+                more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+                if (first) {
+                    // 旧内核会以 -EINVAL 拒绝，或忽略标志按单次 recv 完成（没有 F_MORE）
+                    supported = cqe.res == 1 && more;
+                    if (cqe.res < 0) {
+                        spdlog::error("Multishot recv probe failed on reactor {}: {}", index_, strerror(-cqe.res));
+                    }
+                    first = false;
+                }
+            }
+        }
+    }
+    ::close(fds[0]);
+    ::close(fds[1]);
+    if (!supported) {
+        spdlog::error("Kernel does not support multishot recv, reactor {} unavailable", index_);
+    }
+    return supported;
+}
+
+bool UringReactor::setupListener(const struct sockaddr_in& addr, bool reuse_port) {
+    listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+        spdlog::error("Failed to create listen socket for reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+
+    int on = 1;
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    // 多个 reactor 各自绑定同一端口，由内核通过 SO_REUSEPORT 分发新连接
+    if (reuse_port && setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) < 0) {
+        spdlog::error("Failed to set SO_REUSEPORT for reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+
+    if (bind(listen_fd_, reinterpret_cast<const struct sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        listen(listen_fd_, SOMAXCONN) < 0) {
+        spdlog::error("Failed to listen on reactor {}: {}", index_, strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void UringReactor::teardown() {
+    stopping_ = true;
+
+    // 先通知上层连接关闭（会从连接池移除），再统一释放 socket
+    std::vector<std::shared_ptr<Connection>> conns;
+    for (auto& item : entries_) {
+        conns.push_back(item.second->conn);
+    }
+    for (auto& conn : conns) {
+        conn->close();
+    }
+    timer_wheel_.reset();
+
+    // 关闭 ring 会取消所有未完成的操作
+    if (ring_fd_ >= 0) {
+        ::close(ring_fd_);
+        ring_fd_ = -1;
+    }
+    for (auto& item : entries_) {
+        ::close(item.second->fd);
+        evbuffer_free(item.second->inflight);
+    }
+    entries_.clear();
+    dirty_.clear();
+    closing_.clear();
+
+    if (listen_fd_ >= 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+    }
+    if (wakeup_fd_ >= 0) {
+        ::close(wakeup_fd_);
+        wakeup_fd_ = -1;
+    }
+    if (sqes_) {
+        munmap(sqes_, sqes_map_size_);
+        sqes_ = nullptr;
+    }
+    if (cq_ptr_ != MAP_FAILED) {
+        munmap(cq_ptr_, cq_map_size_);
+        cq_ptr_ = MAP_FAILED;
+    }
+    if (sq_ptr_ != MAP_FAILED) {
+        munmap(sq_ptr_, sq_map_size_);
+        sq_ptr_ = MAP_FAILED;
+    }
+    if (buf_ring_) {
+        munmap(buf_ring_, buf_ring_size_);
+        buf_ring_ = nullptr;
+    }
+    buffers_.reset();
+}
+
+void UringReactor::enableTimerWheel(uint32_t tick_ms) {
+    if (timer_wheel_) {
+        return;
+    }
+    timer_wheel_ = std::make_unique<TimerWheel>(tick_ms);
+    timer_ts_.tv_sec = tick_ms / 1000;
+    timer_ts_.tv_nsec = static_cast<long long>(tick_ms % 1000) * 1000000;
+}
+
+void UringReactor::run() {
+    owner_ = std::this_thread::get_id();
+    armAccept();
+    armWakeup();
+    if (timer_wheel_) {
+        armTimer();
+    }
+
+    while (!stopping_) {
+        // 本轮产生的所有发送、重新挂起的接收在这里一次提交，并等待至少一个完成事件
+        flushSends();
+        reapClosed();
+        if (submit(1) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            spdlog::error("io_uring_enter failed on reactor {}: {}", index_, strerror(errno));
+            break;
+        }
+        processCompletions();
+    }
+}
+
+void UringReactor::stop() {
+    stopping_ = true;
+    wakeup();
+}
+
+void UringReactor::scheduleSend(uint64_t key) {
+    if (inLoopThread()) {
+        markDirty(key);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(remote_mutex_);
+        remote_sends_.push_back(key);
+    }
+    wakeup();
+}
+
+void UringReactor::closeConnection(uint64_t key) {
+    if (stopping_) {
+        return;  // teardown 会统一关闭
+    }
+    if (inLoopThread()) {
+        beginClose(key);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(remote_mutex_);
+        remote_closes_.push_back(key);
+    }
+    wakeup();
+}
+
+void UringReactor::post(std::function<void()> task) {
+    // 即使在本线程也延后到下一轮执行，与 libevent 后端的 event_base_once 行为一致
+    {
+        std::lock_guard<std::mutex> lock(remote_mutex_);
+        remote_tasks_.push_back(std::move(task));
+    }
+    wakeup();
+}
+
+void UringReactor::wakeup() {
+    if (wakeup_pending_.exchange(true)) {
+        return;
+    }
+    uint64_t one = 1;
+    if (write(wakeup_fd_, &one, sizeof(one)) < 0) {
+        spdlog::error("Failed to wake up reactor {}: {}", index_, strerror(errno));
+    }
+}
+
+struct io_uring_sqe* UringReactor::getSqe() {
+    unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (sq_local_tail_ - head >= sq_entries_) {
+        // SQ 已满，先把已有的提交出去
+        submit(0);
+        head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (sq_local_tail_ - head >= sq_entries_) {
+            return nullptr;
+        }
+    }
+
+    unsigned index = sq_local_tail_ & *sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    ++sq_local_tail_;
+    return sqe;
+}
+
+int UringReactor::submit(unsigned wait_nr) {
+    __atomic_store_n(sq_tail_, sq_local_tail_, __ATOMIC_RELEASE);
+    unsigned pending = sq_local_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+    if (pending == 0 && wait_nr == 0) {
+        return 0;
+    }
+    return sysIoUringEnter(ring_fd_, pending, wait_nr, flags);
+}
+
+void UringReactor::processCompletions() {
+    unsigned head = *cq_head_;
+    while (true) {
+        unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        if (head == tail) {
+            break;
+        }
+        // 先拷出并归还 CQE，处理过程中可能继续提交新的请求
+        struct io_uring_cqe cqe = cqes_[head & *cq_mask_];
+        ++head;
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+        handleCompletion(cqe);
+    }
+}
+
+void UringReactor::handleCompletion(const struct io_uring_cqe& cqe) {
+    uint64_t key = cqe.user_data & KEY_MASK;
+    switch (static_cast<Op>(cqe.user_data >> 56)) {
+        case OP_ACCEPT:
+            onAccept(cqe.res, cqe.flags);
+            break;
+        case OP_RECV:
+            onRecv(key, cqe.res, cqe.flags);
+            break;
+        case OP_SEND:
+            onSend(key, cqe.res);
+            break;
+        case OP_WAKEUP:
+            onWakeup();
+            break;
+        case OP_CANCEL:
+            // 被取消的 recv 会单独以 -ECANCELED 完成，这里无需处理
+            break;
+        case OP_TIMER:
+            // 纯超时请求以 -ETIME 完成
+            if (!stopping_) {
+                armTimer();
+                timer_wheel_->advance(TimerWheel::nowMs());
+            }
+            break;
+        default:
+            spdlog::warn("Unknown io_uring completion on reactor {}: {}", index_, cqe.user_data);
+            break;
+    }
+}
+
+void UringReactor::armAccept() {
+    struct io_uring_sqe* sqe = getSqe();
+    if (!sqe) {
+        spdlog::error("Submission queue full, failed to arm accept on reactor {}", index_);
+        return;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = listen_fd_;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    sqe->user_data = makeUserData(OP_ACCEPT, 0);
+}
+
+void UringReactor::armRecv(Entry& entry, uint64_t key) {
+    struct io_uring_sqe* sqe = getSqe();
+    if (!sqe) {
+        spdlog::error("Submission queue full, failed to arm recv for connection {}", entry.conn->getId());
+        beginClose(key);
+        return;
+    }
+    // multishot recv：每次有数据由内核从缓冲区组中挑一块填入
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = entry.fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->user_data = makeUserData(OP_RECV, key);
+    entry.recv_armed = true;
+}
+
+void UringReactor::cancelRecv(Entry& entry, uint64_t key) {
+    if (!entry.recv_armed || entry.recv_cancelling) {
+        return;
+    }
+    struct io_uring_sqe* sqe = getSqe();
+    if (!sqe) {
+        return;  // 下一次数据到达时再试，期间数据仍进入输入缓冲区
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = makeUserData(OP_RECV, key);
+    sqe->user_data = makeUserData(OP_CANCEL, key);
+    entry.recv_cancelling = true;
+}
+
+void UringReactor::resumeRecv(uint64_t key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return;
+    }
+    Entry& entry = *it->second;
+    // 取消尚未完成时由其完成事件重新挂起
+    if (!entry.closing && !entry.recv_armed) {
+        armRecv(entry, key);
+    }
+}
+
+void UringReactor::armWakeup() {
+    struct io_uring_sqe* sqe = getSqe();
+    if (!sqe) {
+        spdlog::error("Submission queue full, failed to arm wakeup on reactor {}", index_);
+        return;
+    }
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = wakeup_fd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&wakeup_value_);
+    sqe->len = sizeof(wakeup_value_);
+    sqe->user_data = makeUserData(OP_WAKEUP, 0);
+}
+
+void UringReactor::armTimer() {
+    struct io_uring_sqe* sqe = getSqe();
+    if (!sqe) {
+        spdlog::error("Submission queue full, failed to arm timer on reactor {}", index_);
+        return;
+    }
+    sqe->opcode = IORING_OP_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(&timer_ts_);
+    sqe->len = 1;
+    sqe->user_data = makeUserData(OP_TIMER, 0);
+}
+
+void UringReactor::recycleBuffer(uint16_t bid) {
+    struct io_uring_buf* buf = &buf_ring_[buf_tail_ & (BUFFER_COUNT - 1)];
+    buf->addr = reinterpret_cast<uint64_t>(buffers_.get() + static_cast<size_t>(bid) * BUFFER_SIZE);
+    buf->len = BUFFER_SIZE;
+    buf->bid = bid;
+    ++buf_tail_;
+    __atomic_store_n(&buf_ring_[0].resv, buf_tail_, __ATOMIC_RELEASE);
+}
+
+void UringReactor::submitSend(Entry& entry, uint64_t key) {
+    // 把输出缓冲区的数据链移到 inflight：发送期间其他线程仍可向输出缓冲区追加帧
+    struct evbuffer* output = entry.conn->outputBuffer();
+    size_t inflight_len = evbuffer_get_length(entry.inflight);
+    if (inflight_len < MAX_SEND_BATCH) {
+        evbuffer_remove_buffer(output, entry.inflight, MAX_SEND_BATCH - inflight_len);
+    }
+    if (evbuffer_get_length(entry.inflight) == 0) {
+        return;
+    }
+
+    struct io_uring_sqe* sqe = getSqe();
+    if (!sqe) {
+        markDirty(key);  // 下一轮再试
+        return;
+    }
+
+    struct evbuffer_iovec vecs[64];
+    int n = evbuffer_peek(entry.inflight, -1, nullptr, vecs, 64);
+    n = std::min(n, 64);
+    for (int i = 0; i < n; ++i) {
+        entry.iov[i].iov_base = vecs[i].iov_base;
+        entry.iov[i].iov_len = vecs[i].iov_len;
+    }
+    memset(&entry.msg, 0, sizeof(entry.msg));
+    entry.msg.msg_iov = entry.iov;
+    entry.msg.msg_iovlen = static_cast<size_t>(n);
+
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = entry.fd;
+    sqe->addr = reinterpret_cast<uint64_t>(&entry.msg);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = makeUserData(OP_SEND, key);
+    entry.send_inflight = true;
+}
+
+void UringReactor::onAccept(int res, uint32_t flags) {
+    // 内核不再继续产生 accept 完成事件时需要重新挂起
+    if (!(flags & IORING_CQE_F_MORE) && !stopping_) {
+        armAccept();
+    }
+
+    if (res < 0) {
+        spdlog::error("Accept error on reactor {}: {}", index_, strerror(-res));
+        return;
+    }
+
+    uint64_t key = next_key_++;
+    auto entry = std::make_unique<Entry>();
+    entry->fd = res;
+    entry->inflight = evbuffer_new();
+    entry->conn = std::make_shared<Connection>(this, key);
+    auto conn = entry->conn;
+    armRecv(*entry, key);
+    entries_.emplace(key, std::move(entry));
+
+    struct sockaddr_in addr;
+    socklen_t addr_len = sizeof(addr);
+    memset(&addr, 0, sizeof(addr));
+    getpeername(res, reinterpret_cast<struct sockaddr*>(&addr), &addr_len);
+    if (accept_cb_) {
+        accept_cb_(conn, addr);
+    }
+}
+
+void UringReactor::onRecv(uint64_t key, int res, uint32_t flags) {
+    bool has_buffer = (flags & IORING_CQE_F_BUFFER) != 0;
+    uint16_t bid = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        if (has_buffer) {
+            recycleBuffer(bid);
+        }
+        return;
+    }
+    Entry& entry = *it->second;
+    if (!(flags & IORING_CQE_F_MORE)) {
+        entry.recv_armed = false;
+        entry.recv_cancelling = false;
+    }
+    if (entry.closing) {
+        if (has_buffer) {
+            recycleBuffer(bid);
+        }
+        return;
+    }
+
+    auto conn = entry.conn;
+    if (res > 0) {
+        // 数据拷入连接的输入缓冲区后立即归还内核缓冲区
+        evbuffer_add(conn->inputBuffer(), buffers_.get() + static_cast<size_t>(bid) * BUFFER_SIZE, res);
+        recycleBuffer(bid);
+        bool rearm = !entry.recv_armed;
+        // 暂停读取期间数据只留在输入缓冲区，由 resumeReading 补处理
+        if (!conn->isReadPaused()) {
+            conn->onRead();
+        }
+        // 回调中连接可能已关闭或暂停读取：暂停时取消 multishot recv，不再重新挂起
+        if (entry.closing) {
+            return;
+        }
+        if (conn->isReadPaused()) {
+            cancelRecv(entry, key);
+        } else if (rearm) {
+            armRecv(entry, key);
+        }
+    } else if (res == 0) {
+        conn->onError(BEV_EVENT_EOF);
+    } else if (res == -ECANCELED) {
+        // 暂停读取时取消的 recv；取消完成前已恢复读取的重新挂起
+        if (!entry.recv_armed && !conn->isReadPaused()) {
+            armRecv(entry, key);
+        }
+    } else if (res == -ENOBUFS) {
+        // 缓冲区组暂时耗尽，处理完本轮数据后重新挂起
+        spdlog::debug("Receive buffers exhausted on reactor {}", index_);
+        if (!entry.recv_armed && !conn->isReadPaused()) {
+            armRecv(entry, key);
+        }
+    } else {
+        spdlog::error("Recv error on connection {}: {}", conn->getId(), strerror(-res));
+        conn->onError(BEV_EVENT_ERROR);
+    }
+}
+
+void UringReactor::onSend(uint64_t key, int res) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return;
+    }
+    Entry& entry = *it->second;
+    entry.send_inflight = false;
+    if (entry.closing) {
+        return;
+    }
+
+    auto conn = entry.conn;
+    if (res < 0) {
+        spdlog::error("Send error on connection {}: {}", conn->getId(), strerror(-res));
+        conn->onError(BEV_EVENT_ERROR);
+        return;
+    }
+
+    evbuffer_drain(entry.inflight, static_cast<size_t>(res));
+    conn->onOutputWritten();
+    if (!entry.closing && (evbuffer_get_length(entry.inflight) > 0 ||
+                           evbuffer_get_length(conn->outputBuffer()) > 0)) {
+        markDirty(key);
+    }
+}
+
+void UringReactor::onWakeup() {
+    // 先清除标志再取队列，之后投递的请求会再次唤醒
+    wakeup_pending_ = false;
+    std::vector<uint64_t> sends;
+    std::vector<uint64_t> closes;
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(remote_mutex_);
+        sends.swap(remote_sends_);
+        closes.swap(remote_closes_);
+        tasks.swap(remote_tasks_);
+    }
+
+    if (stopping_) {
+        return;
+    }
+    armWakeup();
+
+    for (uint64_t key : sends) {
+        markDirty(key);
+    }
+    for (uint64_t key : closes) {
+        beginClose(key);
+    }
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+void UringReactor::markDirty(uint64_t key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second->send_scheduled) {
+        return;
+    }
+    it->second->send_scheduled = true;
+    dirty_.push_back(key);
+}
+
+void UringReactor::flushSends() {
+    std::vector<uint64_t> dirty;
+    dirty.swap(dirty_);
+    for (uint64_t key : dirty) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            continue;
+        }
+        Entry& entry = *it->second;
+        entry.send_scheduled = false;
+        // 同一连接同时只有一个 sendmsg，完成后再发剩余数据
+        if (entry.closing || entry.send_inflight) {
+            continue;
+        }
+        submitSend(entry, key);
+    }
+}
+
+void UringReactor::beginClose(uint64_t key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second->closing) {
+        return;
+    }
+    Entry& entry = *it->second;
+    entry.closing = true;
+    // 关闭读写方向，让挂起的 recv/sendmsg 尽快完成
+    shutdown(entry.fd, SHUT_RDWR);
+    closing_.push_back(key);
+}
+
+void UringReactor::reapClosed() {
+    // 内核仍可能引用 inflight 数据和缓冲区，等收发操作都结束后再释放
+    auto it = std::remove_if(closing_.begin(), closing_.end(), [this](uint64_t key) {
+        auto entry_it = entries_.find(key);
+        if (entry_it == entries_.end()) {
+            return true;
+        }
+        Entry& entry = *entry_it->second;
+        if (entry.recv_armed || entry.send_inflight) {
+            return false;
+        }
+        ::close(entry.fd);
+        evbuffer_free(entry.inflight);
+        entries_.erase(entry_it);
+        return true;
+    });
+    closing_.erase(it, closing_.end());
+}
@@ -0,0 +1,78 @@
+/**
+ * @file CodecDiagnostics.h
+ * @brief 编解码诊断日志
+ *
+ * 该模块负责：
+ * - 编解码热路径上的诊断日志由编译开关 CODEC_DIAGNOSTICS 控制，关闭时（Release 默认）
+ *   CODEC_TRACE 展开为空语句，参数不会被求值
+ * - 开启时按 1/SAMPLE_EVERY 采样，且每秒最多输出 MAX_PER_SECOND 条，
+ *   只有在 debug 级别生效时才会格式化
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#ifndef CODEC_DIAGNOSTICS
+#define CODEC_DIAGNOSTICS 0
+#endif
+
+#if CODEC_DIAGNOSTICS
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <spdlog/spdlog.h>
+
+class CodecDiagnostics {
+public:
+    // 本次事件是否输出日志（线程安全，不加锁）
+    static bool sample() {
+        if (!spdlog::should_log(spdlog::level::debug)) {
+            return false;
+        }
+        if (counter().fetch_add(1, std::memory_order_relaxed) % SAMPLE_EVERY != 0) {
+            return false;
+        }
+
+        using namespace std::chrono;
+        uint64_t second = static_cast<uint64_t>(
+            duration_cast<seconds>(steady_clock::now().time_since_epoch()).count());
+        uint64_t window = windowSecond().load(std::memory_order_relaxed);
+        if (window != second && windowSecond().compare_exchange_strong(window, second, std::memory_order_relaxed)) {
+            windowCount().store(0, std::memory_order_relaxed);
+        }
+        return windowCount().fetch_add(1, std::memory_order_relaxed) < MAX_PER_SECOND;
+    }
+
+private:
+    static std::atomic<uint64_t>& counter() {
+        static std::atomic<uint64_t> value{0};
+        return value;
+    }
+    static std::atomic<uint64_t>& windowSecond() {
+        static std::atomic<uint64_t> value{0};
+        return value;
+    }
+    static std::atomic<uint32_t>& windowCount() {
+        static std::atomic<uint32_t> value{0};
+        return value;
+    }
+
+    static constexpr uint64_t SAMPLE_EVERY = 64;
+    static constexpr uint32_t MAX_PER_SECOND = 10;
+};
+
+#define CODEC_TRACE(...)                        \
+    do {                                        \
+        if (CodecDiagnostics::sample()) {       \
+            spdlog::debug(__VA_ARGS__);         \
+        }                                       \
+    } while (0)
+
+#else
+
+#define CODEC_TRACE(...) do {} while (0)
+
+#endif
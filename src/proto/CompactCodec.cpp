@@ -0,0 +1,184 @@
+#include "CompactCodec.h"
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+constexpr int POS_XZ_BITS = 20;
+constexpr int POS_Y_BITS = 16;
+constexpr int YAW_BITS = 10;
+constexpr int PITCH_BITS = 8;
+constexpr int VELOCITY_BITS = 7;
+
+// 低位在前逐字节写出
+class BitWriter {
+public:
+    explicit BitWriter(uint8_t* out) : out_(out), acc_(0), count_(0) {}
+
+    void write(uint32_t value, int bits) {
+        acc_ |= static_cast<uint64_t>(value & ((1u << bits) - 1)) << count_;
+        count_ += bits;
+        while (count_ >= 8) {
+            *out_++ = static_cast<uint8_t>(acc_);
+            acc_ >>= 8;
+            count_ -= 8;
+        }
+    }
+
+    void flush() {
+        if (count_ > 0) {
+            *out_++ = static_cast<uint8_t>(acc_);
+            acc_ = 0;
+            count_ = 0;
+        }
+    }
+
+private:
+    uint8_t* out_;
+    uint64_t acc_;
+    int count_;
+};
+
+// 调用方保证输入长度足够
+class BitReader {
+public:
+    explicit BitReader(const uint8_t* in) : in_(in), acc_(0), count_(0) {}
+
+    uint32_t read(int bits) {
+        while (count_ < bits) {
+            acc_ |= static_cast<uint64_t>(*in_++) << count_;
+            count_ += 8;
+        }
+        uint32_t value = static_cast<uint32_t>(acc_ & ((1u << bits) - 1));
+        acc_ >>= bits;
+        count_ -= bits;
+        return value;
+    }
+
+private:
+    const uint8_t* in_;
+    uint64_t acc_;
+    int count_;
+};
+
+// 区间量化：只用 2^bits - 1 个码值，使区间中点（世界原点、零速度）可以精确表示
+uint32_t quantize(float value, float min, float max, int bits) {
+    uint32_t steps = (1u << bits) - 2;
+    float t = (value - min) / (max - min);
+    if (!(t > 0.0f)) {
+        t = 0.0f;   // 同时处理 NaN
+    } else if (t > 1.0f) {
+        t = 1.0f;
+    }
+    return static_cast<uint32_t>(t * steps + 0.5f);
+}
+
+float dequantize(uint32_t q, float min, float max, int bits) {
+    uint32_t steps = (1u << bits) - 2;
+    return min + (max - min) * static_cast<float>(q) / static_cast<float>(steps);
+}
+
+// 偏航角是周期量，360 度整圈均分
+uint32_t quantizeYaw(float degrees) {
+    if (!std::isfinite(degrees)) {
+        return 0;
+    }
+    float turns = degrees / 360.0f;
+    turns -= std::floor(turns);
+    return static_cast<uint32_t>(std::lround(turns * (1u << YAW_BITS))) & ((1u << YAW_BITS) - 1);
+}
+
+float dequantizeYaw(uint32_t q) {
+    return static_cast<float>(q) * 360.0f / static_cast<float>(1u << YAW_BITS);
+}
+
+// 俯仰角先折算到 [-180, 180)（客户端欧拉角可能是 [0, 360)），再截断到 [-90, 90]
+uint32_t quantizePitch(float degrees) {
+    if (std::isfinite(degrees)) {
+        degrees = std::remainder(degrees, 360.0f);
+    }
+    return quantize(degrees, -90.0f, 90.0f, PITCH_BITS);
+}
+
+void writeTransform(BitWriter& writer, float px, float py, float pz, float pitch, float yaw) {
+    writer.write(quantize(px, CompactCodec::WORLD_MIN_X, CompactCodec::WORLD_MAX_X, POS_XZ_BITS), POS_XZ_BITS);
+    writer.write(quantize(py, CompactCodec::WORLD_MIN_Y, CompactCodec::WORLD_MAX_Y, POS_Y_BITS), POS_Y_BITS);
+    writer.write(quantize(pz, CompactCodec::WORLD_MIN_Z, CompactCodec::WORLD_MAX_Z, POS_XZ_BITS), POS_XZ_BITS);
+    writer.write(quantizeYaw(yaw), YAW_BITS);
+    writer.write(quantizePitch(pitch), PITCH_BITS);
+}
+
+void readTransform(BitReader& reader, float& px, float& py, float& pz, float& pitch, float& yaw) {
+    px = dequantize(reader.read(POS_XZ_BITS), CompactCodec::WORLD_MIN_X, CompactCodec::WORLD_MAX_X, POS_XZ_BITS);
+    py = dequantize(reader.read(POS_Y_BITS), CompactCodec::WORLD_MIN_Y, CompactCodec::WORLD_MAX_Y, POS_Y_BITS);
+    pz = dequantize(reader.read(POS_XZ_BITS), CompactCodec::WORLD_MIN_Z, CompactCodec::WORLD_MAX_Z, POS_XZ_BITS);
+    yaw = dequantizeYaw(reader.read(YAW_BITS));
+    pitch = dequantize(reader.read(PITCH_BITS), -90.0f, 90.0f, PITCH_BITS);
+}
+
+static_assert(2 * POS_XZ_BITS + POS_Y_BITS + YAW_BITS + PITCH_BITS + 3 * VELOCITY_BITS + 1
+                  <= CompactCodec::PLAYER_UPDATE_BYTES * 8,
+              "PlayerUpdate layout exceeds PLAYER_UPDATE_BYTES");
+static_assert(2 * POS_XZ_BITS + POS_Y_BITS + YAW_BITS + PITCH_BITS <= CompactCodec::TRANSFORM_BYTES * 8,
+              "Transform layout exceeds TRANSFORM_BYTES");
+
+} // namespace
+
+void CompactCodec::encodePlayerUpdate(const PlayerUpdateMessage& in, CompactPlayerUpdate* out) {
+    std::string* state = out->mutable_state();
+    state->assign(PLAYER_UPDATE_BYTES, '\0');
+    BitWriter writer(reinterpret_cast<uint8_t*>(&(*state)[0]));
+    writeTransform(writer, in.position_x(), in.position_y(), in.position_z(), in.rotation_x(), in.rotation_y());
+    writer.write(quantize(in.velocity_x(), -MAX_SPEED, MAX_SPEED, VELOCITY_BITS), VELOCITY_BITS);
+    writer.write(quantize(in.velocity_y(), -MAX_SPEED, MAX_SPEED, VELOCITY_BITS), VELOCITY_BITS);
+    writer.write(quantize(in.velocity_z(), -MAX_SPEED, MAX_SPEED, VELOCITY_BITS), VELOCITY_BITS);
+    writer.write(in.is_grounded() ? 1 : 0, 1);
+    writer.flush();
+
+    float health = in.health();
+    out->set_health(health > 0.0f ? static_cast<uint32_t>(std::lround(health)) : 0);
+}
+
+bool CompactCodec::decodePlayerUpdate(const CompactPlayerUpdate& in, PlayerUpdateMessage* out) {
+    if (in.state().size() != PLAYER_UPDATE_BYTES) {
+        return false;
+    }
+    BitReader reader(reinterpret_cast<const uint8_t*>(in.state().data()));
+    float px, py, pz, pitch, yaw;
+    readTransform(reader, px, py, pz, pitch, yaw);
+    out->set_position_x(px);
+    out->set_position_y(py);
+    out->set_position_z(pz);
+    out->set_rotation_x(pitch);
+    out->set_rotation_y(yaw);
+    out->set_rotation_z(0.0f);
+    out->set_velocity_x(dequantize(reader.read(VELOCITY_BITS), -MAX_SPEED, MAX_SPEED, VELOCITY_BITS));
+    out->set_velocity_y(dequantize(reader.read(VELOCITY_BITS), -MAX_SPEED, MAX_SPEED, VELOCITY_BITS));
+    out->set_velocity_z(dequantize(reader.read(VELOCITY_BITS), -MAX_SPEED, MAX_SPEED, VELOCITY_BITS));
+    out->set_is_grounded(reader.read(1) != 0);
+    out->set_health(static_cast<float>(in.health()));
+    return true;
+}
+
+void CompactCodec::encodeTransform(const Vector3& position, const Vector3& rotation, std::string* out) {
+    out->assign(TRANSFORM_BYTES, '\0');
+    BitWriter writer(reinterpret_cast<uint8_t*>(&(*out)[0]));
+    writeTransform(writer, position.x(), position.y(), position.z(), rotation.x(), rotation.y());
+    writer.flush();
+}
+
+bool CompactCodec::decodeTransform(const std::string& in, Vector3* position, Vector3* rotation) {
+    if (in.size() != TRANSFORM_BYTES) {
+        return false;
+    }
+    BitReader reader(reinterpret_cast<const uint8_t*>(in.data()));
+    float px, py, pz, pitch, yaw;
+    readTransform(reader, px, py, pz, pitch, yaw);
+    position->set_x(px);
+    position->set_y(py);
+    position->set_z(pz);
+    rotation->set_x(pitch);
+    rotation->set_y(yaw);
+    rotation->set_z(0.0f);
+    return true;
+}
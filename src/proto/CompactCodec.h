@@ -0,0 +1,46 @@
+/**
+ * @file CompactCodec.h
+ * @brief 玩家移动数据的量化编解码
+ *
+ * 该模块负责：
+ * - 坐标按世界边界量化为定点数（水平 20 位，约 4mm；高度 16 位，约 1.6cm）
+ * - 朝向只保留偏航/俯仰（10 位 / 8 位，欧拉角，单位度），翻滚角丢弃
+ * - 速度每轴 7 位，范围 ±MAX_SPEED（约 0.5m/s 精度）
+ * - 按位紧密打包：PlayerUpdate 12 字节（原 PlayerUpdateMessage 约 50 字节），
+ *   坐标+朝向 10 字节（代替 PlayerStateMessage 中的两个 Vector3）
+ *
+ * 量化参数须与客户端保持一致，修改后需同步升级客户端。
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "NetworkMessage.pb.h"
+
+class CompactCodec {
+public:
+    static constexpr size_t PLAYER_UPDATE_BYTES = 12;
+    static constexpr size_t TRANSFORM_BYTES = 10;
+
+    // 世界边界（Y 轴朝上）
+    static constexpr float WORLD_MIN_X = -2048.0f;
+    static constexpr float WORLD_MAX_X = 2048.0f;
+    static constexpr float WORLD_MIN_Y = -256.0f;
+    static constexpr float WORLD_MAX_Y = 768.0f;
+    static constexpr float WORLD_MIN_Z = -2048.0f;
+    static constexpr float WORLD_MAX_Z = 2048.0f;
+    static constexpr float MAX_SPEED = 32.0f;
+
+    // PlayerUpdateMessage <-> CompactPlayerUpdate；超出边界的值被截断到边界
+    static void encodePlayerUpdate(const PlayerUpdateMessage& in, CompactPlayerUpdate* out);
+    // state 长度不对时返回 false
+    static bool decodePlayerUpdate(const CompactPlayerUpdate& in, PlayerUpdateMessage* out);
+
+    // 坐标 + 朝向（rotation.x 为俯仰，rotation.y 为偏航）<-> PlayerStateMessage.compact_transform
+    static void encodeTransform(const Vector3& position, const Vector3& rotation, std::string* out);
+    static bool decodeTransform(const std::string& in, Vector3* position, Vector3* rotation);
+};
@@ -1,4 +1,6 @@
 #include "Message.h"
+#include "CodecDiagnostics.h"
+#include "ProtoArena.h"
 #include <cstring>
 #include <spdlog/spdlog.h>
 #include <arpa/inet.h> // for htonl/ntohl
@@ -21,29 +23,26 @@ bool Message::serialize(std::vector<uint8_t>& out) const {
     if (!body_.empty()) {
         std::memcpy(out.data() + sizeof(net_len), body_.data(), body_.size());
     }
-    
-    // 解析protobuf消息以获取实际的消息类型
-    NetworkMessage pb_msg;
-    if (pb_msg.ParseFromArray(body_.data(), static_cast<int>(body_.size()))) {
-        spdlog::debug("Serialized message: type={}, body_size={}, total_size={}", 
-                     static_cast<int>(pb_msg.msg_id()), body_.size(), out.size());
-    } else {
-        spdlog::debug("Serialized message: body_size={}, total_size={}", 
-                     body_.size(), out.size());
-    }
+
+    CODEC_TRACE("Serialized message: type={}, body_size={}, total_size={}",
+                static_cast<int>(msg_type_), body_.size(), out.size());
     return true;
 }
 
 bool Message::deserialize(const std::vector<uint8_t>& in) {
+    return deserialize(in.data(), in.size());
+}
+
+bool Message::deserialize(const uint8_t* data, size_t size) {
     // 检查最小长度
-    if (in.size() < sizeof(uint32_t)) {
-        spdlog::error("Message too small for length header: {} bytes", in.size());
+    if (size < sizeof(uint32_t)) {
+        spdlog::error("Message too small for length header: {} bytes", size);
         return false;
     }
 
     // 读取并转换长度
     uint32_t net_len = 0;
-    std::memcpy(&net_len, in.data(), sizeof(net_len));
+    std::memcpy(&net_len, data, sizeof(net_len));
     uint32_t body_len = ntohl(net_len);
 
     // 检查消息体大小是否合理
@@ -53,32 +52,184 @@ bool Message::deserialize(const std::vector<uint8_t>& in) {
     }
 
     // 检查总长度是否匹配
-    if (in.size() != sizeof(uint32_t) + body_len) {
+    if (size != sizeof(uint32_t) + body_len) {
         spdlog::error("Invalid message size: got {} bytes, expected {} bytes", 
-                     in.size(), sizeof(uint32_t) + body_len);
+                     size, sizeof(uint32_t) + body_len);
         return false;
     }
 
-    // 复制消息体
-    body_.resize(body_len);
-    if (body_len > 0) {
-        std::memcpy(body_.data(), in.data() + sizeof(uint32_t), body_len);
+    return deserializeBody(data + sizeof(uint32_t), body_len);
+}
+
+bool Message::deserializeBody(const uint8_t* body, size_t len) {
+    // 复制到 slab 中
+    return deserializeBody(BufferSlice::copyOf(body, len));
+}
+
+bool Message::deserializeBody(BufferSlice body) {
+    body_ = std::move(body);
+    proto_.reset();
+
+    // 只读出消息头，后续的 C++/Lua 处理器需要时再解析（结果缓存）
+    MessageHeader header;
+    if (!peekHeader(body_.data(), body_.size(), header)) {
+        spdlog::error("Failed to parse protobuf message");
+        return false;
     }
+    msg_type_ = header.type;
+    player_id_ = header.player_id;
+    capabilities_ = header.capabilities;
+    CODEC_TRACE("Deserialized message: type={}, body_size={}", static_cast<int>(msg_type_), body_.size());
+    return true;
+}
+
+namespace {
 
-    // 尝试从protobuf消息中获取类型
-    NetworkMessage pb_msg;
-    if (pb_msg.ParseFromArray(body_.data(), static_cast<int>(body_len))) {
-        msg_type_ = static_cast<MessageType>(pb_msg.msg_id());
-        spdlog::debug("Deserialized message: type={}, body_size={}, total_size={}", 
-                     static_cast<int>(msg_type_), body_len, in.size());
-        return true;
+// 读一个 varint（最多 10 字节），越界或过长时返回 false
+inline bool readVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        uint8_t byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
     }
+    return false;
+}
 
-    spdlog::error("Failed to parse protobuf message");
+// 读一个 tag：与 protobuf 一致，最多 5 字节、超出 32 位的高位丢弃，字段号为 0 时视为非法
+inline bool readTag(const uint8_t*& p, const uint8_t* end, uint32_t& tag) {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 35 && p < end; shift += 7) {
+        uint8_t byte = *p++;
+        value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            tag = value;
+            return (value >> 3) != 0;
+        }
+    }
     return false;
 }
 
+// 与 protobuf 默认解析器相同的嵌套上限
+constexpr int MAX_GROUP_DEPTH = 100;
+
+// 跳过一个字段的值，group 递归跳到对应的结束标记
+bool skipField(const uint8_t*& p, const uint8_t* end, uint32_t tag, int depth) {
+    uint64_t value;
+    switch (tag & 0x7) {
+        case 0:  // varint
+            return readVarint(p, end, value);
+        case 1:  // 64 位定长
+            if (end - p < 8) {
+                return false;
+            }
+            p += 8;
+            return true;
+        case 2:  // 长度前缀
+            if (!readVarint(p, end, value) || value > static_cast<uint64_t>(end - p)) {
+                return false;
+            }
+            p += value;
+            return true;
+        case 3:  // group 已废弃，NetworkMessage 中不会出现，但作为未知字段 protobuf 仍接受
+            if (depth >= MAX_GROUP_DEPTH) {
+                return false;
+            }
+            while (p < end) {
+                uint32_t inner;
+                if (!readTag(p, end, inner)) {
+                    return false;
+                }
+                if ((inner & 0x7) == 4) {
+                    return (inner >> 3) == (tag >> 3);
+                }
+                if (!skipField(p, end, inner, depth + 1)) {
+                    return false;
+                }
+            }
+            return false;
+        case 5:  // 32 位定长
+            if (end - p < 4) {
+                return false;
+            }
+            p += 4;
+            return true;
+        default:  // 没有对应开始标记的 group 结束标记，以及类型 6、7
+            return false;
+    }
+}
+
+} // namespace
+
+bool Message::peekHeader(const uint8_t* body, size_t len, MessageHeader& out) {
+    // proto3 省略默认值：未出现的字段为 0（msg_id 为 HEARTBEAT）
+    out = MessageHeader();
+
+    // NetworkMessage 顶层只有几个字段，子消息按长度整体跳过，扫完整个顶层与 protobuf 的
+    // “重复出现时以最后一次为准”保持一致
+    const uint8_t* p = body;
+    const uint8_t* end = body + len;
+    while (p < end) {
+        uint32_t tag;
+        if (!readTag(p, end, tag)) {
+            return false;
+        }
+        // 关心的字段都是 varint；线格式不符的已知字段与未知字段一样跳过
+        if ((tag & 0x7) != 0) {
+            if (!skipField(p, end, tag, 0)) {
+                return false;
+            }
+            continue;
+        }
+        uint64_t value;
+        if (!readVarint(p, end, value)) {
+            return false;
+        }
+        uint32_t field = tag >> 3;
+        if (field == NetworkMessage::kMsgIdFieldNumber) {
+            out.type = static_cast<MessageType>(static_cast<int32_t>(value));
+        } else if (field == NetworkMessage::kPlayerIdFieldNumber) {
+            out.player_id = static_cast<uint32_t>(value);
+        } else if (field == NetworkMessage::kCapabilitiesFieldNumber) {
+            out.capabilities = static_cast<uint32_t>(value);
+        }
+    }
+    return true;
+}
+
+bool Message::nextInBatch(const uint8_t*& p, const uint8_t* end, const uint8_t*& body, size_t& len) {
+    // MessageBatch 只有一个 repeated bytes 字段，每项为 tag + 长度 + 消息体
+    uint64_t tag;
+    uint64_t value;
+    if (!readVarint(p, end, tag) || tag != ((MessageBatch::kMessagesFieldNumber << 3) | 2) ||
+        !readVarint(p, end, value) || value > static_cast<uint64_t>(end - p)) {
+        return false;
+    }
+    body = p;
+    len = static_cast<size_t>(value);
+    p += len;
+    return true;
+}
+
+const NetworkMessage* Message::getProto() const {
+    if (!proto_) {
+        // 分配在当前线程的批次 Arena 上，整批一起回收
+        auto pb_msg = ProtoArena::newNetworkMessage();
+        if (!pb_msg->ParseFromArray(body_.data(), static_cast<int>(body_.size()))) {
+            return nullptr;
+        }
+        proto_ = std::move(pb_msg);
+    }
+    return proto_.get();
+}
+
 void Message::logMessage() const {
+    // 逐字节格式化开销较大，debug 级别未开启时直接返回
+    if (!spdlog::should_log(spdlog::level::debug)) {
+        return;
+    }
     spdlog::debug("消息详情:");
     spdlog::debug("  - 类型: {}", static_cast<int>(msg_type_));
     spdlog::debug("  - 大小: {}", body_.size());
@@ -1,27 +1,60 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <google/protobuf/message.h>
 #include "NetworkMessage.pb.h"
+#include "MessageBuffer.h"
+
+// 不经完整解析即可读出的消息头（NetworkMessage 的 msg_id、player_id 和 capabilities）
+struct MessageHeader {
+    MessageType type = MessageType::HEARTBEAT;
+    uint32_t player_id = 0;
+    uint32_t capabilities = 0;
+};
+
+// 帧格式：4 字节长度前缀（网络字节序）+ 消息体。长度前缀的高 8 位为标志位，低 24 位为消息体长度
+constexpr uint32_t FRAME_LENGTH_MASK = 0x00FFFFFFu;
+constexpr uint32_t FRAME_FLAGS_MASK = 0xFF000000u;
+constexpr uint32_t FRAME_FLAG_BATCH = 0x80000000u;       // 消息体为 MessageBatch
+constexpr uint32_t FRAME_FLAG_COMPRESSED = 0x40000000u;  // 消息体经压缩，解压后再按其余标志处理
 
 // 基础消息类
 class Message {
 public:
     Message() = default;
-    Message(MessageType type, const std::vector<uint8_t>& body = {})
+    Message(MessageType type, BufferSlice body = BufferSlice())
         : msg_type_(type)
-        , body_(body) {}
+        , body_(std::move(body)) {}
 
     // 序列化和反序列化
     bool serialize(std::vector<uint8_t>& out) const;
     bool deserialize(const std::vector<uint8_t>& in);
+    bool deserialize(const uint8_t* data, size_t size);
+    // 解析不带长度前缀的消息体（如UDP数据报）
+    // 只扫描线格式读出消息头，完整解析推迟到 getProto()
+    bool deserializeBody(const uint8_t* body, size_t len);
+    // 同上，直接引用已有的缓冲区切片，不复制
+    bool deserializeBody(BufferSlice body);
+
+    // 直接在线格式上扫描顶层字段，读出消息头（跳过其余字段，不分配内存）；
+    // 线格式非法时返回 false。用于在完整解析前分发、过滤或丢弃消息
+    static bool peekHeader(const uint8_t* body, size_t len, MessageHeader& out);
+
+    // 从 MessageBatch 的线格式中取出下一条消息体（指向原缓冲区，不复制），p 前进到其后；
+    // 线格式非法时返回 false。调用方在 p < end 时循环调用
+    static bool nextInBatch(const uint8_t*& p, const uint8_t* end, const uint8_t*& body, size_t& len);
 
     // 获取消息信息
     MessageType getType() const { return msg_type_; }
-    const std::vector<uint8_t>& getBody() const { return body_; }
+    uint32_t getPlayerId() const { return player_id_; }
+    // 客户端声明的 Capability 位掩码
+    uint32_t getCapabilities() const { return capabilities_; }
+    // 消息体为只读切片，拷贝 Message 只增加引用计数
+    const BufferSlice& getBody() const { return body_; }
     size_t getSize() const { return sizeof(uint32_t) + body_.size(); }
 
     // 打印消息详情
@@ -30,10 +63,21 @@ public:
     // 用protobuf对象设置body
     template<typename ProtoMsg>
     void setBodyFromProto(const ProtoMsg& proto) {
-        body_.resize(proto.ByteSizeLong());
-        proto.SerializeToArray(body_.data(), static_cast<int>(body_.size()));
+        size_t len = proto.ByteSizeLong();
+        uint8_t* out = nullptr;
+        body_ = BufferSlice::allocate(len, out);
+        if (len > 0) {
+            proto.SerializeWithCachedSizesToArray(out);
+        }
+        proto_.reset();
     }
 
+    // 解析后的消息体：首次访问时解析并缓存，解析失败返回 nullptr。
+    // 拷贝出的 Message 共享同一份解析结果；同一对象不要在多个线程上同时首次访问
+    const NetworkMessage* getProto() const;
+    // 同上，供需要在消息之外保留解析结果的调用方（如 Lua 视图）
+    std::shared_ptr<const NetworkMessage> getSharedProto() const { return getProto() ? proto_ : nullptr; }
+
     // 获取body为protobuf对象
     template<typename ProtoMsg>
     bool getBodyAsProto(ProtoMsg& proto) const {
@@ -45,5 +89,8 @@ public:
 
 private:
     MessageType msg_type_;
-    std::vector<uint8_t> body_;
+    uint32_t player_id_ = 0;
+    uint32_t capabilities_ = 0;
+    BufferSlice body_;
+    mutable std::shared_ptr<const NetworkMessage> proto_;
 }; 
\ No newline at end of file
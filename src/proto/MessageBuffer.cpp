@@ -0,0 +1,110 @@
+#include "MessageBuffer.h"
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace {
+
+struct SlabPool {
+    std::mutex mutex;
+    std::vector<MessageBuffer*> free;
+};
+
+// 不析构：静态对象析构之后仍可能有切片被释放
+SlabPool& slabPool() {
+    static SlabPool* pool = new SlabPool();
+    return *pool;
+}
+
+// 当前线程正在切分的 slab
+struct SlabCursor {
+    MessageBuffer* slab = nullptr;
+    size_t used = 0;
+
+    ~SlabCursor() {
+        if (slab) {
+            slab->release();
+        }
+    }
+};
+
+thread_local SlabCursor slab_cursor;
+
+} // namespace
+
+MessageBuffer* MessageBuffer::allocate(size_t capacity) {
+    if (capacity == SLAB_SIZE) {
+        SlabPool& pool = slabPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (!pool.free.empty()) {
+            MessageBuffer* buffer = pool.free.back();
+            pool.free.pop_back();
+            buffer->refs_.store(1, std::memory_order_relaxed);
+            return buffer;
+        }
+    }
+
+    // 对象和数据一次分配
+    void* mem = ::operator new(sizeof(MessageBuffer) + capacity);
+    return new (mem) MessageBuffer(static_cast<uint8_t*>(mem) + sizeof(MessageBuffer), capacity);
+}
+
+void MessageBuffer::release() {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    if (capacity_ == SLAB_SIZE) {
+        SlabPool& pool = slabPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (pool.free.size() < MAX_POOLED_SLABS) {
+            pool.free.push_back(this);
+            return;
+        }
+    }
+    this->~MessageBuffer();
+    ::operator delete(this);
+}
+
+BufferSlice BufferSlice::allocate(size_t len, uint8_t*& writable) {
+    if (len == 0) {
+        writable = nullptr;
+        return BufferSlice();
+    }
+    if (len > MessageBuffer::MAX_SLAB_ALLOCATION) {
+        MessageBuffer* buffer = MessageBuffer::allocate(len);
+        writable = buffer->data();
+        return BufferSlice(buffer, writable, len);
+    }
+
+    SlabCursor& cursor = slab_cursor;
+    if (!cursor.slab || MessageBuffer::SLAB_SIZE - cursor.used < len) {
+        // 旧 slab 由其上仍存活的切片持有，全部释放后回到池中
+        if (cursor.slab) {
+            cursor.slab->release();
+        }
+        cursor.slab = MessageBuffer::allocate(MessageBuffer::SLAB_SIZE);
+        cursor.used = 0;
+    }
+    writable = cursor.slab->data() + cursor.used;
+    cursor.used += len;
+    cursor.slab->retain();
+    return BufferSlice(cursor.slab, writable, len);
+}
+
+BufferSlice BufferSlice::copyOf(const void* data, size_t len) {
+    uint8_t* out = nullptr;
+    BufferSlice slice = allocate(len, out);
+    if (len > 0) {
+        std::memcpy(out, data, len);
+    }
+    return slice;
+}
+
+BufferSlice BufferSlice::slice(size_t offset, size_t len) const {
+    if (len == 0 || offset + len > size_) {
+        return BufferSlice();
+    }
+    buffer_->retain();
+    return BufferSlice(buffer_, data_ + offset, len);
+}
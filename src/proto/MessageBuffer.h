@@ -0,0 +1,112 @@
+/**
+ * @file MessageBuffer.h
+ * @brief 引用计数的不可变消息缓冲区
+ *
+ * 该模块负责：
+ * - 入站消息体从 slab（SLAB_SIZE 字节的大块内存）中按顺序切出，每个线程持有一个当前 slab，
+ *   小消息不再各自分配内存
+ * - BufferSlice 是对 slab 中一段字节的只读视图，复制视图只增加引用计数；同一批次帧或解压后的
+ *   帧只复制一次，其中各消息都是它的切片
+ * - slab 的最后一个引用释放后回到全局池（有上限），大消息使用独立分配的缓冲区
+ *
+ * 切片可以跨线程传递和释放（引用计数为原子操作）。切片发布给其他线程之前写入其内容，
+ * 之后不再修改。一个存活的切片会让整个 slab 无法回收，长期保存消息内容时应另行复制。
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+class MessageBuffer {
+public:
+    // 分配 capacity 字节的缓冲区，引用计数初始为 1；slab（capacity 为 SLAB_SIZE）优先从池中取
+    static MessageBuffer* allocate(size_t capacity);
+
+    void retain() { refs_.fetch_add(1, std::memory_order_relaxed); }
+    void release();
+
+    uint8_t* data() { return data_; }
+    const uint8_t* data() const { return data_; }
+    size_t capacity() const { return capacity_; }
+
+    static constexpr size_t SLAB_SIZE = 16 * 1024;
+    // 超过此值的消息不占用 slab，单独分配
+    static constexpr size_t MAX_SLAB_ALLOCATION = SLAB_SIZE / 4;
+    // 池中最多保留的空闲 slab 数
+    static constexpr size_t MAX_POOLED_SLABS = 256;
+
+private:
+    MessageBuffer(uint8_t* data, size_t capacity) : refs_(1), data_(data), capacity_(capacity) {}
+    ~MessageBuffer() = default;
+
+    MessageBuffer(const MessageBuffer&) = delete;
+    MessageBuffer& operator=(const MessageBuffer&) = delete;
+
+    std::atomic<int> refs_;
+    uint8_t* data_;       // 紧跟在对象之后的同一块内存
+    size_t capacity_;
+};
+
+class BufferSlice {
+public:
+    BufferSlice() : buffer_(nullptr), data_(nullptr), size_(0) {}
+    ~BufferSlice() { reset(); }
+
+    BufferSlice(const BufferSlice& other) : buffer_(other.buffer_), data_(other.data_), size_(other.size_) {
+        if (buffer_) {
+            buffer_->retain();
+        }
+    }
+    BufferSlice(BufferSlice&& other) noexcept : buffer_(other.buffer_), data_(other.data_), size_(other.size_) {
+        other.buffer_ = nullptr;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    BufferSlice& operator=(BufferSlice other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    // 从当前线程的 slab 中切出 len 字节，writable 指向这段空间，由调用方在发布切片前填好
+    static BufferSlice allocate(size_t len, uint8_t*& writable);
+    // 复制一段数据
+    static BufferSlice copyOf(const void* data, size_t len);
+
+    // 同一缓冲区上的子切片（offset + len 不超过当前切片），不复制
+    BufferSlice slice(size_t offset, size_t len) const;
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const uint8_t* begin() const { return data_; }
+    const uint8_t* end() const { return data_ + size_; }
+
+    void reset() {
+        if (buffer_) {
+            buffer_->release();
+        }
+        buffer_ = nullptr;
+        data_ = nullptr;
+        size_ = 0;
+    }
+    void swap(BufferSlice& other) noexcept {
+        std::swap(buffer_, other.buffer_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    // 接管 buffer 的一个引用
+    BufferSlice(MessageBuffer* buffer, const uint8_t* data, size_t size)
+        : buffer_(buffer), data_(data), size_(size) {}
+
+    MessageBuffer* buffer_;
+    const uint8_t* data_;
+    size_t size_;
+};
@@ -0,0 +1,31 @@
+/**
+ * @file MessageDispatch.h
+ * @brief 按消息类型直接索引的分发表
+ *
+ * 该模块负责：
+ * - 分发表的大小取自 NetworkMessage.proto 生成的 MessageType_ARRAYSIZE，新增消息类型只需修改 proto
+ * - 消息类型到下标的转换（越界的类型统一映射到 MESSAGE_TYPE_COUNT），分发只需一次数组访问
+ *
+ * C++ 处理器（CppEngine）与 Lua 处理器（LuaVM）各持有一张同样形状的表。
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "NetworkMessage.pb.h"
+
+// MessageType 的取值个数（最大值 + 1）
+constexpr size_t MESSAGE_TYPE_COUNT = static_cast<size_t>(MessageType_ARRAYSIZE);
+
+template <typename Entry>
+using DispatchTable = std::array<Entry, MESSAGE_TYPE_COUNT>;
+
+// 消息类型在分发表中的下标，超出 proto 定义的范围（含负值）时返回 MESSAGE_TYPE_COUNT
+constexpr size_t dispatchIndex(MessageType type) {
+    return static_cast<uint32_t>(type) < MESSAGE_TYPE_COUNT ? static_cast<uint32_t>(type) : MESSAGE_TYPE_COUNT;
+}
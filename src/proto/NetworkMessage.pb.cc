@@ -5,389 +5,492 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR Vector3::Vector3(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Vector3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Vector3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Vector3DefaultTypeInternal() {}
+  union {
+    Vector3 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Vector3DefaultTypeInternal _Vector3_default_instance_;
+PROTOBUF_CONSTEXPR PlayerAttributeMessage_AmmoEntry_DoNotUse::PlayerAttributeMessage_AmmoEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    PlayerAttributeMessage_AmmoEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal _PlayerAttributeMessage_AmmoEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR PlayerAttributeMessage_WeaponsEntry_DoNotUse::PlayerAttributeMessage_WeaponsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    PlayerAttributeMessage_WeaponsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal _PlayerAttributeMessage_WeaponsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR PlayerAttributeMessage::PlayerAttributeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ammo_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.weapons_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.player_id_)*/0u
+  , /*decltype(_impl_.health_)*/0
+  , /*decltype(_impl_.max_health_)*/0
+  , /*decltype(_impl_.armor_)*/0
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.kills_)*/0
+  , /*decltype(_impl_.deaths_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PlayerAttributeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerAttributeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerAttributeMessageDefaultTypeInternal() {}
+  union {
+    PlayerAttributeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerAttributeMessageDefaultTypeInternal _PlayerAttributeMessage_default_instance_;
+PROTOBUF_CONSTEXPR PlayerStateMessage::PlayerStateMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.compact_transform_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.rotation_)*/nullptr
+  , /*decltype(_impl_.attributes_)*/nullptr
+  , /*decltype(_impl_.player_id_)*/0u
+  , /*decltype(_impl_.is_alive_)*/false
+  , /*decltype(_impl_.team_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PlayerStateMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerStateMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerStateMessageDefaultTypeInternal() {}
+  union {
+    PlayerStateMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerStateMessageDefaultTypeInternal _PlayerStateMessage_default_instance_;
+PROTOBUF_CONSTEXPR HeartbeatMessage::HeartbeatMessage(
+    ::_pbi::ConstantInitialized) {}
+struct HeartbeatMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatMessageDefaultTypeInternal() {}
+  union {
+    HeartbeatMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatMessageDefaultTypeInternal _HeartbeatMessage_default_instance_;
+PROTOBUF_CONSTEXPR PlayerUpdateMessage::PlayerUpdateMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.position_x_)*/0
+  , /*decltype(_impl_.position_y_)*/0
+  , /*decltype(_impl_.position_z_)*/0
+  , /*decltype(_impl_.rotation_x_)*/0
+  , /*decltype(_impl_.rotation_y_)*/0
+  , /*decltype(_impl_.rotation_z_)*/0
+  , /*decltype(_impl_.velocity_x_)*/0
+  , /*decltype(_impl_.velocity_y_)*/0
+  , /*decltype(_impl_.velocity_z_)*/0
+  , /*decltype(_impl_.is_grounded_)*/false
+  , /*decltype(_impl_.health_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PlayerUpdateMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerUpdateMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerUpdateMessageDefaultTypeInternal() {}
+  union {
+    PlayerUpdateMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerUpdateMessageDefaultTypeInternal _PlayerUpdateMessage_default_instance_;
+PROTOBUF_CONSTEXPR CompactPlayerUpdate::CompactPlayerUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.health_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CompactPlayerUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompactPlayerUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompactPlayerUpdateDefaultTypeInternal() {}
+  union {
+    CompactPlayerUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompactPlayerUpdateDefaultTypeInternal _CompactPlayerUpdate_default_instance_;
+PROTOBUF_CONSTEXPR UdpBindMessage::UdpBindMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.token_)*/uint64_t{0u}
+  , /*decltype(_impl_.port_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UdpBindMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UdpBindMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UdpBindMessageDefaultTypeInternal() {}
+  union {
+    UdpBindMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UdpBindMessageDefaultTypeInternal _UdpBindMessage_default_instance_;
+PROTOBUF_CONSTEXPR EntityDelta::EntityDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.state_)*/nullptr
+  , /*decltype(_impl_.changed_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EntityDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EntityDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EntityDeltaDefaultTypeInternal() {}
+  union {
+    EntityDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EntityDeltaDefaultTypeInternal _EntityDelta_default_instance_;
+PROTOBUF_CONSTEXPR WorldSnapshot::WorldSnapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entities_)*/{}
+  , /*decltype(_impl_.removed_)*/{}
+  , /*decltype(_impl_._removed_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.sequence_)*/0u
+  , /*decltype(_impl_.baseline_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WorldSnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorldSnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorldSnapshotDefaultTypeInternal() {}
+  union {
+    WorldSnapshot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorldSnapshotDefaultTypeInternal _WorldSnapshot_default_instance_;
+PROTOBUF_CONSTEXPR SnapshotAck::SnapshotAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sequence_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SnapshotAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SnapshotAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SnapshotAckDefaultTypeInternal() {}
+  union {
+    SnapshotAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SnapshotAckDefaultTypeInternal _SnapshotAck_default_instance_;
+PROTOBUF_CONSTEXPR MessageBatch::MessageBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MessageBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageBatchDefaultTypeInternal() {}
+  union {
+    MessageBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageBatchDefaultTypeInternal _MessageBatch_default_instance_;
+PROTOBUF_CONSTEXPR NetworkMessage::NetworkMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_id_)*/0
+  , /*decltype(_impl_.player_id_)*/0u
+  , /*decltype(_impl_.timestamp_)*/0u
+  , /*decltype(_impl_.capabilities_)*/0u
+  , /*decltype(_impl_.data_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct NetworkMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetworkMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetworkMessageDefaultTypeInternal() {}
+  union {
+    NetworkMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetworkMessageDefaultTypeInternal _NetworkMessage_default_instance_;
+static ::_pb::Metadata file_level_metadata_NetworkMessage_2eproto[14];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_NetworkMessage_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_NetworkMessage_2eproto = nullptr;
 
-namespace protobuf_NetworkMessage_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_HeartbeatMessage;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PlayerAttributeMessage_AmmoEntry_DoNotUse;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PlayerAttributeMessage_WeaponsEntry_DoNotUse;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PlayerUpdateMessage;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Vector3;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_PlayerAttributeMessage;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_PlayerStateMessage;
-}  // namespace protobuf_NetworkMessage_2eproto
-class Vector3DefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Vector3>
-      _instance;
-} _Vector3_default_instance_;
-class PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PlayerAttributeMessage_AmmoEntry_DoNotUse>
-      _instance;
-} _PlayerAttributeMessage_AmmoEntry_DoNotUse_default_instance_;
-class PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PlayerAttributeMessage_WeaponsEntry_DoNotUse>
-      _instance;
-} _PlayerAttributeMessage_WeaponsEntry_DoNotUse_default_instance_;
-class PlayerAttributeMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PlayerAttributeMessage>
-      _instance;
-} _PlayerAttributeMessage_default_instance_;
-class PlayerStateMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PlayerStateMessage>
-      _instance;
-} _PlayerStateMessage_default_instance_;
-class HeartbeatMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<HeartbeatMessage>
-      _instance;
-} _HeartbeatMessage_default_instance_;
-class PlayerUpdateMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PlayerUpdateMessage>
-      _instance;
-} _PlayerUpdateMessage_default_instance_;
-class NetworkMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<NetworkMessage>
-      _instance;
-  const ::HeartbeatMessage* heartbeat_;
-  const ::PlayerUpdateMessage* player_update_;
-  const ::PlayerAttributeMessage* player_attribute_;
-  const ::PlayerStateMessage* player_state_;
-} _NetworkMessage_default_instance_;
-namespace protobuf_NetworkMessage_2eproto {
-static void InitDefaultsVector3() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_Vector3_default_instance_;
-    new (ptr) ::Vector3();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Vector3::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Vector3 =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsVector3}, {}};
-
-static void InitDefaultsPlayerAttributeMessage_AmmoEntry_DoNotUse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_PlayerAttributeMessage_AmmoEntry_DoNotUse_default_instance_;
-    new (ptr) ::PlayerAttributeMessage_AmmoEntry_DoNotUse();
-  }
-  ::PlayerAttributeMessage_AmmoEntry_DoNotUse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PlayerAttributeMessage_AmmoEntry_DoNotUse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPlayerAttributeMessage_AmmoEntry_DoNotUse}, {}};
-
-static void InitDefaultsPlayerAttributeMessage_WeaponsEntry_DoNotUse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_PlayerAttributeMessage_WeaponsEntry_DoNotUse_default_instance_;
-    new (ptr) ::PlayerAttributeMessage_WeaponsEntry_DoNotUse();
-  }
-  ::PlayerAttributeMessage_WeaponsEntry_DoNotUse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PlayerAttributeMessage_WeaponsEntry_DoNotUse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPlayerAttributeMessage_WeaponsEntry_DoNotUse}, {}};
-
-static void InitDefaultsPlayerAttributeMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_PlayerAttributeMessage_default_instance_;
-    new (ptr) ::PlayerAttributeMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::PlayerAttributeMessage::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_PlayerAttributeMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsPlayerAttributeMessage}, {
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerAttributeMessage_AmmoEntry_DoNotUse.base,
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerAttributeMessage_WeaponsEntry_DoNotUse.base,}};
-
-static void InitDefaultsPlayerStateMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_PlayerStateMessage_default_instance_;
-    new (ptr) ::PlayerStateMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::PlayerStateMessage::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_PlayerStateMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsPlayerStateMessage}, {
-      &protobuf_NetworkMessage_2eproto::scc_info_Vector3.base,
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerAttributeMessage.base,}};
-
-static void InitDefaultsHeartbeatMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_HeartbeatMessage_default_instance_;
-    new (ptr) ::HeartbeatMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::HeartbeatMessage::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_HeartbeatMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsHeartbeatMessage}, {}};
-
-static void InitDefaultsPlayerUpdateMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_PlayerUpdateMessage_default_instance_;
-    new (ptr) ::PlayerUpdateMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::PlayerUpdateMessage::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PlayerUpdateMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPlayerUpdateMessage}, {}};
-
-static void InitDefaultsNetworkMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_NetworkMessage_default_instance_;
-    new (ptr) ::NetworkMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::NetworkMessage::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<4> scc_info_NetworkMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 4, InitDefaultsNetworkMessage}, {
-      &protobuf_NetworkMessage_2eproto::scc_info_HeartbeatMessage.base,
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerUpdateMessage.base,
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerAttributeMessage.base,
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerStateMessage.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_Vector3.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PlayerAttributeMessage_AmmoEntry_DoNotUse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PlayerAttributeMessage_WeaponsEntry_DoNotUse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PlayerAttributeMessage.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PlayerStateMessage.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_HeartbeatMessage.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PlayerUpdateMessage.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_NetworkMessage.base);
-}
-
-::google::protobuf::Metadata file_level_metadata[8];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[1];
-
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_NetworkMessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Vector3, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Vector3, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Vector3, x_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Vector3, y_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Vector3, z_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, _has_bits_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Vector3, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::Vector3, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::Vector3, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, key_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_AmmoEntry_DoNotUse, value_),
   0,
   1,
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, _has_bits_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, key_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage_WeaponsEntry_DoNotUse, value_),
   0,
   1,
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.health_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.max_health_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.ammo_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.weapons_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.armor_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.score_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.kills_),
+  PROTOBUF_FIELD_OFFSET(::PlayerAttributeMessage, _impl_.deaths_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _impl_.rotation_),
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _impl_.attributes_),
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _impl_.is_alive_),
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _impl_.team_id_),
+  PROTOBUF_FIELD_OFFSET(::PlayerStateMessage, _impl_.compact_transform_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::HeartbeatMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.position_x_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.position_y_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.position_z_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.rotation_x_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.rotation_y_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.rotation_z_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.velocity_x_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.velocity_y_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.velocity_z_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.is_grounded_),
+  PROTOBUF_FIELD_OFFSET(::PlayerUpdateMessage, _impl_.health_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CompactPlayerUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CompactPlayerUpdate, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::CompactPlayerUpdate, _impl_.health_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::UdpBindMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::UdpBindMessage, _impl_.token_),
+  PROTOBUF_FIELD_OFFSET(::UdpBindMessage, _impl_.port_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::EntityDelta, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, player_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, health_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, max_health_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, ammo_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, weapons_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, armor_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, score_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, kills_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerAttributeMessage, deaths_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::EntityDelta, _impl_.changed_),
+  PROTOBUF_FIELD_OFFSET(::EntityDelta, _impl_.state_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerStateMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::WorldSnapshot, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerStateMessage, player_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerStateMessage, position_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerStateMessage, rotation_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerStateMessage, attributes_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerStateMessage, is_alive_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerStateMessage, team_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WorldSnapshot, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::WorldSnapshot, _impl_.baseline_),
+  PROTOBUF_FIELD_OFFSET(::WorldSnapshot, _impl_.entities_),
+  PROTOBUF_FIELD_OFFSET(::WorldSnapshot, _impl_.removed_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::HeartbeatMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SnapshotAck, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SnapshotAck, _impl_.sequence_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::MessageBatch, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, position_x_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, position_y_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, position_z_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, rotation_x_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, rotation_y_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, rotation_z_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, velocity_x_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, velocity_y_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, velocity_z_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, is_grounded_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::PlayerUpdateMessage, health_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MessageBatch, _impl_.messages_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::NetworkMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::NetworkMessage, _internal_metadata_),
   ~0u,  // no _extensions_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::NetworkMessage, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::NetworkMessage, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::NetworkMessage, msg_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::NetworkMessage, player_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::NetworkMessage, timestamp_),
-  offsetof(::NetworkMessageDefaultTypeInternal, heartbeat_),
-  offsetof(::NetworkMessageDefaultTypeInternal, player_update_),
-  offsetof(::NetworkMessageDefaultTypeInternal, player_attribute_),
-  offsetof(::NetworkMessageDefaultTypeInternal, player_state_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::NetworkMessage, data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetworkMessage, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::NetworkMessage, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::NetworkMessage, _impl_.timestamp_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::NetworkMessage, _impl_.capabilities_),
+  PROTOBUF_FIELD_OFFSET(::NetworkMessage, _impl_.data_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::Vector3)},
-  { 8, 15, sizeof(::PlayerAttributeMessage_AmmoEntry_DoNotUse)},
-  { 17, 24, sizeof(::PlayerAttributeMessage_WeaponsEntry_DoNotUse)},
-  { 26, -1, sizeof(::PlayerAttributeMessage)},
-  { 40, -1, sizeof(::PlayerStateMessage)},
-  { 51, -1, sizeof(::HeartbeatMessage)},
-  { 56, -1, sizeof(::PlayerUpdateMessage)},
-  { 72, -1, sizeof(::NetworkMessage)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Vector3)},
+  { 9, 17, -1, sizeof(::PlayerAttributeMessage_AmmoEntry_DoNotUse)},
+  { 19, 27, -1, sizeof(::PlayerAttributeMessage_WeaponsEntry_DoNotUse)},
+  { 29, -1, -1, sizeof(::PlayerAttributeMessage)},
+  { 44, -1, -1, sizeof(::PlayerStateMessage)},
+  { 57, -1, -1, sizeof(::HeartbeatMessage)},
+  { 63, -1, -1, sizeof(::PlayerUpdateMessage)},
+  { 80, -1, -1, sizeof(::CompactPlayerUpdate)},
+  { 88, -1, -1, sizeof(::UdpBindMessage)},
+  { 96, -1, -1, sizeof(::EntityDelta)},
+  { 104, -1, -1, sizeof(::WorldSnapshot)},
+  { 114, -1, -1, sizeof(::SnapshotAck)},
+  { 121, -1, -1, sizeof(::MessageBatch)},
+  { 128, -1, -1, sizeof(::NetworkMessage)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_Vector3_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_PlayerAttributeMessage_AmmoEntry_DoNotUse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_PlayerAttributeMessage_WeaponsEntry_DoNotUse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_PlayerAttributeMessage_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_PlayerStateMessage_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_HeartbeatMessage_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_PlayerUpdateMessage_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_NetworkMessage_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_Vector3_default_instance_._instance,
+  &::_PlayerAttributeMessage_AmmoEntry_DoNotUse_default_instance_._instance,
+  &::_PlayerAttributeMessage_WeaponsEntry_DoNotUse_default_instance_._instance,
+  &::_PlayerAttributeMessage_default_instance_._instance,
+  &::_PlayerStateMessage_default_instance_._instance,
+  &::_HeartbeatMessage_default_instance_._instance,
+  &::_PlayerUpdateMessage_default_instance_._instance,
+  &::_CompactPlayerUpdate_default_instance_._instance,
+  &::_UdpBindMessage_default_instance_._instance,
+  &::_EntityDelta_default_instance_._instance,
+  &::_WorldSnapshot_default_instance_._instance,
+  &::_SnapshotAck_default_instance_._instance,
+  &::_MessageBatch_default_instance_._instance,
+  &::_NetworkMessage_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "NetworkMessage.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, file_level_enum_descriptors, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 8);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\024NetworkMessage.proto\"*\n\007Vector3\022\t\n\001x\030\001"
-      " \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"\321\002\n\026PlayerAtt"
-      "ributeMessage\022\021\n\tplayer_id\030\001 \001(\r\022\016\n\006heal"
-      "th\030\002 \001(\002\022\022\n\nmax_health\030\003 \001(\002\022/\n\004ammo\030\004 \003"
-      "(\0132!.PlayerAttributeMessage.AmmoEntry\0225\n"
-      "\007weapons\030\005 \003(\0132$.PlayerAttributeMessage."
-      "WeaponsEntry\022\r\n\005armor\030\006 \001(\002\022\r\n\005score\030\007 \001"
-      "(\005\022\r\n\005kills\030\010 \001(\005\022\016\n\006deaths\030\t \001(\005\032+\n\tAmm"
-      "oEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:\0028\001\032."
-      "\n\014WeaponsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001"
-      "(\005:\0028\001\"\257\001\n\022PlayerStateMessage\022\021\n\tplayer_"
-      "id\030\001 \001(\r\022\032\n\010position\030\002 \001(\0132\010.Vector3\022\032\n\010"
-      "rotation\030\003 \001(\0132\010.Vector3\022+\n\nattributes\030\004"
-      " \001(\0132\027.PlayerAttributeMessage\022\020\n\010is_aliv"
-      "e\030\005 \001(\010\022\017\n\007team_id\030\006 \001(\r\"\022\n\020HeartbeatMes"
-      "sage\"\356\001\n\023PlayerUpdateMessage\022\022\n\nposition"
-      "_x\030\001 \001(\002\022\022\n\nposition_y\030\002 \001(\002\022\022\n\nposition"
-      "_z\030\003 \001(\002\022\022\n\nrotation_x\030\004 \001(\002\022\022\n\nrotation"
-      "_y\030\005 \001(\002\022\022\n\nrotation_z\030\006 \001(\002\022\022\n\nvelocity"
-      "_x\030\007 \001(\002\022\022\n\nvelocity_y\030\010 \001(\002\022\022\n\nvelocity"
-      "_z\030\t \001(\002\022\023\n\013is_grounded\030\n \001(\010\022\016\n\006health\030"
-      "\013 \001(\002\"\225\002\n\016NetworkMessage\022\034\n\006msg_id\030\001 \001(\016"
-      "2\014.MessageType\022\021\n\tplayer_id\030\002 \001(\r\022\021\n\ttim"
-      "estamp\030\003 \001(\r\022&\n\theartbeat\030\004 \001(\0132\021.Heartb"
-      "eatMessageH\000\022-\n\rplayer_update\030\005 \001(\0132\024.Pl"
-      "ayerUpdateMessageH\000\0223\n\020player_attribute\030"
-      "\006 \001(\0132\027.PlayerAttributeMessageH\000\022+\n\014play"
-      "er_state\030\007 \001(\0132\023.PlayerStateMessageH\000B\006\n"
-      "\004data*z\n\013MessageType\022\r\n\tHEARTBEAT\020\000\022\021\n\rP"
-      "LAYER_UPDATE\020\001\022\024\n\020PLAYER_ATTRIBUTE\020\002\022\020\n\014"
-      "PLAYER_STATE\020\003\022\017\n\013PLAYER_JOIN\020\004\022\020\n\014PLAYE"
-      "R_LEAVE\020\005b\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1257);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "NetworkMessage.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_NetworkMessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024NetworkMessage.proto\"*\n\007Vector3\022\t\n\001x\030\001"
+  " \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"\321\002\n\026PlayerAtt"
+  "ributeMessage\022\021\n\tplayer_id\030\001 \001(\r\022\016\n\006heal"
+  "th\030\002 \001(\002\022\022\n\nmax_health\030\003 \001(\002\022/\n\004ammo\030\004 \003"
+  "(\0132!.PlayerAttributeMessage.AmmoEntry\0225\n"
+  "\007weapons\030\005 \003(\0132$.PlayerAttributeMessage."
+  "WeaponsEntry\022\r\n\005armor\030\006 \001(\002\022\r\n\005score\030\007 \001"
+  "(\005\022\r\n\005kills\030\010 \001(\005\022\016\n\006deaths\030\t \001(\005\032+\n\tAmm"
+  "oEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:\0028\001\032."
+  "\n\014WeaponsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001"
+  "(\005:\0028\001\"\312\001\n\022PlayerStateMessage\022\021\n\tplayer_"
+  "id\030\001 \001(\r\022\032\n\010position\030\002 \001(\0132\010.Vector3\022\032\n\010"
+  "rotation\030\003 \001(\0132\010.Vector3\022+\n\nattributes\030\004"
+  " \001(\0132\027.PlayerAttributeMessage\022\020\n\010is_aliv"
+  "e\030\005 \001(\010\022\017\n\007team_id\030\006 \001(\r\022\031\n\021compact_tran"
+  "sform\030\007 \001(\014\"\022\n\020HeartbeatMessage\"\356\001\n\023Play"
+  "erUpdateMessage\022\022\n\nposition_x\030\001 \001(\002\022\022\n\np"
+  "osition_y\030\002 \001(\002\022\022\n\nposition_z\030\003 \001(\002\022\022\n\nr"
+  "otation_x\030\004 \001(\002\022\022\n\nrotation_y\030\005 \001(\002\022\022\n\nr"
+  "otation_z\030\006 \001(\002\022\022\n\nvelocity_x\030\007 \001(\002\022\022\n\nv"
+  "elocity_y\030\010 \001(\002\022\022\n\nvelocity_z\030\t \001(\002\022\023\n\013i"
+  "s_grounded\030\n \001(\010\022\016\n\006health\030\013 \001(\002\"4\n\023Comp"
+  "actPlayerUpdate\022\r\n\005state\030\001 \001(\014\022\016\n\006health"
+  "\030\002 \001(\r\"-\n\016UdpBindMessage\022\r\n\005token\030\001 \001(\006\022"
+  "\014\n\004port\030\002 \001(\r\"B\n\013EntityDelta\022\017\n\007changed\030"
+  "\001 \001(\r\022\"\n\005state\030\002 \001(\0132\023.PlayerStateMessag"
+  "e\"d\n\rWorldSnapshot\022\020\n\010sequence\030\001 \001(\r\022\020\n\010"
+  "baseline\030\002 \001(\r\022\036\n\010entities\030\003 \003(\0132\014.Entit"
+  "yDelta\022\017\n\007removed\030\004 \003(\r\"\037\n\013SnapshotAck\022\020"
+  "\n\010sequence\030\001 \001(\r\" \n\014MessageBatch\022\020\n\010mess"
+  "ages\030\001 \003(\014\"\327\003\n\016NetworkMessage\022\034\n\006msg_id\030"
+  "\001 \001(\0162\014.MessageType\022\021\n\tplayer_id\030\002 \001(\r\022\021"
+  "\n\ttimestamp\030\003 \001(\r\022&\n\theartbeat\030\004 \001(\0132\021.H"
+  "eartbeatMessageH\000\022-\n\rplayer_update\030\005 \001(\013"
+  "2\024.PlayerUpdateMessageH\000\0223\n\020player_attri"
+  "bute\030\006 \001(\0132\027.PlayerAttributeMessageH\000\022+\n"
+  "\014player_state\030\007 \001(\0132\023.PlayerStateMessage"
+  "H\000\022#\n\010udp_bind\030\010 \001(\0132\017.UdpBindMessageH\000\022"
+  "5\n\025player_update_compact\030\t \001(\0132\024.Compact"
+  "PlayerUpdateH\000\022(\n\016world_snapshot\030\013 \001(\0132\016"
+  ".WorldSnapshotH\000\022$\n\014snapshot_ack\030\014 \001(\0132\014"
+  ".SnapshotAckH\000\022\024\n\014capabilities\030\n \001(\rB\006\n\004"
+  "data*\256\001\n\013MessageType\022\r\n\tHEARTBEAT\020\000\022\021\n\rP"
+  "LAYER_UPDATE\020\001\022\024\n\020PLAYER_ATTRIBUTE\020\002\022\020\n\014"
+  "PLAYER_STATE\020\003\022\017\n\013PLAYER_JOIN\020\004\022\020\n\014PLAYE"
+  "R_LEAVE\020\005\022\014\n\010UDP_BIND\020\006\022\022\n\016WORLD_SNAPSHO"
+  "T\020\007\022\020\n\014SNAPSHOT_ACK\020\010*u\n\nCapability\022\023\n\017C"
+  "APABILITY_NONE\020\000\022 \n\034CAPABILITY_COMPACT_T"
+  "RANSFORM\020\001\022\024\n\020CAPABILITY_BATCH\020\002\022\032\n\026CAPA"
+  "BILITY_COMPRESSION\020\004b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_NetworkMessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_NetworkMessage_2eproto = {
+    false, false, 1988, descriptor_table_protodef_NetworkMessage_2eproto,
+    "NetworkMessage.proto",
+    &descriptor_table_NetworkMessage_2eproto_once, nullptr, 0, 14,
+    schemas, file_default_instances, TableStruct_NetworkMessage_2eproto::offsets,
+    file_level_metadata_NetworkMessage_2eproto, file_level_enum_descriptors_NetworkMessage_2eproto,
+    file_level_service_descriptors_NetworkMessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_NetworkMessage_2eproto_getter() {
+  return &descriptor_table_NetworkMessage_2eproto;
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_NetworkMessage_2eproto
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor() {
-  protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_NetworkMessage_2eproto::file_level_enum_descriptors[0];
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_NetworkMessage_2eproto(&descriptor_table_NetworkMessage_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_NetworkMessage_2eproto);
+  return file_level_enum_descriptors_NetworkMessage_2eproto[0];
 }
 bool MessageType_IsValid(int value) {
   switch (value) {
@@ -397,6 +500,25 @@ bool MessageType_IsValid(int value) {
     case 3:
     case 4:
     case 5:
+    case 6:
+    case 7:
+    case 8:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Capability_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_NetworkMessage_2eproto);
+  return file_level_enum_descriptors_NetworkMessage_2eproto[1];
+}
+bool Capability_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 4:
       return true;
     default:
       return false;
@@ -406,196 +528,165 @@ bool MessageType_IsValid(int value) {
 
 // ===================================================================
 
-void Vector3::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Vector3::kXFieldNumber;
-const int Vector3::kYFieldNumber;
-const int Vector3::kZFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Vector3::_Internal {
+ public:
+};
 
-Vector3::Vector3()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_NetworkMessage_2eproto::scc_info_Vector3.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Vector3)
+Vector3::Vector3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Vector3)
 }
 Vector3::Vector3(const Vector3& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&z_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(z_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Vector3* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
   // @@protoc_insertion_point(copy_constructor:Vector3)
 }
 
-void Vector3::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
+inline void Vector3::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Vector3::~Vector3() {
   // @@protoc_insertion_point(destructor:Vector3)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Vector3::SharedDtor() {
+inline void Vector3::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Vector3::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* Vector3::descriptor() {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Vector3& Vector3::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_NetworkMessage_2eproto::scc_info_Vector3.base);
-  return *internal_default_instance();
-}
-
 
 void Vector3::Clear() {
 // @@protoc_insertion_point(message_clear_start:Vector3)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
-  _internal_metadata_.Clear();
-}
-
-bool Vector3::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Vector3)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.z_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Vector3::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // float x = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &x_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float y = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &y_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float z = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &z_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Vector3)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Vector3)
-  return false;
-#undef DO_
-}
-
-void Vector3::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Vector3)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // float x = 1;
-  if (this->x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->x(), output);
-  }
-
-  // float y = 2;
-  if (this->y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->y(), output);
-  }
-
-  // float z = 3;
-  if (this->z() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->z(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Vector3)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Vector3::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Vector3::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Vector3)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float x = 1;
-  if (this->x() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->x(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
   // float y = 2;
-  if (this->y() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->y(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
   }
 
   // float z = 3;
-  if (this->z() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->z(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Vector3)
   return target;
@@ -605,69 +696,77 @@ size_t Vector3::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Vector3)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // float x = 1;
-  if (this->x() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     total_size += 1 + 4;
   }
 
   // float y = 2;
-  if (this->y() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     total_size += 1 + 4;
   }
 
   // float z = 3;
-  if (this->z() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Vector3::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Vector3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Vector3* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Vector3>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Vector3)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Vector3)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vector3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Vector3::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vector3::GetClassData() const { return &_class_data_; }
 
-void Vector3::MergeFrom(const Vector3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Vector3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void Vector3::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Vector3*>(&to_msg);
+  auto& from = static_cast<const Vector3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Vector3)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.x() != 0) {
-    set_x(from.x());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (from.y() != 0) {
-    set_y(from.y());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
-  if (from.z() != 0) {
-    set_z(from.z());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = from._internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    _this->_internal_set_z(from._internal_z());
   }
-}
-
-void Vector3::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Vector3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Vector3::CopyFrom(const Vector3& from) {
@@ -681,748 +780,507 @@ bool Vector3::IsInitialized() const {
   return true;
 }
 
-void Vector3::Swap(Vector3* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Vector3::InternalSwap(Vector3* other) {
   using std::swap;
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  swap(z_, other->z_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Vector3, _impl_.z_)
+      + sizeof(Vector3::_impl_.z_)
+      - PROTOBUF_FIELD_OFFSET(Vector3, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::google::protobuf::Metadata Vector3::GetMetadata() const {
-  protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Vector3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[0]);
 }
 
-
 // ===================================================================
 
 PlayerAttributeMessage_AmmoEntry_DoNotUse::PlayerAttributeMessage_AmmoEntry_DoNotUse() {}
-PlayerAttributeMessage_AmmoEntry_DoNotUse::PlayerAttributeMessage_AmmoEntry_DoNotUse(::google::protobuf::Arena* arena) : SuperType(arena) {}
+PlayerAttributeMessage_AmmoEntry_DoNotUse::PlayerAttributeMessage_AmmoEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
 void PlayerAttributeMessage_AmmoEntry_DoNotUse::MergeFrom(const PlayerAttributeMessage_AmmoEntry_DoNotUse& other) {
   MergeFromInternal(other);
 }
-::google::protobuf::Metadata PlayerAttributeMessage_AmmoEntry_DoNotUse::GetMetadata() const {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[1];
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerAttributeMessage_AmmoEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[1]);
 }
-void PlayerAttributeMessage_AmmoEntry_DoNotUse::MergeFrom(
-    const ::google::protobuf::Message& other) {
-  ::google::protobuf::Message::MergeFrom(other);
-}
-
 
 // ===================================================================
 
 PlayerAttributeMessage_WeaponsEntry_DoNotUse::PlayerAttributeMessage_WeaponsEntry_DoNotUse() {}
-PlayerAttributeMessage_WeaponsEntry_DoNotUse::PlayerAttributeMessage_WeaponsEntry_DoNotUse(::google::protobuf::Arena* arena) : SuperType(arena) {}
+PlayerAttributeMessage_WeaponsEntry_DoNotUse::PlayerAttributeMessage_WeaponsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
 void PlayerAttributeMessage_WeaponsEntry_DoNotUse::MergeFrom(const PlayerAttributeMessage_WeaponsEntry_DoNotUse& other) {
   MergeFromInternal(other);
 }
-::google::protobuf::Metadata PlayerAttributeMessage_WeaponsEntry_DoNotUse::GetMetadata() const {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[2];
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerAttributeMessage_WeaponsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[2]);
 }
-void PlayerAttributeMessage_WeaponsEntry_DoNotUse::MergeFrom(
-    const ::google::protobuf::Message& other) {
-  ::google::protobuf::Message::MergeFrom(other);
-}
-
 
 // ===================================================================
 
-void PlayerAttributeMessage::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PlayerAttributeMessage::kPlayerIdFieldNumber;
-const int PlayerAttributeMessage::kHealthFieldNumber;
-const int PlayerAttributeMessage::kMaxHealthFieldNumber;
-const int PlayerAttributeMessage::kAmmoFieldNumber;
-const int PlayerAttributeMessage::kWeaponsFieldNumber;
-const int PlayerAttributeMessage::kArmorFieldNumber;
-const int PlayerAttributeMessage::kScoreFieldNumber;
-const int PlayerAttributeMessage::kKillsFieldNumber;
-const int PlayerAttributeMessage::kDeathsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-PlayerAttributeMessage::PlayerAttributeMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerAttributeMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:PlayerAttributeMessage)
+class PlayerAttributeMessage::_Internal {
+ public:
+};
+
+PlayerAttributeMessage::PlayerAttributeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &PlayerAttributeMessage::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:PlayerAttributeMessage)
 }
 PlayerAttributeMessage::PlayerAttributeMessage(const PlayerAttributeMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ammo_.MergeFrom(from.ammo_);
-  weapons_.MergeFrom(from.weapons_);
-  ::memcpy(&player_id_, &from.player_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&deaths_) -
-    reinterpret_cast<char*>(&player_id_)) + sizeof(deaths_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerAttributeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.ammo_)*/{}
+    , /*decltype(_impl_.weapons_)*/{}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.health_){}
+    , decltype(_impl_.max_health_){}
+    , decltype(_impl_.armor_){}
+    , decltype(_impl_.score_){}
+    , decltype(_impl_.kills_){}
+    , decltype(_impl_.deaths_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.ammo_.MergeFrom(from._impl_.ammo_);
+  _this->_impl_.weapons_.MergeFrom(from._impl_.weapons_);
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deaths_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.deaths_));
   // @@protoc_insertion_point(copy_constructor:PlayerAttributeMessage)
 }
 
-void PlayerAttributeMessage::SharedCtor() {
-  ::memset(&player_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&deaths_) -
-      reinterpret_cast<char*>(&player_id_)) + sizeof(deaths_));
+inline void PlayerAttributeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.ammo_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.weapons_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.player_id_){0u}
+    , decltype(_impl_.health_){0}
+    , decltype(_impl_.max_health_){0}
+    , decltype(_impl_.armor_){0}
+    , decltype(_impl_.score_){0}
+    , decltype(_impl_.kills_){0}
+    , decltype(_impl_.deaths_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PlayerAttributeMessage::~PlayerAttributeMessage() {
   // @@protoc_insertion_point(destructor:PlayerAttributeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerAttributeMessage::SharedDtor() {
+inline void PlayerAttributeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ammo_.Destruct();
+  _impl_.ammo_.~MapField();
+  _impl_.weapons_.Destruct();
+  _impl_.weapons_.~MapField();
 }
 
-void PlayerAttributeMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* PlayerAttributeMessage::descriptor() {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+void PlayerAttributeMessage::ArenaDtor(void* object) {
+  PlayerAttributeMessage* _this = reinterpret_cast< PlayerAttributeMessage* >(object);
+  _this->_impl_.ammo_.Destruct();
+  _this->_impl_.weapons_.Destruct();
 }
-
-const PlayerAttributeMessage& PlayerAttributeMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_NetworkMessage_2eproto::scc_info_PlayerAttributeMessage.base);
-  return *internal_default_instance();
+void PlayerAttributeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
 void PlayerAttributeMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:PlayerAttributeMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ammo_.Clear();
-  weapons_.Clear();
-  ::memset(&player_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&deaths_) -
-      reinterpret_cast<char*>(&player_id_)) + sizeof(deaths_));
-  _internal_metadata_.Clear();
-}
-
-bool PlayerAttributeMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:PlayerAttributeMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.ammo_.Clear();
+  _impl_.weapons_.Clear();
+  ::memset(&_impl_.player_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.deaths_) -
+      reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.deaths_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerAttributeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 player_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &player_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float health = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &health_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.health_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float max_health = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &max_health_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.max_health_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // map<string, int32> ammo = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          PlayerAttributeMessage_AmmoEntry_DoNotUse::Parser< ::google::protobuf::internal::MapField<
-              PlayerAttributeMessage_AmmoEntry_DoNotUse,
-              ::std::string, ::google::protobuf::int32,
-              ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-              ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-              0 >,
-            ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 > > parser(&ammo_);
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-              input, &parser));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            parser.key().data(), static_cast<int>(parser.key().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "PlayerAttributeMessage.AmmoEntry.key"));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.ammo_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // map<string, int32> weapons = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          PlayerAttributeMessage_WeaponsEntry_DoNotUse::Parser< ::google::protobuf::internal::MapField<
-              PlayerAttributeMessage_WeaponsEntry_DoNotUse,
-              ::std::string, ::google::protobuf::int32,
-              ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-              ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-              0 >,
-            ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 > > parser(&weapons_);
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-              input, &parser));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            parser.key().data(), static_cast<int>(parser.key().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "PlayerAttributeMessage.WeaponsEntry.key"));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.weapons_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float armor = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(53u /* 53 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &armor_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.armor_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 score = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &score_)));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 kills = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &kills_)));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.kills_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 deaths = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &deaths_)));
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.deaths_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:PlayerAttributeMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:PlayerAttributeMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PlayerAttributeMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:PlayerAttributeMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PlayerAttributeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PlayerAttributeMessage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->player_id(), output);
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_player_id(), target);
   }
 
   // float health = 2;
-  if (this->health() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->health(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_health = this->_internal_health();
+  uint32_t raw_health;
+  memcpy(&raw_health, &tmp_health, sizeof(tmp_health));
+  if (raw_health != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_health(), target);
   }
 
   // float max_health = 3;
-  if (this->max_health() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->max_health(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_health = this->_internal_max_health();
+  uint32_t raw_max_health;
+  memcpy(&raw_max_health, &tmp_max_health, sizeof(tmp_max_health));
+  if (raw_max_health != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_max_health(), target);
   }
 
   // map<string, int32> ammo = 4;
-  if (!this->ammo().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "PlayerAttributeMessage.AmmoEntry.key");
-      }
+  if (!this->_internal_ammo().empty()) {
+    using MapType = ::_pb::Map<std::string, int32_t>;
+    using WireHelper = PlayerAttributeMessage_AmmoEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_ammo();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "PlayerAttributeMessage.AmmoEntry.key");
     };
 
-    if (output->IsSerializationDeterministic() &&
-        this->ammo().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->ammo().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->ammo().begin();
-          it != this->ammo().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      ::std::unique_ptr<PlayerAttributeMessage_AmmoEntry_DoNotUse> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(ammo_.NewEntryWrapper(
-            items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            4, *entry, output);
-        Utf8Check::Check(items[static_cast<ptrdiff_t>(i)]);
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     } else {
-      ::std::unique_ptr<PlayerAttributeMessage_AmmoEntry_DoNotUse> entry;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->ammo().begin();
-          it != this->ammo().end(); ++it) {
-        entry.reset(ammo_.NewEntryWrapper(
-            it->first, it->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            4, *entry, output);
-        Utf8Check::Check(&*it);
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     }
   }
 
   // map<string, int32> weapons = 5;
-  if (!this->weapons().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "PlayerAttributeMessage.WeaponsEntry.key");
-      }
+  if (!this->_internal_weapons().empty()) {
+    using MapType = ::_pb::Map<std::string, int32_t>;
+    using WireHelper = PlayerAttributeMessage_WeaponsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_weapons();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "PlayerAttributeMessage.WeaponsEntry.key");
     };
 
-    if (output->IsSerializationDeterministic() &&
-        this->weapons().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->weapons().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->weapons().begin();
-          it != this->weapons().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      ::std::unique_ptr<PlayerAttributeMessage_WeaponsEntry_DoNotUse> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(weapons_.NewEntryWrapper(
-            items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            5, *entry, output);
-        Utf8Check::Check(items[static_cast<ptrdiff_t>(i)]);
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(5, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     } else {
-      ::std::unique_ptr<PlayerAttributeMessage_WeaponsEntry_DoNotUse> entry;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->weapons().begin();
-          it != this->weapons().end(); ++it) {
-        entry.reset(weapons_.NewEntryWrapper(
-            it->first, it->second));
-        ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-            5, *entry, output);
-        Utf8Check::Check(&*it);
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(5, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     }
   }
 
   // float armor = 6;
-  if (this->armor() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->armor(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_armor = this->_internal_armor();
+  uint32_t raw_armor;
+  memcpy(&raw_armor, &tmp_armor, sizeof(tmp_armor));
+  if (raw_armor != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_armor(), target);
   }
 
   // int32 score = 7;
-  if (this->score() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->score(), output);
+  if (this->_internal_score() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_score(), target);
   }
 
   // int32 kills = 8;
-  if (this->kills() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(8, this->kills(), output);
+  if (this->_internal_kills() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_kills(), target);
   }
 
   // int32 deaths = 9;
-  if (this->deaths() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(9, this->deaths(), output);
+  if (this->_internal_deaths() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_deaths(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:PlayerAttributeMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:PlayerAttributeMessage)
+  return target;
 }
 
-::google::protobuf::uint8* PlayerAttributeMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:PlayerAttributeMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t PlayerAttributeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PlayerAttributeMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // map<string, int32> ammo = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_ammo_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >::const_iterator
+      it = this->_internal_ammo().begin();
+      it != this->_internal_ammo().end(); ++it) {
+    total_size += PlayerAttributeMessage_AmmoEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, int32> weapons = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_weapons_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >::const_iterator
+      it = this->_internal_weapons().begin();
+      it != this->_internal_weapons().end(); ++it) {
+    total_size += PlayerAttributeMessage_WeaponsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
   // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->player_id(), target);
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_player_id());
   }
 
   // float health = 2;
-  if (this->health() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->health(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_health = this->_internal_health();
+  uint32_t raw_health;
+  memcpy(&raw_health, &tmp_health, sizeof(tmp_health));
+  if (raw_health != 0) {
+    total_size += 1 + 4;
   }
 
   // float max_health = 3;
-  if (this->max_health() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->max_health(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_health = this->_internal_max_health();
+  uint32_t raw_max_health;
+  memcpy(&raw_max_health, &tmp_max_health, sizeof(tmp_max_health));
+  if (raw_max_health != 0) {
+    total_size += 1 + 4;
   }
 
-  // map<string, int32> ammo = 4;
-  if (!this->ammo().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "PlayerAttributeMessage.AmmoEntry.key");
-      }
-    };
-
-    if (deterministic &&
-        this->ammo().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->ammo().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->ammo().begin();
-          it != this->ammo().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      ::std::unique_ptr<PlayerAttributeMessage_AmmoEntry_DoNotUse> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(ammo_.NewEntryWrapper(
-            items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       4, *entry, deterministic, target);
-;
-        Utf8Check::Check(items[static_cast<ptrdiff_t>(i)]);
-      }
-    } else {
-      ::std::unique_ptr<PlayerAttributeMessage_AmmoEntry_DoNotUse> entry;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->ammo().begin();
-          it != this->ammo().end(); ++it) {
-        entry.reset(ammo_.NewEntryWrapper(
-            it->first, it->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       4, *entry, deterministic, target);
-;
-        Utf8Check::Check(&*it);
-      }
-    }
+  // float armor = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_armor = this->_internal_armor();
+  uint32_t raw_armor;
+  memcpy(&raw_armor, &tmp_armor, sizeof(tmp_armor));
+  if (raw_armor != 0) {
+    total_size += 1 + 4;
   }
 
-  // map<string, int32> weapons = 5;
-  if (!this->weapons().empty()) {
-    typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::google::protobuf::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-          "PlayerAttributeMessage.WeaponsEntry.key");
-      }
-    };
-
-    if (deterministic &&
-        this->weapons().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->weapons().size()]);
-      typedef ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::size_type size_type;
-      size_type n = 0;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->weapons().begin();
-          it != this->weapons().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      ::std::unique_ptr<PlayerAttributeMessage_WeaponsEntry_DoNotUse> entry;
-      for (size_type i = 0; i < n; i++) {
-        entry.reset(weapons_.NewEntryWrapper(
-            items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       5, *entry, deterministic, target);
-;
-        Utf8Check::Check(items[static_cast<ptrdiff_t>(i)]);
-      }
-    } else {
-      ::std::unique_ptr<PlayerAttributeMessage_WeaponsEntry_DoNotUse> entry;
-      for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-          it = this->weapons().begin();
-          it != this->weapons().end(); ++it) {
-        entry.reset(weapons_.NewEntryWrapper(
-            it->first, it->second));
-        target = ::google::protobuf::internal::WireFormatLite::
-                   InternalWriteMessageNoVirtualToArray(
-                       5, *entry, deterministic, target);
-;
-        Utf8Check::Check(&*it);
-      }
-    }
-  }
-
-  // float armor = 6;
-  if (this->armor() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->armor(), target);
-  }
-
-  // int32 score = 7;
-  if (this->score() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->score(), target);
-  }
+  // int32 score = 7;
+  if (this->_internal_score() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_score());
+  }
 
   // int32 kills = 8;
-  if (this->kills() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(8, this->kills(), target);
+  if (this->_internal_kills() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_kills());
   }
 
   // int32 deaths = 9;
-  if (this->deaths() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(9, this->deaths(), target);
+  if (this->_internal_deaths() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_deaths());
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:PlayerAttributeMessage)
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-size_t PlayerAttributeMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:PlayerAttributeMessage)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // map<string, int32> ammo = 4;
-  total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->ammo_size());
-  {
-    ::std::unique_ptr<PlayerAttributeMessage_AmmoEntry_DoNotUse> entry;
-    for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-        it = this->ammo().begin();
-        it != this->ammo().end(); ++it) {
-      entry.reset(ammo_.NewEntryWrapper(it->first, it->second));
-      total_size += ::google::protobuf::internal::WireFormatLite::
-          MessageSizeNoVirtual(*entry);
-    }
-  }
-
-  // map<string, int32> weapons = 5;
-  total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->weapons_size());
-  {
-    ::std::unique_ptr<PlayerAttributeMessage_WeaponsEntry_DoNotUse> entry;
-    for (::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >::const_iterator
-        it = this->weapons().begin();
-        it != this->weapons().end(); ++it) {
-      entry.reset(weapons_.NewEntryWrapper(it->first, it->second));
-      total_size += ::google::protobuf::internal::WireFormatLite::
-          MessageSizeNoVirtual(*entry);
-    }
-  }
-
-  // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->player_id());
-  }
-
-  // float health = 2;
-  if (this->health() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float max_health = 3;
-  if (this->max_health() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float armor = 6;
-  if (this->armor() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // int32 score = 7;
-  if (this->score() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->score());
-  }
-
-  // int32 kills = 8;
-  if (this->kills() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->kills());
-  }
-
-  // int32 deaths = 9;
-  if (this->deaths() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->deaths());
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerAttributeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerAttributeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerAttributeMessage::GetClassData() const { return &_class_data_; }
 
-void PlayerAttributeMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:PlayerAttributeMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PlayerAttributeMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PlayerAttributeMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:PlayerAttributeMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:PlayerAttributeMessage)
-    MergeFrom(*source);
-  }
-}
 
-void PlayerAttributeMessage::MergeFrom(const PlayerAttributeMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:PlayerAttributeMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void PlayerAttributeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerAttributeMessage*>(&to_msg);
+  auto& from = static_cast<const PlayerAttributeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PlayerAttributeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  ammo_.MergeFrom(from.ammo_);
-  weapons_.MergeFrom(from.weapons_);
-  if (from.player_id() != 0) {
-    set_player_id(from.player_id());
+  _this->_impl_.ammo_.MergeFrom(from._impl_.ammo_);
+  _this->_impl_.weapons_.MergeFrom(from._impl_.weapons_);
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
   }
-  if (from.health() != 0) {
-    set_health(from.health());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_health = from._internal_health();
+  uint32_t raw_health;
+  memcpy(&raw_health, &tmp_health, sizeof(tmp_health));
+  if (raw_health != 0) {
+    _this->_internal_set_health(from._internal_health());
   }
-  if (from.max_health() != 0) {
-    set_max_health(from.max_health());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_health = from._internal_max_health();
+  uint32_t raw_max_health;
+  memcpy(&raw_max_health, &tmp_max_health, sizeof(tmp_max_health));
+  if (raw_max_health != 0) {
+    _this->_internal_set_max_health(from._internal_max_health());
   }
-  if (from.armor() != 0) {
-    set_armor(from.armor());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_armor = from._internal_armor();
+  uint32_t raw_armor;
+  memcpy(&raw_armor, &tmp_armor, sizeof(tmp_armor));
+  if (raw_armor != 0) {
+    _this->_internal_set_armor(from._internal_armor());
   }
-  if (from.score() != 0) {
-    set_score(from.score());
+  if (from._internal_score() != 0) {
+    _this->_internal_set_score(from._internal_score());
   }
-  if (from.kills() != 0) {
-    set_kills(from.kills());
+  if (from._internal_kills() != 0) {
+    _this->_internal_set_kills(from._internal_kills());
   }
-  if (from.deaths() != 0) {
-    set_deaths(from.deaths());
+  if (from._internal_deaths() != 0) {
+    _this->_internal_set_deaths(from._internal_deaths());
   }
-}
-
-void PlayerAttributeMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:PlayerAttributeMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayerAttributeMessage::CopyFrom(const PlayerAttributeMessage& from) {
@@ -1436,336 +1294,295 @@ bool PlayerAttributeMessage::IsInitialized() const {
   return true;
 }
 
-void PlayerAttributeMessage::Swap(PlayerAttributeMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PlayerAttributeMessage::InternalSwap(PlayerAttributeMessage* other) {
   using std::swap;
-  ammo_.Swap(&other->ammo_);
-  weapons_.Swap(&other->weapons_);
-  swap(player_id_, other->player_id_);
-  swap(health_, other->health_);
-  swap(max_health_, other->max_health_);
-  swap(armor_, other->armor_);
-  swap(score_, other->score_);
-  swap(kills_, other->kills_);
-  swap(deaths_, other->deaths_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ammo_.InternalSwap(&other->_impl_.ammo_);
+  _impl_.weapons_.InternalSwap(&other->_impl_.weapons_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerAttributeMessage, _impl_.deaths_)
+      + sizeof(PlayerAttributeMessage::_impl_.deaths_)
+      - PROTOBUF_FIELD_OFFSET(PlayerAttributeMessage, _impl_.player_id_)>(
+          reinterpret_cast<char*>(&_impl_.player_id_),
+          reinterpret_cast<char*>(&other->_impl_.player_id_));
 }
 
-::google::protobuf::Metadata PlayerAttributeMessage::GetMetadata() const {
-  protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerAttributeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void PlayerStateMessage::InitAsDefaultInstance() {
-  ::_PlayerStateMessage_default_instance_._instance.get_mutable()->position_ = const_cast< ::Vector3*>(
-      ::Vector3::internal_default_instance());
-  ::_PlayerStateMessage_default_instance_._instance.get_mutable()->rotation_ = const_cast< ::Vector3*>(
-      ::Vector3::internal_default_instance());
-  ::_PlayerStateMessage_default_instance_._instance.get_mutable()->attributes_ = const_cast< ::PlayerAttributeMessage*>(
-      ::PlayerAttributeMessage::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PlayerStateMessage::kPlayerIdFieldNumber;
-const int PlayerStateMessage::kPositionFieldNumber;
-const int PlayerStateMessage::kRotationFieldNumber;
-const int PlayerStateMessage::kAttributesFieldNumber;
-const int PlayerStateMessage::kIsAliveFieldNumber;
-const int PlayerStateMessage::kTeamIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-PlayerStateMessage::PlayerStateMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerStateMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:PlayerStateMessage)
+class PlayerStateMessage::_Internal {
+ public:
+  static const ::Vector3& position(const PlayerStateMessage* msg);
+  static const ::Vector3& rotation(const PlayerStateMessage* msg);
+  static const ::PlayerAttributeMessage& attributes(const PlayerStateMessage* msg);
+};
+
+const ::Vector3&
+PlayerStateMessage::_Internal::position(const PlayerStateMessage* msg) {
+  return *msg->_impl_.position_;
+}
+const ::Vector3&
+PlayerStateMessage::_Internal::rotation(const PlayerStateMessage* msg) {
+  return *msg->_impl_.rotation_;
+}
+const ::PlayerAttributeMessage&
+PlayerStateMessage::_Internal::attributes(const PlayerStateMessage* msg) {
+  return *msg->_impl_.attributes_;
+}
+PlayerStateMessage::PlayerStateMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PlayerStateMessage)
 }
 PlayerStateMessage::PlayerStateMessage(const PlayerStateMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_position()) {
-    position_ = new ::Vector3(*from.position_);
-  } else {
-    position_ = NULL;
-  }
-  if (from.has_rotation()) {
-    rotation_ = new ::Vector3(*from.rotation_);
-  } else {
-    rotation_ = NULL;
-  }
-  if (from.has_attributes()) {
-    attributes_ = new ::PlayerAttributeMessage(*from.attributes_);
-  } else {
-    attributes_ = NULL;
-  }
-  ::memcpy(&player_id_, &from.player_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&team_id_) -
-    reinterpret_cast<char*>(&player_id_)) + sizeof(team_id_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerStateMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compact_transform_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.rotation_){nullptr}
+    , decltype(_impl_.attributes_){nullptr}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.is_alive_){}
+    , decltype(_impl_.team_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.compact_transform_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compact_transform_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_compact_transform().empty()) {
+    _this->_impl_.compact_transform_.Set(from._internal_compact_transform(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_position()) {
+    _this->_impl_.position_ = new ::Vector3(*from._impl_.position_);
+  }
+  if (from._internal_has_rotation()) {
+    _this->_impl_.rotation_ = new ::Vector3(*from._impl_.rotation_);
+  }
+  if (from._internal_has_attributes()) {
+    _this->_impl_.attributes_ = new ::PlayerAttributeMessage(*from._impl_.attributes_);
+  }
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.team_id_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.team_id_));
   // @@protoc_insertion_point(copy_constructor:PlayerStateMessage)
 }
 
-void PlayerStateMessage::SharedCtor() {
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&team_id_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(team_id_));
+inline void PlayerStateMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compact_transform_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.rotation_){nullptr}
+    , decltype(_impl_.attributes_){nullptr}
+    , decltype(_impl_.player_id_){0u}
+    , decltype(_impl_.is_alive_){false}
+    , decltype(_impl_.team_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.compact_transform_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compact_transform_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PlayerStateMessage::~PlayerStateMessage() {
   // @@protoc_insertion_point(destructor:PlayerStateMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerStateMessage::SharedDtor() {
-  if (this != internal_default_instance()) delete position_;
-  if (this != internal_default_instance()) delete rotation_;
-  if (this != internal_default_instance()) delete attributes_;
+inline void PlayerStateMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.compact_transform_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.position_;
+  if (this != internal_default_instance()) delete _impl_.rotation_;
+  if (this != internal_default_instance()) delete _impl_.attributes_;
 }
 
 void PlayerStateMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* PlayerStateMessage::descriptor() {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const PlayerStateMessage& PlayerStateMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_NetworkMessage_2eproto::scc_info_PlayerStateMessage.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void PlayerStateMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:PlayerStateMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && position_ != NULL) {
-    delete position_;
-  }
-  position_ = NULL;
-  if (GetArenaNoVirtual() == NULL && rotation_ != NULL) {
-    delete rotation_;
-  }
-  rotation_ = NULL;
-  if (GetArenaNoVirtual() == NULL && attributes_ != NULL) {
-    delete attributes_;
-  }
-  attributes_ = NULL;
-  ::memset(&player_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&team_id_) -
-      reinterpret_cast<char*>(&player_id_)) + sizeof(team_id_));
-  _internal_metadata_.Clear();
-}
-
-bool PlayerStateMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:PlayerStateMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.compact_transform_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
+  }
+  _impl_.position_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.rotation_ != nullptr) {
+    delete _impl_.rotation_;
+  }
+  _impl_.rotation_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.attributes_ != nullptr) {
+    delete _impl_.attributes_;
+  }
+  _impl_.attributes_ = nullptr;
+  ::memset(&_impl_.player_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.team_id_) -
+      reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.team_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerStateMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 player_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &player_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .Vector3 position = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_position()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .Vector3 rotation = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_rotation()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rotation(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .PlayerAttributeMessage attributes = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_attributes()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_attributes(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool is_alive = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_alive_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.is_alive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 team_id = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &team_id_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.team_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // bytes compact_transform = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_compact_transform();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:PlayerStateMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:PlayerStateMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PlayerStateMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:PlayerStateMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PlayerStateMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PlayerStateMessage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->player_id(), output);
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_player_id(), target);
   }
 
   // .Vector3 position = 2;
-  if (this->has_position()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_position(), output);
+  if (this->_internal_has_position()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // .Vector3 rotation = 3;
-  if (this->has_rotation()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_rotation(), output);
+  if (this->_internal_has_rotation()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::rotation(this),
+        _Internal::rotation(this).GetCachedSize(), target, stream);
   }
 
   // .PlayerAttributeMessage attributes = 4;
-  if (this->has_attributes()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->_internal_attributes(), output);
+  if (this->_internal_has_attributes()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::attributes(this),
+        _Internal::attributes(this).GetCachedSize(), target, stream);
   }
 
   // bool is_alive = 5;
-  if (this->is_alive() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->is_alive(), output);
+  if (this->_internal_is_alive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_is_alive(), target);
   }
 
   // uint32 team_id = 6;
-  if (this->team_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->team_id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:PlayerStateMessage)
-}
-
-::google::protobuf::uint8* PlayerStateMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:PlayerStateMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->player_id(), target);
-  }
-
-  // .Vector3 position = 2;
-  if (this->has_position()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_position(), deterministic, target);
-  }
-
-  // .Vector3 rotation = 3;
-  if (this->has_rotation()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_rotation(), deterministic, target);
-  }
-
-  // .PlayerAttributeMessage attributes = 4;
-  if (this->has_attributes()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        4, this->_internal_attributes(), deterministic, target);
-  }
-
-  // bool is_alive = 5;
-  if (this->is_alive() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->is_alive(), target);
+  if (this->_internal_team_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_team_id(), target);
   }
 
-  // uint32 team_id = 6;
-  if (this->team_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->team_id(), target);
+  // bytes compact_transform = 7;
+  if (!this->_internal_compact_transform().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_compact_transform(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:PlayerStateMessage)
   return target;
@@ -1775,103 +1592,96 @@ size_t PlayerStateMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:PlayerStateMessage)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes compact_transform = 7;
+  if (!this->_internal_compact_transform().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_compact_transform());
   }
+
   // .Vector3 position = 2;
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *position_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.position_);
   }
 
   // .Vector3 rotation = 3;
-  if (this->has_rotation()) {
+  if (this->_internal_has_rotation()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *rotation_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rotation_);
   }
 
   // .PlayerAttributeMessage attributes = 4;
-  if (this->has_attributes()) {
+  if (this->_internal_has_attributes()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *attributes_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.attributes_);
   }
 
   // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->player_id());
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_player_id());
   }
 
   // bool is_alive = 5;
-  if (this->is_alive() != 0) {
+  if (this->_internal_is_alive() != 0) {
     total_size += 1 + 1;
   }
 
   // uint32 team_id = 6;
-  if (this->team_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->team_id());
+  if (this->_internal_team_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_team_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerStateMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:PlayerStateMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PlayerStateMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PlayerStateMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:PlayerStateMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:PlayerStateMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerStateMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerStateMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerStateMessage::GetClassData() const { return &_class_data_; }
+
 
-void PlayerStateMessage::MergeFrom(const PlayerStateMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:PlayerStateMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void PlayerStateMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerStateMessage*>(&to_msg);
+  auto& from = static_cast<const PlayerStateMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PlayerStateMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_position()) {
-    mutable_position()->::Vector3::MergeFrom(from.position());
+  if (!from._internal_compact_transform().empty()) {
+    _this->_internal_set_compact_transform(from._internal_compact_transform());
   }
-  if (from.has_rotation()) {
-    mutable_rotation()->::Vector3::MergeFrom(from.rotation());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Vector3::MergeFrom(
+        from._internal_position());
   }
-  if (from.has_attributes()) {
-    mutable_attributes()->::PlayerAttributeMessage::MergeFrom(from.attributes());
+  if (from._internal_has_rotation()) {
+    _this->_internal_mutable_rotation()->::Vector3::MergeFrom(
+        from._internal_rotation());
   }
-  if (from.player_id() != 0) {
-    set_player_id(from.player_id());
+  if (from._internal_has_attributes()) {
+    _this->_internal_mutable_attributes()->::PlayerAttributeMessage::MergeFrom(
+        from._internal_attributes());
   }
-  if (from.is_alive() != 0) {
-    set_is_alive(from.is_alive());
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
   }
-  if (from.team_id() != 0) {
-    set_team_id(from.team_id());
+  if (from._internal_is_alive() != 0) {
+    _this->_internal_set_is_alive(from._internal_is_alive());
   }
-}
-
-void PlayerStateMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:PlayerStateMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_team_id() != 0) {
+    _this->_internal_set_team_id(from._internal_team_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayerStateMessage::CopyFrom(const PlayerStateMessage& from) {
@@ -1885,881 +1695,2154 @@ bool PlayerStateMessage::IsInitialized() const {
   return true;
 }
 
-void PlayerStateMessage::Swap(PlayerStateMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PlayerStateMessage::InternalSwap(PlayerStateMessage* other) {
   using std::swap;
-  swap(position_, other->position_);
-  swap(rotation_, other->rotation_);
-  swap(attributes_, other->attributes_);
-  swap(player_id_, other->player_id_);
-  swap(is_alive_, other->is_alive_);
-  swap(team_id_, other->team_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata PlayerStateMessage::GetMetadata() const {
-  protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.compact_transform_, lhs_arena,
+      &other->_impl_.compact_transform_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerStateMessage, _impl_.team_id_)
+      + sizeof(PlayerStateMessage::_impl_.team_id_)
+      - PROTOBUF_FIELD_OFFSET(PlayerStateMessage, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerStateMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void HeartbeatMessage::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class HeartbeatMessage::_Internal {
+ public:
+};
 
-HeartbeatMessage::HeartbeatMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_NetworkMessage_2eproto::scc_info_HeartbeatMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HeartbeatMessage)
+HeartbeatMessage::HeartbeatMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:HeartbeatMessage)
 }
 HeartbeatMessage::HeartbeatMessage(const HeartbeatMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  HeartbeatMessage* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:HeartbeatMessage)
 }
 
-void HeartbeatMessage::SharedCtor() {
-}
-
-HeartbeatMessage::~HeartbeatMessage() {
-  // @@protoc_insertion_point(destructor:HeartbeatMessage)
-  SharedDtor();
-}
-
-void HeartbeatMessage::SharedDtor() {
-}
-
-void HeartbeatMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* HeartbeatMessage::descriptor() {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const HeartbeatMessage& HeartbeatMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_NetworkMessage_2eproto::scc_info_HeartbeatMessage.base);
-  return *internal_default_instance();
-}
-
-
-void HeartbeatMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:HeartbeatMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _internal_metadata_.Clear();
-}
-
-bool HeartbeatMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HeartbeatMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, _internal_metadata_.mutable_unknown_fields()));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HeartbeatMessage)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:HeartbeatMessage)
-  return false;
-#undef DO_
-}
-
-void HeartbeatMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HeartbeatMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:HeartbeatMessage)
-}
 
-::google::protobuf::uint8* HeartbeatMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:HeartbeatMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:HeartbeatMessage)
-  return target;
-}
 
-size_t HeartbeatMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:HeartbeatMessage)
-  size_t total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HeartbeatMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HeartbeatMessage::GetClassData() const { return &_class_data_; }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void HeartbeatMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HeartbeatMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const HeartbeatMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const HeartbeatMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HeartbeatMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HeartbeatMessage)
-    MergeFrom(*source);
-  }
-}
-
-void HeartbeatMessage::MergeFrom(const HeartbeatMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HeartbeatMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-}
 
-void HeartbeatMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HeartbeatMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void HeartbeatMessage::CopyFrom(const HeartbeatMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:HeartbeatMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool HeartbeatMessage::IsInitialized() const {
-  return true;
-}
 
-void HeartbeatMessage::Swap(HeartbeatMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void HeartbeatMessage::InternalSwap(HeartbeatMessage* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
 
-::google::protobuf::Metadata HeartbeatMessage::GetMetadata() const {
-  protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata HeartbeatMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void PlayerUpdateMessage::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PlayerUpdateMessage::kPositionXFieldNumber;
-const int PlayerUpdateMessage::kPositionYFieldNumber;
-const int PlayerUpdateMessage::kPositionZFieldNumber;
-const int PlayerUpdateMessage::kRotationXFieldNumber;
-const int PlayerUpdateMessage::kRotationYFieldNumber;
-const int PlayerUpdateMessage::kRotationZFieldNumber;
-const int PlayerUpdateMessage::kVelocityXFieldNumber;
-const int PlayerUpdateMessage::kVelocityYFieldNumber;
-const int PlayerUpdateMessage::kVelocityZFieldNumber;
-const int PlayerUpdateMessage::kIsGroundedFieldNumber;
-const int PlayerUpdateMessage::kHealthFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-PlayerUpdateMessage::PlayerUpdateMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_NetworkMessage_2eproto::scc_info_PlayerUpdateMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:PlayerUpdateMessage)
+class PlayerUpdateMessage::_Internal {
+ public:
+};
+
+PlayerUpdateMessage::PlayerUpdateMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PlayerUpdateMessage)
 }
 PlayerUpdateMessage::PlayerUpdateMessage(const PlayerUpdateMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&position_x_, &from.position_x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&health_) -
-    reinterpret_cast<char*>(&position_x_)) + sizeof(health_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerUpdateMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_x_){}
+    , decltype(_impl_.position_y_){}
+    , decltype(_impl_.position_z_){}
+    , decltype(_impl_.rotation_x_){}
+    , decltype(_impl_.rotation_y_){}
+    , decltype(_impl_.rotation_z_){}
+    , decltype(_impl_.velocity_x_){}
+    , decltype(_impl_.velocity_y_){}
+    , decltype(_impl_.velocity_z_){}
+    , decltype(_impl_.is_grounded_){}
+    , decltype(_impl_.health_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.position_x_, &from._impl_.position_x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.health_) -
+    reinterpret_cast<char*>(&_impl_.position_x_)) + sizeof(_impl_.health_));
   // @@protoc_insertion_point(copy_constructor:PlayerUpdateMessage)
 }
 
-void PlayerUpdateMessage::SharedCtor() {
-  ::memset(&position_x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&health_) -
-      reinterpret_cast<char*>(&position_x_)) + sizeof(health_));
+inline void PlayerUpdateMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_x_){0}
+    , decltype(_impl_.position_y_){0}
+    , decltype(_impl_.position_z_){0}
+    , decltype(_impl_.rotation_x_){0}
+    , decltype(_impl_.rotation_y_){0}
+    , decltype(_impl_.rotation_z_){0}
+    , decltype(_impl_.velocity_x_){0}
+    , decltype(_impl_.velocity_y_){0}
+    , decltype(_impl_.velocity_z_){0}
+    , decltype(_impl_.is_grounded_){false}
+    , decltype(_impl_.health_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PlayerUpdateMessage::~PlayerUpdateMessage() {
   // @@protoc_insertion_point(destructor:PlayerUpdateMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerUpdateMessage::SharedDtor() {
+inline void PlayerUpdateMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PlayerUpdateMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* PlayerUpdateMessage::descriptor() {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PlayerUpdateMessage& PlayerUpdateMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_NetworkMessage_2eproto::scc_info_PlayerUpdateMessage.base);
-  return *internal_default_instance();
-}
-
-
 void PlayerUpdateMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:PlayerUpdateMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&position_x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&health_) -
-      reinterpret_cast<char*>(&position_x_)) + sizeof(health_));
-  _internal_metadata_.Clear();
-}
-
-bool PlayerUpdateMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:PlayerUpdateMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.position_x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.health_) -
+      reinterpret_cast<char*>(&_impl_.position_x_)) + sizeof(_impl_.health_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerUpdateMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // float position_x = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &position_x_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.position_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float position_y = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &position_y_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.position_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float position_z = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &position_z_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.position_z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float rotation_x = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(37u /* 37 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &rotation_x_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.rotation_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float rotation_y = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(45u /* 45 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &rotation_y_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.rotation_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float rotation_z = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(53u /* 53 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &rotation_z_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.rotation_z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float velocity_x = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(61u /* 61 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &velocity_x_)));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.velocity_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float velocity_y = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(69u /* 69 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &velocity_y_)));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _impl_.velocity_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float velocity_z = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(77u /* 77 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &velocity_z_)));
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _impl_.velocity_z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool is_grounded = 10;
-      case 10: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_grounded_)));
-        } else {
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.is_grounded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float health = 11;
-      case 11: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(93u /* 93 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &health_)));
-        } else {
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _impl_.health_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:PlayerUpdateMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:PlayerUpdateMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PlayerUpdateMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:PlayerUpdateMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PlayerUpdateMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PlayerUpdateMessage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float position_x = 1;
-  if (this->position_x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->position_x(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_x = this->_internal_position_x();
+  uint32_t raw_position_x;
+  memcpy(&raw_position_x, &tmp_position_x, sizeof(tmp_position_x));
+  if (raw_position_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_position_x(), target);
   }
 
   // float position_y = 2;
-  if (this->position_y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->position_y(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_y = this->_internal_position_y();
+  uint32_t raw_position_y;
+  memcpy(&raw_position_y, &tmp_position_y, sizeof(tmp_position_y));
+  if (raw_position_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_position_y(), target);
   }
 
   // float position_z = 3;
-  if (this->position_z() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->position_z(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_z = this->_internal_position_z();
+  uint32_t raw_position_z;
+  memcpy(&raw_position_z, &tmp_position_z, sizeof(tmp_position_z));
+  if (raw_position_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_position_z(), target);
   }
 
   // float rotation_x = 4;
-  if (this->rotation_x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->rotation_x(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_x = this->_internal_rotation_x();
+  uint32_t raw_rotation_x;
+  memcpy(&raw_rotation_x, &tmp_rotation_x, sizeof(tmp_rotation_x));
+  if (raw_rotation_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_rotation_x(), target);
   }
 
   // float rotation_y = 5;
-  if (this->rotation_y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->rotation_y(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_y = this->_internal_rotation_y();
+  uint32_t raw_rotation_y;
+  memcpy(&raw_rotation_y, &tmp_rotation_y, sizeof(tmp_rotation_y));
+  if (raw_rotation_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_rotation_y(), target);
   }
 
   // float rotation_z = 6;
-  if (this->rotation_z() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->rotation_z(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_z = this->_internal_rotation_z();
+  uint32_t raw_rotation_z;
+  memcpy(&raw_rotation_z, &tmp_rotation_z, sizeof(tmp_rotation_z));
+  if (raw_rotation_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_rotation_z(), target);
   }
 
   // float velocity_x = 7;
-  if (this->velocity_x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(7, this->velocity_x(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_x = this->_internal_velocity_x();
+  uint32_t raw_velocity_x;
+  memcpy(&raw_velocity_x, &tmp_velocity_x, sizeof(tmp_velocity_x));
+  if (raw_velocity_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_velocity_x(), target);
   }
 
   // float velocity_y = 8;
-  if (this->velocity_y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(8, this->velocity_y(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_y = this->_internal_velocity_y();
+  uint32_t raw_velocity_y;
+  memcpy(&raw_velocity_y, &tmp_velocity_y, sizeof(tmp_velocity_y));
+  if (raw_velocity_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_velocity_y(), target);
   }
 
   // float velocity_z = 9;
-  if (this->velocity_z() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(9, this->velocity_z(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_z = this->_internal_velocity_z();
+  uint32_t raw_velocity_z;
+  memcpy(&raw_velocity_z, &tmp_velocity_z, sizeof(tmp_velocity_z));
+  if (raw_velocity_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_velocity_z(), target);
   }
 
   // bool is_grounded = 10;
-  if (this->is_grounded() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->is_grounded(), output);
+  if (this->_internal_is_grounded() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_is_grounded(), target);
   }
 
   // float health = 11;
-  if (this->health() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(11, this->health(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_health = this->_internal_health();
+  uint32_t raw_health;
+  memcpy(&raw_health, &tmp_health, sizeof(tmp_health));
+  if (raw_health != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_health(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:PlayerUpdateMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:PlayerUpdateMessage)
+  return target;
 }
 
-::google::protobuf::uint8* PlayerUpdateMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:PlayerUpdateMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t PlayerUpdateMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PlayerUpdateMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // float position_x = 1;
-  if (this->position_x() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->position_x(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_x = this->_internal_position_x();
+  uint32_t raw_position_x;
+  memcpy(&raw_position_x, &tmp_position_x, sizeof(tmp_position_x));
+  if (raw_position_x != 0) {
+    total_size += 1 + 4;
   }
 
   // float position_y = 2;
-  if (this->position_y() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->position_y(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_y = this->_internal_position_y();
+  uint32_t raw_position_y;
+  memcpy(&raw_position_y, &tmp_position_y, sizeof(tmp_position_y));
+  if (raw_position_y != 0) {
+    total_size += 1 + 4;
   }
 
   // float position_z = 3;
-  if (this->position_z() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->position_z(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_z = this->_internal_position_z();
+  uint32_t raw_position_z;
+  memcpy(&raw_position_z, &tmp_position_z, sizeof(tmp_position_z));
+  if (raw_position_z != 0) {
+    total_size += 1 + 4;
   }
 
   // float rotation_x = 4;
-  if (this->rotation_x() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->rotation_x(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_x = this->_internal_rotation_x();
+  uint32_t raw_rotation_x;
+  memcpy(&raw_rotation_x, &tmp_rotation_x, sizeof(tmp_rotation_x));
+  if (raw_rotation_x != 0) {
+    total_size += 1 + 4;
   }
 
   // float rotation_y = 5;
-  if (this->rotation_y() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->rotation_y(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_y = this->_internal_rotation_y();
+  uint32_t raw_rotation_y;
+  memcpy(&raw_rotation_y, &tmp_rotation_y, sizeof(tmp_rotation_y));
+  if (raw_rotation_y != 0) {
+    total_size += 1 + 4;
   }
 
   // float rotation_z = 6;
-  if (this->rotation_z() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->rotation_z(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_z = this->_internal_rotation_z();
+  uint32_t raw_rotation_z;
+  memcpy(&raw_rotation_z, &tmp_rotation_z, sizeof(tmp_rotation_z));
+  if (raw_rotation_z != 0) {
+    total_size += 1 + 4;
   }
 
   // float velocity_x = 7;
-  if (this->velocity_x() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(7, this->velocity_x(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_x = this->_internal_velocity_x();
+  uint32_t raw_velocity_x;
+  memcpy(&raw_velocity_x, &tmp_velocity_x, sizeof(tmp_velocity_x));
+  if (raw_velocity_x != 0) {
+    total_size += 1 + 4;
   }
 
   // float velocity_y = 8;
-  if (this->velocity_y() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(8, this->velocity_y(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_y = this->_internal_velocity_y();
+  uint32_t raw_velocity_y;
+  memcpy(&raw_velocity_y, &tmp_velocity_y, sizeof(tmp_velocity_y));
+  if (raw_velocity_y != 0) {
+    total_size += 1 + 4;
   }
 
   // float velocity_z = 9;
-  if (this->velocity_z() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(9, this->velocity_z(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_z = this->_internal_velocity_z();
+  uint32_t raw_velocity_z;
+  memcpy(&raw_velocity_z, &tmp_velocity_z, sizeof(tmp_velocity_z));
+  if (raw_velocity_z != 0) {
+    total_size += 1 + 4;
   }
 
   // bool is_grounded = 10;
-  if (this->is_grounded() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(10, this->is_grounded(), target);
+  if (this->_internal_is_grounded() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // float health = 11;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_health = this->_internal_health();
+  uint32_t raw_health;
+  memcpy(&raw_health, &tmp_health, sizeof(tmp_health));
+  if (raw_health != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerUpdateMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerUpdateMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerUpdateMessage::GetClassData() const { return &_class_data_; }
+
+
+void PlayerUpdateMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerUpdateMessage*>(&to_msg);
+  auto& from = static_cast<const PlayerUpdateMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PlayerUpdateMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_x = from._internal_position_x();
+  uint32_t raw_position_x;
+  memcpy(&raw_position_x, &tmp_position_x, sizeof(tmp_position_x));
+  if (raw_position_x != 0) {
+    _this->_internal_set_position_x(from._internal_position_x());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_y = from._internal_position_y();
+  uint32_t raw_position_y;
+  memcpy(&raw_position_y, &tmp_position_y, sizeof(tmp_position_y));
+  if (raw_position_y != 0) {
+    _this->_internal_set_position_y(from._internal_position_y());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_position_z = from._internal_position_z();
+  uint32_t raw_position_z;
+  memcpy(&raw_position_z, &tmp_position_z, sizeof(tmp_position_z));
+  if (raw_position_z != 0) {
+    _this->_internal_set_position_z(from._internal_position_z());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_x = from._internal_rotation_x();
+  uint32_t raw_rotation_x;
+  memcpy(&raw_rotation_x, &tmp_rotation_x, sizeof(tmp_rotation_x));
+  if (raw_rotation_x != 0) {
+    _this->_internal_set_rotation_x(from._internal_rotation_x());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_y = from._internal_rotation_y();
+  uint32_t raw_rotation_y;
+  memcpy(&raw_rotation_y, &tmp_rotation_y, sizeof(tmp_rotation_y));
+  if (raw_rotation_y != 0) {
+    _this->_internal_set_rotation_y(from._internal_rotation_y());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rotation_z = from._internal_rotation_z();
+  uint32_t raw_rotation_z;
+  memcpy(&raw_rotation_z, &tmp_rotation_z, sizeof(tmp_rotation_z));
+  if (raw_rotation_z != 0) {
+    _this->_internal_set_rotation_z(from._internal_rotation_z());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_x = from._internal_velocity_x();
+  uint32_t raw_velocity_x;
+  memcpy(&raw_velocity_x, &tmp_velocity_x, sizeof(tmp_velocity_x));
+  if (raw_velocity_x != 0) {
+    _this->_internal_set_velocity_x(from._internal_velocity_x());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_y = from._internal_velocity_y();
+  uint32_t raw_velocity_y;
+  memcpy(&raw_velocity_y, &tmp_velocity_y, sizeof(tmp_velocity_y));
+  if (raw_velocity_y != 0) {
+    _this->_internal_set_velocity_y(from._internal_velocity_y());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_z = from._internal_velocity_z();
+  uint32_t raw_velocity_z;
+  memcpy(&raw_velocity_z, &tmp_velocity_z, sizeof(tmp_velocity_z));
+  if (raw_velocity_z != 0) {
+    _this->_internal_set_velocity_z(from._internal_velocity_z());
+  }
+  if (from._internal_is_grounded() != 0) {
+    _this->_internal_set_is_grounded(from._internal_is_grounded());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_health = from._internal_health();
+  uint32_t raw_health;
+  memcpy(&raw_health, &tmp_health, sizeof(tmp_health));
+  if (raw_health != 0) {
+    _this->_internal_set_health(from._internal_health());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PlayerUpdateMessage::CopyFrom(const PlayerUpdateMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PlayerUpdateMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PlayerUpdateMessage::IsInitialized() const {
+  return true;
+}
+
+void PlayerUpdateMessage::InternalSwap(PlayerUpdateMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerUpdateMessage, _impl_.health_)
+      + sizeof(PlayerUpdateMessage::_impl_.health_)
+      - PROTOBUF_FIELD_OFFSET(PlayerUpdateMessage, _impl_.position_x_)>(
+          reinterpret_cast<char*>(&_impl_.position_x_),
+          reinterpret_cast<char*>(&other->_impl_.position_x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerUpdateMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[6]);
+}
+
+// ===================================================================
+
+class CompactPlayerUpdate::_Internal {
+ public:
+};
+
+CompactPlayerUpdate::CompactPlayerUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CompactPlayerUpdate)
+}
+CompactPlayerUpdate::CompactPlayerUpdate(const CompactPlayerUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CompactPlayerUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.state_){}
+    , decltype(_impl_.health_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_state().empty()) {
+    _this->_impl_.state_.Set(from._internal_state(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.health_ = from._impl_.health_;
+  // @@protoc_insertion_point(copy_constructor:CompactPlayerUpdate)
+}
+
+inline void CompactPlayerUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.state_){}
+    , decltype(_impl_.health_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CompactPlayerUpdate::~CompactPlayerUpdate() {
+  // @@protoc_insertion_point(destructor:CompactPlayerUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CompactPlayerUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.state_.Destroy();
+}
+
+void CompactPlayerUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CompactPlayerUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:CompactPlayerUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.state_.ClearToEmpty();
+  _impl_.health_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CompactPlayerUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes state = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 health = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.health_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CompactPlayerUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CompactPlayerUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes state = 1;
+  if (!this->_internal_state().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_state(), target);
+  }
+
+  // uint32 health = 2;
+  if (this->_internal_health() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_health(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CompactPlayerUpdate)
+  return target;
+}
+
+size_t CompactPlayerUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CompactPlayerUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes state = 1;
+  if (!this->_internal_state().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_state());
+  }
+
+  // uint32 health = 2;
+  if (this->_internal_health() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_health());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompactPlayerUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CompactPlayerUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompactPlayerUpdate::GetClassData() const { return &_class_data_; }
+
+
+void CompactPlayerUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompactPlayerUpdate*>(&to_msg);
+  auto& from = static_cast<const CompactPlayerUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CompactPlayerUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_state().empty()) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  if (from._internal_health() != 0) {
+    _this->_internal_set_health(from._internal_health());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CompactPlayerUpdate::CopyFrom(const CompactPlayerUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CompactPlayerUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompactPlayerUpdate::IsInitialized() const {
+  return true;
+}
+
+void CompactPlayerUpdate::InternalSwap(CompactPlayerUpdate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.state_, lhs_arena,
+      &other->_impl_.state_, rhs_arena
+  );
+  swap(_impl_.health_, other->_impl_.health_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CompactPlayerUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[7]);
+}
+
+// ===================================================================
+
+class UdpBindMessage::_Internal {
+ public:
+};
+
+UdpBindMessage::UdpBindMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:UdpBindMessage)
+}
+UdpBindMessage::UdpBindMessage(const UdpBindMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UdpBindMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.token_){}
+    , decltype(_impl_.port_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.token_, &from._impl_.token_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.token_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:UdpBindMessage)
+}
+
+inline void UdpBindMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.token_){uint64_t{0u}}
+    , decltype(_impl_.port_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+UdpBindMessage::~UdpBindMessage() {
+  // @@protoc_insertion_point(destructor:UdpBindMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UdpBindMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void UdpBindMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UdpBindMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:UdpBindMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.token_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.port_) -
+      reinterpret_cast<char*>(&_impl_.token_)) + sizeof(_impl_.port_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UdpBindMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // fixed64 token = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.token_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 port = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UdpBindMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:UdpBindMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // fixed64 token = 1;
+  if (this->_internal_token() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_token(), target);
+  }
+
+  // uint32 port = 2;
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_port(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:UdpBindMessage)
+  return target;
+}
+
+size_t UdpBindMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:UdpBindMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // fixed64 token = 1;
+  if (this->_internal_token() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 port = 2;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UdpBindMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UdpBindMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UdpBindMessage::GetClassData() const { return &_class_data_; }
+
+
+void UdpBindMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UdpBindMessage*>(&to_msg);
+  auto& from = static_cast<const UdpBindMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:UdpBindMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_token() != 0) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UdpBindMessage::CopyFrom(const UdpBindMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:UdpBindMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UdpBindMessage::IsInitialized() const {
+  return true;
+}
+
+void UdpBindMessage::InternalSwap(UdpBindMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UdpBindMessage, _impl_.port_)
+      + sizeof(UdpBindMessage::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(UdpBindMessage, _impl_.token_)>(
+          reinterpret_cast<char*>(&_impl_.token_),
+          reinterpret_cast<char*>(&other->_impl_.token_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UdpBindMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[8]);
+}
+
+// ===================================================================
+
+class EntityDelta::_Internal {
+ public:
+  static const ::PlayerStateMessage& state(const EntityDelta* msg);
+};
+
+const ::PlayerStateMessage&
+EntityDelta::_Internal::state(const EntityDelta* msg) {
+  return *msg->_impl_.state_;
+}
+EntityDelta::EntityDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:EntityDelta)
+}
+EntityDelta::EntityDelta(const EntityDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EntityDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.changed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_state()) {
+    _this->_impl_.state_ = new ::PlayerStateMessage(*from._impl_.state_);
+  }
+  _this->_impl_.changed_ = from._impl_.changed_;
+  // @@protoc_insertion_point(copy_constructor:EntityDelta)
+}
+
+inline void EntityDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.changed_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+EntityDelta::~EntityDelta() {
+  // @@protoc_insertion_point(destructor:EntityDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EntityDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.state_;
+}
+
+void EntityDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EntityDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:EntityDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.state_ != nullptr) {
+    delete _impl_.state_;
+  }
+  _impl_.state_ = nullptr;
+  _impl_.changed_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EntityDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 changed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.changed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .PlayerStateMessage state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EntityDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:EntityDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 changed = 1;
+  if (this->_internal_changed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_changed(), target);
+  }
+
+  // .PlayerStateMessage state = 2;
+  if (this->_internal_has_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::state(this),
+        _Internal::state(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:EntityDelta)
+  return target;
+}
+
+size_t EntityDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:EntityDelta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .PlayerStateMessage state = 2;
+  if (this->_internal_has_state()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.state_);
+  }
+
+  // uint32 changed = 1;
+  if (this->_internal_changed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_changed());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EntityDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EntityDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EntityDelta::GetClassData() const { return &_class_data_; }
+
+
+void EntityDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EntityDelta*>(&to_msg);
+  auto& from = static_cast<const EntityDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:EntityDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_state()) {
+    _this->_internal_mutable_state()->::PlayerStateMessage::MergeFrom(
+        from._internal_state());
+  }
+  if (from._internal_changed() != 0) {
+    _this->_internal_set_changed(from._internal_changed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EntityDelta::CopyFrom(const EntityDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:EntityDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EntityDelta::IsInitialized() const {
+  return true;
+}
+
+void EntityDelta::InternalSwap(EntityDelta* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EntityDelta, _impl_.changed_)
+      + sizeof(EntityDelta::_impl_.changed_)
+      - PROTOBUF_FIELD_OFFSET(EntityDelta, _impl_.state_)>(
+          reinterpret_cast<char*>(&_impl_.state_),
+          reinterpret_cast<char*>(&other->_impl_.state_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EntityDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[9]);
+}
+
+// ===================================================================
+
+class WorldSnapshot::_Internal {
+ public:
+};
+
+WorldSnapshot::WorldSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WorldSnapshot)
+}
+WorldSnapshot::WorldSnapshot(const WorldSnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorldSnapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entities_){from._impl_.entities_}
+    , decltype(_impl_.removed_){from._impl_.removed_}
+    , /*decltype(_impl_._removed_cached_byte_size_)*/{0}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.baseline_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.baseline_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.baseline_));
+  // @@protoc_insertion_point(copy_constructor:WorldSnapshot)
+}
+
+inline void WorldSnapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entities_){arena}
+    , decltype(_impl_.removed_){arena}
+    , /*decltype(_impl_._removed_cached_byte_size_)*/{0}
+    , decltype(_impl_.sequence_){0u}
+    , decltype(_impl_.baseline_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WorldSnapshot::~WorldSnapshot() {
+  // @@protoc_insertion_point(destructor:WorldSnapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WorldSnapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entities_.~RepeatedPtrField();
+  _impl_.removed_.~RepeatedField();
+}
+
+void WorldSnapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WorldSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:WorldSnapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entities_.Clear();
+  _impl_.removed_.Clear();
+  ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.baseline_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.baseline_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WorldSnapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 sequence = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 baseline = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.baseline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .EntityDelta entities = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entities(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 removed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_removed(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_removed(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WorldSnapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WorldSnapshot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_sequence(), target);
+  }
+
+  // uint32 baseline = 2;
+  if (this->_internal_baseline() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_baseline(), target);
   }
 
-  // float health = 11;
-  if (this->health() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(11, this->health(), target);
+  // repeated .EntityDelta entities = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entities_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entities(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated uint32 removed = 4;
+  {
+    int byte_size = _impl_._removed_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_removed(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WorldSnapshot)
+  return target;
+}
+
+size_t WorldSnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WorldSnapshot)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .EntityDelta entities = 3;
+  total_size += 1UL * this->_internal_entities_size();
+  for (const auto& msg : this->_impl_.entities_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint32 removed = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.removed_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._removed_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint32 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequence());
+  }
+
+  // uint32 baseline = 2;
+  if (this->_internal_baseline() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_baseline());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorldSnapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorldSnapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorldSnapshot::GetClassData() const { return &_class_data_; }
+
+
+void WorldSnapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorldSnapshot*>(&to_msg);
+  auto& from = static_cast<const WorldSnapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WorldSnapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entities_.MergeFrom(from._impl_.entities_);
+  _this->_impl_.removed_.MergeFrom(from._impl_.removed_);
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_baseline() != 0) {
+    _this->_internal_set_baseline(from._internal_baseline());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WorldSnapshot::CopyFrom(const WorldSnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WorldSnapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WorldSnapshot::IsInitialized() const {
+  return true;
+}
+
+void WorldSnapshot::InternalSwap(WorldSnapshot* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entities_.InternalSwap(&other->_impl_.entities_);
+  _impl_.removed_.InternalSwap(&other->_impl_.removed_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WorldSnapshot, _impl_.baseline_)
+      + sizeof(WorldSnapshot::_impl_.baseline_)
+      - PROTOBUF_FIELD_OFFSET(WorldSnapshot, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WorldSnapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[10]);
+}
+
+// ===================================================================
+
+class SnapshotAck::_Internal {
+ public:
+};
+
+SnapshotAck::SnapshotAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SnapshotAck)
+}
+SnapshotAck::SnapshotAck(const SnapshotAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SnapshotAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.sequence_ = from._impl_.sequence_;
+  // @@protoc_insertion_point(copy_constructor:SnapshotAck)
+}
+
+inline void SnapshotAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sequence_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SnapshotAck::~SnapshotAck() {
+  // @@protoc_insertion_point(destructor:SnapshotAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SnapshotAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SnapshotAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SnapshotAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:SnapshotAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sequence_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SnapshotAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 sequence = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SnapshotAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SnapshotAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_sequence(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:PlayerUpdateMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:SnapshotAck)
   return target;
 }
 
-size_t PlayerUpdateMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:PlayerUpdateMessage)
+size_t SnapshotAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SnapshotAck)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // float position_x = 1;
-  if (this->position_x() != 0) {
-    total_size += 1 + 4;
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // float position_y = 2;
-  if (this->position_y() != 0) {
-    total_size += 1 + 4;
+  // uint32 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequence());
   }
 
-  // float position_z = 3;
-  if (this->position_z() != 0) {
-    total_size += 1 + 4;
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // float rotation_x = 4;
-  if (this->rotation_x() != 0) {
-    total_size += 1 + 4;
-  }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SnapshotAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SnapshotAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SnapshotAck::GetClassData() const { return &_class_data_; }
 
-  // float rotation_y = 5;
-  if (this->rotation_y() != 0) {
-    total_size += 1 + 4;
-  }
 
-  // float rotation_z = 6;
-  if (this->rotation_z() != 0) {
-    total_size += 1 + 4;
-  }
+void SnapshotAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SnapshotAck*>(&to_msg);
+  auto& from = static_cast<const SnapshotAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SnapshotAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // float velocity_x = 7;
-  if (this->velocity_x() != 0) {
-    total_size += 1 + 4;
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // float velocity_y = 8;
-  if (this->velocity_y() != 0) {
-    total_size += 1 + 4;
-  }
+void SnapshotAck::CopyFrom(const SnapshotAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SnapshotAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-  // float velocity_z = 9;
-  if (this->velocity_z() != 0) {
-    total_size += 1 + 4;
-  }
+bool SnapshotAck::IsInitialized() const {
+  return true;
+}
 
-  // bool is_grounded = 10;
-  if (this->is_grounded() != 0) {
-    total_size += 1 + 1;
-  }
+void SnapshotAck::InternalSwap(SnapshotAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.sequence_, other->_impl_.sequence_);
+}
 
-  // float health = 11;
-  if (this->health() != 0) {
-    total_size += 1 + 4;
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata SnapshotAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[11]);
+}
+
+// ===================================================================
+
+class MessageBatch::_Internal {
+ public:
+};
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+MessageBatch::MessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MessageBatch)
+}
+MessageBatch::MessageBatch(const MessageBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MessageBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:MessageBatch)
+}
+
+inline void MessageBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void PlayerUpdateMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:PlayerUpdateMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PlayerUpdateMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PlayerUpdateMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:PlayerUpdateMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:PlayerUpdateMessage)
-    MergeFrom(*source);
+MessageBatch::~MessageBatch() {
+  // @@protoc_insertion_point(destructor:MessageBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void MessageBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void MessageBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void PlayerUpdateMessage::MergeFrom(const PlayerUpdateMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:PlayerUpdateMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void MessageBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:MessageBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (from.position_x() != 0) {
-    set_position_x(from.position_x());
-  }
-  if (from.position_y() != 0) {
-    set_position_y(from.position_y());
-  }
-  if (from.position_z() != 0) {
-    set_position_z(from.position_z());
-  }
-  if (from.rotation_x() != 0) {
-    set_rotation_x(from.rotation_x());
-  }
-  if (from.rotation_y() != 0) {
-    set_rotation_y(from.rotation_y());
-  }
-  if (from.rotation_z() != 0) {
-    set_rotation_z(from.rotation_z());
-  }
-  if (from.velocity_x() != 0) {
-    set_velocity_x(from.velocity_x());
-  }
-  if (from.velocity_y() != 0) {
-    set_velocity_y(from.velocity_y());
-  }
-  if (from.velocity_z() != 0) {
-    set_velocity_z(from.velocity_z());
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MessageBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_messages();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MessageBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MessageBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes messages = 1;
+  for (int i = 0, n = this->_internal_messages_size(); i < n; i++) {
+    const auto& s = this->_internal_messages(i);
+    target = stream->WriteBytes(1, s, target);
   }
-  if (from.is_grounded() != 0) {
-    set_is_grounded(from.is_grounded());
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  if (from.health() != 0) {
-    set_health(from.health());
+  // @@protoc_insertion_point(serialize_to_array_end:MessageBatch)
+  return target;
+}
+
+size_t MessageBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MessageBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes messages = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.messages_.size());
+  for (int i = 0, n = _impl_.messages_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.messages_.Get(i));
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerUpdateMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:PlayerUpdateMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MessageBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MessageBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MessageBatch::GetClassData() const { return &_class_data_; }
+
+
+void MessageBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MessageBatch*>(&to_msg);
+  auto& from = static_cast<const MessageBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MessageBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PlayerUpdateMessage::CopyFrom(const PlayerUpdateMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:PlayerUpdateMessage)
+void MessageBatch::CopyFrom(const MessageBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MessageBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PlayerUpdateMessage::IsInitialized() const {
+bool MessageBatch::IsInitialized() const {
   return true;
 }
 
-void PlayerUpdateMessage::Swap(PlayerUpdateMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void PlayerUpdateMessage::InternalSwap(PlayerUpdateMessage* other) {
+void MessageBatch::InternalSwap(MessageBatch* other) {
   using std::swap;
-  swap(position_x_, other->position_x_);
-  swap(position_y_, other->position_y_);
-  swap(position_z_, other->position_z_);
-  swap(rotation_x_, other->rotation_x_);
-  swap(rotation_y_, other->rotation_y_);
-  swap(rotation_z_, other->rotation_z_);
-  swap(velocity_x_, other->velocity_x_);
-  swap(velocity_y_, other->velocity_y_);
-  swap(velocity_z_, other->velocity_z_);
-  swap(is_grounded_, other->is_grounded_);
-  swap(health_, other->health_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
 }
 
-::google::protobuf::Metadata PlayerUpdateMessage::GetMetadata() const {
-  protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata MessageBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void NetworkMessage::InitAsDefaultInstance() {
-  ::_NetworkMessage_default_instance_.heartbeat_ = const_cast< ::HeartbeatMessage*>(
-      ::HeartbeatMessage::internal_default_instance());
-  ::_NetworkMessage_default_instance_.player_update_ = const_cast< ::PlayerUpdateMessage*>(
-      ::PlayerUpdateMessage::internal_default_instance());
-  ::_NetworkMessage_default_instance_.player_attribute_ = const_cast< ::PlayerAttributeMessage*>(
-      ::PlayerAttributeMessage::internal_default_instance());
-  ::_NetworkMessage_default_instance_.player_state_ = const_cast< ::PlayerStateMessage*>(
-      ::PlayerStateMessage::internal_default_instance());
+class NetworkMessage::_Internal {
+ public:
+  static const ::HeartbeatMessage& heartbeat(const NetworkMessage* msg);
+  static const ::PlayerUpdateMessage& player_update(const NetworkMessage* msg);
+  static const ::PlayerAttributeMessage& player_attribute(const NetworkMessage* msg);
+  static const ::PlayerStateMessage& player_state(const NetworkMessage* msg);
+  static const ::UdpBindMessage& udp_bind(const NetworkMessage* msg);
+  static const ::CompactPlayerUpdate& player_update_compact(const NetworkMessage* msg);
+  static const ::WorldSnapshot& world_snapshot(const NetworkMessage* msg);
+  static const ::SnapshotAck& snapshot_ack(const NetworkMessage* msg);
+};
+
+const ::HeartbeatMessage&
+NetworkMessage::_Internal::heartbeat(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.heartbeat_;
+}
+const ::PlayerUpdateMessage&
+NetworkMessage::_Internal::player_update(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.player_update_;
+}
+const ::PlayerAttributeMessage&
+NetworkMessage::_Internal::player_attribute(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.player_attribute_;
+}
+const ::PlayerStateMessage&
+NetworkMessage::_Internal::player_state(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.player_state_;
+}
+const ::UdpBindMessage&
+NetworkMessage::_Internal::udp_bind(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.udp_bind_;
+}
+const ::CompactPlayerUpdate&
+NetworkMessage::_Internal::player_update_compact(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.player_update_compact_;
+}
+const ::WorldSnapshot&
+NetworkMessage::_Internal::world_snapshot(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.world_snapshot_;
+}
+const ::SnapshotAck&
+NetworkMessage::_Internal::snapshot_ack(const NetworkMessage* msg) {
+  return *msg->_impl_.data_.snapshot_ack_;
 }
 void NetworkMessage::set_allocated_heartbeat(::HeartbeatMessage* heartbeat) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_data();
   if (heartbeat) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(heartbeat);
     if (message_arena != submessage_arena) {
-      heartbeat = ::google::protobuf::internal::GetOwnedMessage(
+      heartbeat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, heartbeat, submessage_arena);
     }
     set_has_heartbeat();
-    data_.heartbeat_ = heartbeat;
+    _impl_.data_.heartbeat_ = heartbeat;
   }
   // @@protoc_insertion_point(field_set_allocated:NetworkMessage.heartbeat)
 }
 void NetworkMessage::set_allocated_player_update(::PlayerUpdateMessage* player_update) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_data();
   if (player_update) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_update);
     if (message_arena != submessage_arena) {
-      player_update = ::google::protobuf::internal::GetOwnedMessage(
+      player_update = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, player_update, submessage_arena);
     }
     set_has_player_update();
-    data_.player_update_ = player_update;
+    _impl_.data_.player_update_ = player_update;
   }
   // @@protoc_insertion_point(field_set_allocated:NetworkMessage.player_update)
 }
 void NetworkMessage::set_allocated_player_attribute(::PlayerAttributeMessage* player_attribute) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_data();
   if (player_attribute) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_attribute);
     if (message_arena != submessage_arena) {
-      player_attribute = ::google::protobuf::internal::GetOwnedMessage(
+      player_attribute = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, player_attribute, submessage_arena);
     }
     set_has_player_attribute();
-    data_.player_attribute_ = player_attribute;
+    _impl_.data_.player_attribute_ = player_attribute;
   }
   // @@protoc_insertion_point(field_set_allocated:NetworkMessage.player_attribute)
 }
 void NetworkMessage::set_allocated_player_state(::PlayerStateMessage* player_state) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_data();
   if (player_state) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_state);
     if (message_arena != submessage_arena) {
-      player_state = ::google::protobuf::internal::GetOwnedMessage(
+      player_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, player_state, submessage_arena);
     }
     set_has_player_state();
-    data_.player_state_ = player_state;
+    _impl_.data_.player_state_ = player_state;
   }
   // @@protoc_insertion_point(field_set_allocated:NetworkMessage.player_state)
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int NetworkMessage::kMsgIdFieldNumber;
-const int NetworkMessage::kPlayerIdFieldNumber;
-const int NetworkMessage::kTimestampFieldNumber;
-const int NetworkMessage::kHeartbeatFieldNumber;
-const int NetworkMessage::kPlayerUpdateFieldNumber;
-const int NetworkMessage::kPlayerAttributeFieldNumber;
-const int NetworkMessage::kPlayerStateFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-NetworkMessage::NetworkMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_NetworkMessage_2eproto::scc_info_NetworkMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:NetworkMessage)
+void NetworkMessage::set_allocated_udp_bind(::UdpBindMessage* udp_bind) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (udp_bind) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(udp_bind);
+    if (message_arena != submessage_arena) {
+      udp_bind = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, udp_bind, submessage_arena);
+    }
+    set_has_udp_bind();
+    _impl_.data_.udp_bind_ = udp_bind;
+  }
+  // @@protoc_insertion_point(field_set_allocated:NetworkMessage.udp_bind)
+}
+void NetworkMessage::set_allocated_player_update_compact(::CompactPlayerUpdate* player_update_compact) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (player_update_compact) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_update_compact);
+    if (message_arena != submessage_arena) {
+      player_update_compact = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, player_update_compact, submessage_arena);
+    }
+    set_has_player_update_compact();
+    _impl_.data_.player_update_compact_ = player_update_compact;
+  }
+  // @@protoc_insertion_point(field_set_allocated:NetworkMessage.player_update_compact)
+}
+void NetworkMessage::set_allocated_world_snapshot(::WorldSnapshot* world_snapshot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (world_snapshot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(world_snapshot);
+    if (message_arena != submessage_arena) {
+      world_snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, world_snapshot, submessage_arena);
+    }
+    set_has_world_snapshot();
+    _impl_.data_.world_snapshot_ = world_snapshot;
+  }
+  // @@protoc_insertion_point(field_set_allocated:NetworkMessage.world_snapshot)
+}
+void NetworkMessage::set_allocated_snapshot_ack(::SnapshotAck* snapshot_ack) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (snapshot_ack) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(snapshot_ack);
+    if (message_arena != submessage_arena) {
+      snapshot_ack = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, snapshot_ack, submessage_arena);
+    }
+    set_has_snapshot_ack();
+    _impl_.data_.snapshot_ack_ = snapshot_ack;
+  }
+  // @@protoc_insertion_point(field_set_allocated:NetworkMessage.snapshot_ack)
+}
+NetworkMessage::NetworkMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetworkMessage)
 }
 NetworkMessage::NetworkMessage(const NetworkMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&msg_id_, &from.msg_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&timestamp_) -
-    reinterpret_cast<char*>(&msg_id_)) + sizeof(timestamp_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetworkMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_id_){}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.capabilities_){}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.msg_id_, &from._impl_.msg_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.capabilities_) -
+    reinterpret_cast<char*>(&_impl_.msg_id_)) + sizeof(_impl_.capabilities_));
   clear_has_data();
   switch (from.data_case()) {
     case kHeartbeat: {
-      mutable_heartbeat()->::HeartbeatMessage::MergeFrom(from.heartbeat());
+      _this->_internal_mutable_heartbeat()->::HeartbeatMessage::MergeFrom(
+          from._internal_heartbeat());
       break;
     }
     case kPlayerUpdate: {
-      mutable_player_update()->::PlayerUpdateMessage::MergeFrom(from.player_update());
+      _this->_internal_mutable_player_update()->::PlayerUpdateMessage::MergeFrom(
+          from._internal_player_update());
       break;
     }
     case kPlayerAttribute: {
-      mutable_player_attribute()->::PlayerAttributeMessage::MergeFrom(from.player_attribute());
+      _this->_internal_mutable_player_attribute()->::PlayerAttributeMessage::MergeFrom(
+          from._internal_player_attribute());
       break;
     }
     case kPlayerState: {
-      mutable_player_state()->::PlayerStateMessage::MergeFrom(from.player_state());
+      _this->_internal_mutable_player_state()->::PlayerStateMessage::MergeFrom(
+          from._internal_player_state());
+      break;
+    }
+    case kUdpBind: {
+      _this->_internal_mutable_udp_bind()->::UdpBindMessage::MergeFrom(
+          from._internal_udp_bind());
+      break;
+    }
+    case kPlayerUpdateCompact: {
+      _this->_internal_mutable_player_update_compact()->::CompactPlayerUpdate::MergeFrom(
+          from._internal_player_update_compact());
+      break;
+    }
+    case kWorldSnapshot: {
+      _this->_internal_mutable_world_snapshot()->::WorldSnapshot::MergeFrom(
+          from._internal_world_snapshot());
+      break;
+    }
+    case kSnapshotAck: {
+      _this->_internal_mutable_snapshot_ack()->::SnapshotAck::MergeFrom(
+          from._internal_snapshot_ack());
       break;
     }
     case DATA_NOT_SET: {
@@ -2769,306 +3852,330 @@ NetworkMessage::NetworkMessage(const NetworkMessage& from)
   // @@protoc_insertion_point(copy_constructor:NetworkMessage)
 }
 
-void NetworkMessage::SharedCtor() {
-  ::memset(&msg_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&msg_id_)) + sizeof(timestamp_));
+inline void NetworkMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_id_){0}
+    , decltype(_impl_.player_id_){0u}
+    , decltype(_impl_.timestamp_){0u}
+    , decltype(_impl_.capabilities_){0u}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_data();
 }
 
 NetworkMessage::~NetworkMessage() {
   // @@protoc_insertion_point(destructor:NetworkMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NetworkMessage::SharedDtor() {
+inline void NetworkMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_data()) {
     clear_data();
   }
 }
 
 void NetworkMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* NetworkMessage::descriptor() {
-  ::protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const NetworkMessage& NetworkMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_NetworkMessage_2eproto::scc_info_NetworkMessage.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void NetworkMessage::clear_data() {
 // @@protoc_insertion_point(one_of_clear_start:NetworkMessage)
   switch (data_case()) {
     case kHeartbeat: {
-      delete data_.heartbeat_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.heartbeat_;
+      }
       break;
     }
     case kPlayerUpdate: {
-      delete data_.player_update_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.player_update_;
+      }
       break;
     }
     case kPlayerAttribute: {
-      delete data_.player_attribute_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.player_attribute_;
+      }
       break;
     }
     case kPlayerState: {
-      delete data_.player_state_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.player_state_;
+      }
+      break;
+    }
+    case kUdpBind: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.udp_bind_;
+      }
+      break;
+    }
+    case kPlayerUpdateCompact: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.player_update_compact_;
+      }
+      break;
+    }
+    case kWorldSnapshot: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.world_snapshot_;
+      }
+      break;
+    }
+    case kSnapshotAck: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.snapshot_ack_;
+      }
       break;
     }
     case DATA_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = DATA_NOT_SET;
+  _impl_._oneof_case_[0] = DATA_NOT_SET;
 }
 
 
 void NetworkMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:NetworkMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&msg_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&msg_id_)) + sizeof(timestamp_));
+  ::memset(&_impl_.msg_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.capabilities_) -
+      reinterpret_cast<char*>(&_impl_.msg_id_)) + sizeof(_impl_.capabilities_));
   clear_data();
-  _internal_metadata_.Clear();
-}
-
-bool NetworkMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:NetworkMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NetworkMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .MessageType msg_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_msg_id(static_cast< ::MessageType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_msg_id(static_cast<::MessageType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 player_id = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &player_id_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 timestamp = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &timestamp_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .HeartbeatMessage heartbeat = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_heartbeat()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_heartbeat(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .PlayerUpdateMessage player_update = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_player_update()));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_update(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .PlayerAttributeMessage player_attribute = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_player_attribute()));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_attribute(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .PlayerStateMessage player_state = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_player_state()));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_state(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // .UdpBindMessage udp_bind = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_udp_bind(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CompactPlayerUpdate player_update_compact = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_update_compact(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 capabilities = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.capabilities_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .WorldSnapshot world_snapshot = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_world_snapshot(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .SnapshotAck snapshot_ack = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_snapshot_ack(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:NetworkMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:NetworkMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void NetworkMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:NetworkMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* NetworkMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetworkMessage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .MessageType msg_id = 1;
-  if (this->msg_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->msg_id(), output);
+  if (this->_internal_msg_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_msg_id(), target);
   }
 
   // uint32 player_id = 2;
-  if (this->player_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->player_id(), output);
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_player_id(), target);
   }
 
   // uint32 timestamp = 3;
-  if (this->timestamp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->timestamp(), output);
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_timestamp(), target);
   }
 
   // .HeartbeatMessage heartbeat = 4;
-  if (has_heartbeat()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->_internal_heartbeat(), output);
+  if (_internal_has_heartbeat()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::heartbeat(this),
+        _Internal::heartbeat(this).GetCachedSize(), target, stream);
   }
 
   // .PlayerUpdateMessage player_update = 5;
-  if (has_player_update()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->_internal_player_update(), output);
+  if (_internal_has_player_update()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::player_update(this),
+        _Internal::player_update(this).GetCachedSize(), target, stream);
   }
 
   // .PlayerAttributeMessage player_attribute = 6;
-  if (has_player_attribute()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->_internal_player_attribute(), output);
+  if (_internal_has_player_attribute()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::player_attribute(this),
+        _Internal::player_attribute(this).GetCachedSize(), target, stream);
   }
 
   // .PlayerStateMessage player_state = 7;
-  if (has_player_state()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->_internal_player_state(), output);
+  if (_internal_has_player_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::player_state(this),
+        _Internal::player_state(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:NetworkMessage)
-}
-
-::google::protobuf::uint8* NetworkMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:NetworkMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .MessageType msg_id = 1;
-  if (this->msg_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->msg_id(), target);
-  }
-
-  // uint32 player_id = 2;
-  if (this->player_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->player_id(), target);
-  }
-
-  // uint32 timestamp = 3;
-  if (this->timestamp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->timestamp(), target);
+  // .UdpBindMessage udp_bind = 8;
+  if (_internal_has_udp_bind()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::udp_bind(this),
+        _Internal::udp_bind(this).GetCachedSize(), target, stream);
   }
 
-  // .HeartbeatMessage heartbeat = 4;
-  if (has_heartbeat()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        4, this->_internal_heartbeat(), deterministic, target);
+  // .CompactPlayerUpdate player_update_compact = 9;
+  if (_internal_has_player_update_compact()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::player_update_compact(this),
+        _Internal::player_update_compact(this).GetCachedSize(), target, stream);
   }
 
-  // .PlayerUpdateMessage player_update = 5;
-  if (has_player_update()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        5, this->_internal_player_update(), deterministic, target);
+  // uint32 capabilities = 10;
+  if (this->_internal_capabilities() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_capabilities(), target);
   }
 
-  // .PlayerAttributeMessage player_attribute = 6;
-  if (has_player_attribute()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        6, this->_internal_player_attribute(), deterministic, target);
+  // .WorldSnapshot world_snapshot = 11;
+  if (_internal_has_world_snapshot()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::world_snapshot(this),
+        _Internal::world_snapshot(this).GetCachedSize(), target, stream);
   }
 
-  // .PlayerStateMessage player_state = 7;
-  if (has_player_state()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        7, this->_internal_player_state(), deterministic, target);
+  // .SnapshotAck snapshot_ack = 12;
+  if (_internal_has_snapshot_ack()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::snapshot_ack(this),
+        _Internal::snapshot_ack(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:NetworkMessage)
   return target;
@@ -3078,128 +4185,168 @@ size_t NetworkMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:NetworkMessage)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // .MessageType msg_id = 1;
-  if (this->msg_id() != 0) {
+  if (this->_internal_msg_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->msg_id());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_msg_id());
   }
 
   // uint32 player_id = 2;
-  if (this->player_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->player_id());
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_player_id());
   }
 
   // uint32 timestamp = 3;
-  if (this->timestamp() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->timestamp());
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint32 capabilities = 10;
+  if (this->_internal_capabilities() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_capabilities());
   }
 
   switch (data_case()) {
     // .HeartbeatMessage heartbeat = 4;
     case kHeartbeat: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *data_.heartbeat_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.heartbeat_);
       break;
     }
     // .PlayerUpdateMessage player_update = 5;
     case kPlayerUpdate: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *data_.player_update_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.player_update_);
       break;
     }
     // .PlayerAttributeMessage player_attribute = 6;
     case kPlayerAttribute: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *data_.player_attribute_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.player_attribute_);
       break;
     }
     // .PlayerStateMessage player_state = 7;
     case kPlayerState: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *data_.player_state_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.player_state_);
+      break;
+    }
+    // .UdpBindMessage udp_bind = 8;
+    case kUdpBind: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.udp_bind_);
+      break;
+    }
+    // .CompactPlayerUpdate player_update_compact = 9;
+    case kPlayerUpdateCompact: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.player_update_compact_);
+      break;
+    }
+    // .WorldSnapshot world_snapshot = 11;
+    case kWorldSnapshot: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.world_snapshot_);
+      break;
+    }
+    // .SnapshotAck snapshot_ack = 12;
+    case kSnapshotAck: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.snapshot_ack_);
       break;
     }
     case DATA_NOT_SET: {
       break;
     }
   }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NetworkMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:NetworkMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NetworkMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const NetworkMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:NetworkMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:NetworkMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetworkMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetworkMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetworkMessage::GetClassData() const { return &_class_data_; }
+
 
-void NetworkMessage::MergeFrom(const NetworkMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:NetworkMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void NetworkMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetworkMessage*>(&to_msg);
+  auto& from = static_cast<const NetworkMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetworkMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.msg_id() != 0) {
-    set_msg_id(from.msg_id());
+  if (from._internal_msg_id() != 0) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
   }
-  if (from.player_id() != 0) {
-    set_player_id(from.player_id());
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
   }
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_capabilities() != 0) {
+    _this->_internal_set_capabilities(from._internal_capabilities());
   }
   switch (from.data_case()) {
     case kHeartbeat: {
-      mutable_heartbeat()->::HeartbeatMessage::MergeFrom(from.heartbeat());
+      _this->_internal_mutable_heartbeat()->::HeartbeatMessage::MergeFrom(
+          from._internal_heartbeat());
       break;
     }
     case kPlayerUpdate: {
-      mutable_player_update()->::PlayerUpdateMessage::MergeFrom(from.player_update());
+      _this->_internal_mutable_player_update()->::PlayerUpdateMessage::MergeFrom(
+          from._internal_player_update());
       break;
     }
     case kPlayerAttribute: {
-      mutable_player_attribute()->::PlayerAttributeMessage::MergeFrom(from.player_attribute());
+      _this->_internal_mutable_player_attribute()->::PlayerAttributeMessage::MergeFrom(
+          from._internal_player_attribute());
       break;
     }
     case kPlayerState: {
-      mutable_player_state()->::PlayerStateMessage::MergeFrom(from.player_state());
+      _this->_internal_mutable_player_state()->::PlayerStateMessage::MergeFrom(
+          from._internal_player_state());
+      break;
+    }
+    case kUdpBind: {
+      _this->_internal_mutable_udp_bind()->::UdpBindMessage::MergeFrom(
+          from._internal_udp_bind());
+      break;
+    }
+    case kPlayerUpdateCompact: {
+      _this->_internal_mutable_player_update_compact()->::CompactPlayerUpdate::MergeFrom(
+          from._internal_player_update_compact());
+      break;
+    }
+    case kWorldSnapshot: {
+      _this->_internal_mutable_world_snapshot()->::WorldSnapshot::MergeFrom(
+          from._internal_world_snapshot());
+      break;
+    }
+    case kSnapshotAck: {
+      _this->_internal_mutable_snapshot_ack()->::SnapshotAck::MergeFrom(
+          from._internal_snapshot_ack());
       break;
     }
     case DATA_NOT_SET: {
       break;
     }
   }
-}
-
-void NetworkMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:NetworkMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NetworkMessage::CopyFrom(const NetworkMessage& from) {
@@ -3213,54 +4360,84 @@ bool NetworkMessage::IsInitialized() const {
   return true;
 }
 
-void NetworkMessage::Swap(NetworkMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void NetworkMessage::InternalSwap(NetworkMessage* other) {
   using std::swap;
-  swap(msg_id_, other->msg_id_);
-  swap(player_id_, other->player_id_);
-  swap(timestamp_, other->timestamp_);
-  swap(data_, other->data_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NetworkMessage, _impl_.capabilities_)
+      + sizeof(NetworkMessage::_impl_.capabilities_)
+      - PROTOBUF_FIELD_OFFSET(NetworkMessage, _impl_.msg_id_)>(
+          reinterpret_cast<char*>(&_impl_.msg_id_),
+          reinterpret_cast<char*>(&other->_impl_.msg_id_));
+  swap(_impl_.data_, other->_impl_.data_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata NetworkMessage::GetMetadata() const {
-  protobuf_NetworkMessage_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_NetworkMessage_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata NetworkMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetworkMessage_2eproto_getter, &descriptor_table_NetworkMessage_2eproto_once,
+      file_level_metadata_NetworkMessage_2eproto[13]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Vector3* Arena::CreateMaybeMessage< ::Vector3 >(Arena* arena) {
-  return Arena::CreateInternal< ::Vector3 >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Vector3*
+Arena::CreateMaybeMessage< ::Vector3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Vector3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PlayerAttributeMessage_AmmoEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::PlayerAttributeMessage_AmmoEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PlayerAttributeMessage_AmmoEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PlayerAttributeMessage_WeaponsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::PlayerAttributeMessage_WeaponsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PlayerAttributeMessage_WeaponsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PlayerAttributeMessage*
+Arena::CreateMaybeMessage< ::PlayerAttributeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PlayerAttributeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PlayerStateMessage*
+Arena::CreateMaybeMessage< ::PlayerStateMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PlayerStateMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HeartbeatMessage*
+Arena::CreateMaybeMessage< ::HeartbeatMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HeartbeatMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PlayerUpdateMessage*
+Arena::CreateMaybeMessage< ::PlayerUpdateMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PlayerUpdateMessage >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::PlayerAttributeMessage_AmmoEntry_DoNotUse* Arena::CreateMaybeMessage< ::PlayerAttributeMessage_AmmoEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateInternal< ::PlayerAttributeMessage_AmmoEntry_DoNotUse >(arena);
+template<> PROTOBUF_NOINLINE ::CompactPlayerUpdate*
+Arena::CreateMaybeMessage< ::CompactPlayerUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CompactPlayerUpdate >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::PlayerAttributeMessage_WeaponsEntry_DoNotUse* Arena::CreateMaybeMessage< ::PlayerAttributeMessage_WeaponsEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateInternal< ::PlayerAttributeMessage_WeaponsEntry_DoNotUse >(arena);
+template<> PROTOBUF_NOINLINE ::UdpBindMessage*
+Arena::CreateMaybeMessage< ::UdpBindMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::UdpBindMessage >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::PlayerAttributeMessage* Arena::CreateMaybeMessage< ::PlayerAttributeMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::PlayerAttributeMessage >(arena);
+template<> PROTOBUF_NOINLINE ::EntityDelta*
+Arena::CreateMaybeMessage< ::EntityDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::EntityDelta >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::PlayerStateMessage* Arena::CreateMaybeMessage< ::PlayerStateMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::PlayerStateMessage >(arena);
+template<> PROTOBUF_NOINLINE ::WorldSnapshot*
+Arena::CreateMaybeMessage< ::WorldSnapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WorldSnapshot >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::HeartbeatMessage* Arena::CreateMaybeMessage< ::HeartbeatMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::HeartbeatMessage >(arena);
+template<> PROTOBUF_NOINLINE ::SnapshotAck*
+Arena::CreateMaybeMessage< ::SnapshotAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SnapshotAck >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::PlayerUpdateMessage* Arena::CreateMaybeMessage< ::PlayerUpdateMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::PlayerUpdateMessage >(arena);
+template<> PROTOBUF_NOINLINE ::MessageBatch*
+Arena::CreateMaybeMessage< ::MessageBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MessageBatch >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::NetworkMessage* Arena::CreateMaybeMessage< ::NetworkMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::NetworkMessage >(arena);
+template<> PROTOBUF_NOINLINE ::NetworkMessage*
+Arena::CreateMaybeMessage< ::NetworkMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetworkMessage >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
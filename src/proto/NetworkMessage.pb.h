@@ -1,31 +1,32 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: NetworkMessage.proto
 
-#ifndef PROTOBUF_INCLUDED_NetworkMessage_2eproto
-#define PROTOBUF_INCLUDED_NetworkMessage_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_NetworkMessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_NetworkMessage_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
@@ -35,114 +36,182 @@
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_NetworkMessage_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_NetworkMessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_NetworkMessage_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[8];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_NetworkMessage_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_NetworkMessage_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_NetworkMessage_2eproto;
+class CompactPlayerUpdate;
+struct CompactPlayerUpdateDefaultTypeInternal;
+extern CompactPlayerUpdateDefaultTypeInternal _CompactPlayerUpdate_default_instance_;
+class EntityDelta;
+struct EntityDeltaDefaultTypeInternal;
+extern EntityDeltaDefaultTypeInternal _EntityDelta_default_instance_;
 class HeartbeatMessage;
-class HeartbeatMessageDefaultTypeInternal;
+struct HeartbeatMessageDefaultTypeInternal;
 extern HeartbeatMessageDefaultTypeInternal _HeartbeatMessage_default_instance_;
+class MessageBatch;
+struct MessageBatchDefaultTypeInternal;
+extern MessageBatchDefaultTypeInternal _MessageBatch_default_instance_;
 class NetworkMessage;
-class NetworkMessageDefaultTypeInternal;
+struct NetworkMessageDefaultTypeInternal;
 extern NetworkMessageDefaultTypeInternal _NetworkMessage_default_instance_;
 class PlayerAttributeMessage;
-class PlayerAttributeMessageDefaultTypeInternal;
+struct PlayerAttributeMessageDefaultTypeInternal;
 extern PlayerAttributeMessageDefaultTypeInternal _PlayerAttributeMessage_default_instance_;
 class PlayerAttributeMessage_AmmoEntry_DoNotUse;
-class PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal;
+struct PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal;
 extern PlayerAttributeMessage_AmmoEntry_DoNotUseDefaultTypeInternal _PlayerAttributeMessage_AmmoEntry_DoNotUse_default_instance_;
 class PlayerAttributeMessage_WeaponsEntry_DoNotUse;
-class PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal;
+struct PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal;
 extern PlayerAttributeMessage_WeaponsEntry_DoNotUseDefaultTypeInternal _PlayerAttributeMessage_WeaponsEntry_DoNotUse_default_instance_;
 class PlayerStateMessage;
-class PlayerStateMessageDefaultTypeInternal;
+struct PlayerStateMessageDefaultTypeInternal;
 extern PlayerStateMessageDefaultTypeInternal _PlayerStateMessage_default_instance_;
 class PlayerUpdateMessage;
-class PlayerUpdateMessageDefaultTypeInternal;
+struct PlayerUpdateMessageDefaultTypeInternal;
 extern PlayerUpdateMessageDefaultTypeInternal _PlayerUpdateMessage_default_instance_;
+class SnapshotAck;
+struct SnapshotAckDefaultTypeInternal;
+extern SnapshotAckDefaultTypeInternal _SnapshotAck_default_instance_;
+class UdpBindMessage;
+struct UdpBindMessageDefaultTypeInternal;
+extern UdpBindMessageDefaultTypeInternal _UdpBindMessage_default_instance_;
 class Vector3;
-class Vector3DefaultTypeInternal;
+struct Vector3DefaultTypeInternal;
 extern Vector3DefaultTypeInternal _Vector3_default_instance_;
-namespace google {
-namespace protobuf {
+class WorldSnapshot;
+struct WorldSnapshotDefaultTypeInternal;
+extern WorldSnapshotDefaultTypeInternal _WorldSnapshot_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CompactPlayerUpdate* Arena::CreateMaybeMessage<::CompactPlayerUpdate>(Arena*);
+template<> ::EntityDelta* Arena::CreateMaybeMessage<::EntityDelta>(Arena*);
 template<> ::HeartbeatMessage* Arena::CreateMaybeMessage<::HeartbeatMessage>(Arena*);
+template<> ::MessageBatch* Arena::CreateMaybeMessage<::MessageBatch>(Arena*);
 template<> ::NetworkMessage* Arena::CreateMaybeMessage<::NetworkMessage>(Arena*);
 template<> ::PlayerAttributeMessage* Arena::CreateMaybeMessage<::PlayerAttributeMessage>(Arena*);
 template<> ::PlayerAttributeMessage_AmmoEntry_DoNotUse* Arena::CreateMaybeMessage<::PlayerAttributeMessage_AmmoEntry_DoNotUse>(Arena*);
 template<> ::PlayerAttributeMessage_WeaponsEntry_DoNotUse* Arena::CreateMaybeMessage<::PlayerAttributeMessage_WeaponsEntry_DoNotUse>(Arena*);
 template<> ::PlayerStateMessage* Arena::CreateMaybeMessage<::PlayerStateMessage>(Arena*);
 template<> ::PlayerUpdateMessage* Arena::CreateMaybeMessage<::PlayerUpdateMessage>(Arena*);
+template<> ::SnapshotAck* Arena::CreateMaybeMessage<::SnapshotAck>(Arena*);
+template<> ::UdpBindMessage* Arena::CreateMaybeMessage<::UdpBindMessage>(Arena*);
 template<> ::Vector3* Arena::CreateMaybeMessage<::Vector3>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::WorldSnapshot* Arena::CreateMaybeMessage<::WorldSnapshot>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 
-enum MessageType {
+enum MessageType : int {
   HEARTBEAT = 0,
   PLAYER_UPDATE = 1,
   PLAYER_ATTRIBUTE = 2,
   PLAYER_STATE = 3,
   PLAYER_JOIN = 4,
   PLAYER_LEAVE = 5,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  UDP_BIND = 6,
+  WORLD_SNAPSHOT = 7,
+  SNAPSHOT_ACK = 8,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
-const MessageType MessageType_MIN = HEARTBEAT;
-const MessageType MessageType_MAX = PLAYER_LEAVE;
-const int MessageType_ARRAYSIZE = MessageType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor();
-inline const ::std::string& MessageType_Name(MessageType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    MessageType_descriptor(), value);
+constexpr MessageType MessageType_MIN = HEARTBEAT;
+constexpr MessageType MessageType_MAX = SNAPSHOT_ACK;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const ::std::string& name, MessageType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<MessageType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
+enum Capability : int {
+  CAPABILITY_NONE = 0,
+  CAPABILITY_COMPACT_TRANSFORM = 1,
+  CAPABILITY_BATCH = 2,
+  CAPABILITY_COMPRESSION = 4,
+  Capability_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Capability_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Capability_IsValid(int value);
+constexpr Capability Capability_MIN = CAPABILITY_NONE;
+constexpr Capability Capability_MAX = CAPABILITY_COMPRESSION;
+constexpr int Capability_ARRAYSIZE = Capability_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Capability_descriptor();
+template<typename T>
+inline const std::string& Capability_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Capability>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Capability_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Capability_descriptor(), enum_t_value);
+}
+inline bool Capability_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Capability* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Capability>(
+    Capability_descriptor(), name, value);
+}
 // ===================================================================
 
-class Vector3 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Vector3) */ {
+class Vector3 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Vector3) */ {
  public:
-  Vector3();
-  virtual ~Vector3();
+  inline Vector3() : Vector3(nullptr) {}
+  ~Vector3() override;
+  explicit PROTOBUF_CONSTEXPR Vector3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Vector3(const Vector3& from);
-
-  inline Vector3& operator=(const Vector3& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Vector3(Vector3&& from) noexcept
     : Vector3() {
     *this = ::std::move(from);
   }
 
+  inline Vector3& operator=(const Vector3& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Vector3& operator=(Vector3&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Vector3& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Vector3& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Vector3* internal_default_instance() {
     return reinterpret_cast<const Vector3*>(
                &_Vector3_default_instance_);
@@ -150,158 +219,221 @@ class Vector3 : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Vector3* other);
   friend void swap(Vector3& a, Vector3& b) {
     a.Swap(&b);
   }
+  inline void Swap(Vector3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Vector3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Vector3* New() const final {
-    return CreateMaybeMessage<Vector3>(NULL);
-  }
-
-  Vector3* New(::google::protobuf::Arena* arena) const final {
+  Vector3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Vector3>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Vector3& from);
-  void MergeFrom(const Vector3& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Vector3& from) {
+    Vector3::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Vector3* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Vector3";
   }
+  protected:
+  explicit Vector3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kZFieldNumber = 3,
+  };
   // float x = 1;
   void clear_x();
-  static const int kXFieldNumber = 1;
   float x() const;
   void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
 
   // float y = 2;
   void clear_y();
-  static const int kYFieldNumber = 2;
   float y() const;
   void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
 
   // float z = 3;
   void clear_z();
-  static const int kZFieldNumber = 3;
   float z() const;
   void set_z(float value);
+  private:
+  float _internal_z() const;
+  void _internal_set_z(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:Vector3)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float x_;
-  float y_;
-  float z_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_NetworkMessage_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float x_;
+    float y_;
+    float z_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerAttributeMessage_AmmoEntry_DoNotUse : public ::google::protobuf::internal::MapEntry<PlayerAttributeMessage_AmmoEntry_DoNotUse, 
-    ::std::string, ::google::protobuf::int32,
-    ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-    ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-    0 > {
+class PlayerAttributeMessage_AmmoEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<PlayerAttributeMessage_AmmoEntry_DoNotUse, 
+    std::string, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> {
 public:
-  typedef ::google::protobuf::internal::MapEntry<PlayerAttributeMessage_AmmoEntry_DoNotUse, 
-    ::std::string, ::google::protobuf::int32,
-    ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-    ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-    0 > SuperType;
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<PlayerAttributeMessage_AmmoEntry_DoNotUse, 
+    std::string, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> SuperType;
   PlayerAttributeMessage_AmmoEntry_DoNotUse();
-  PlayerAttributeMessage_AmmoEntry_DoNotUse(::google::protobuf::Arena* arena);
+  explicit PROTOBUF_CONSTEXPR PlayerAttributeMessage_AmmoEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PlayerAttributeMessage_AmmoEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   void MergeFrom(const PlayerAttributeMessage_AmmoEntry_DoNotUse& other);
   static const PlayerAttributeMessage_AmmoEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const PlayerAttributeMessage_AmmoEntry_DoNotUse*>(&_PlayerAttributeMessage_AmmoEntry_DoNotUse_default_instance_); }
-  void MergeFrom(const ::google::protobuf::Message& other) final;
-  ::google::protobuf::Metadata GetMetadata() const;
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "PlayerAttributeMessage.AmmoEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_NetworkMessage_2eproto;
 };
 
 // -------------------------------------------------------------------
 
-class PlayerAttributeMessage_WeaponsEntry_DoNotUse : public ::google::protobuf::internal::MapEntry<PlayerAttributeMessage_WeaponsEntry_DoNotUse, 
-    ::std::string, ::google::protobuf::int32,
-    ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-    ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-    0 > {
+class PlayerAttributeMessage_WeaponsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<PlayerAttributeMessage_WeaponsEntry_DoNotUse, 
+    std::string, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> {
 public:
-  typedef ::google::protobuf::internal::MapEntry<PlayerAttributeMessage_WeaponsEntry_DoNotUse, 
-    ::std::string, ::google::protobuf::int32,
-    ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-    ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-    0 > SuperType;
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<PlayerAttributeMessage_WeaponsEntry_DoNotUse, 
+    std::string, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> SuperType;
   PlayerAttributeMessage_WeaponsEntry_DoNotUse();
-  PlayerAttributeMessage_WeaponsEntry_DoNotUse(::google::protobuf::Arena* arena);
+  explicit PROTOBUF_CONSTEXPR PlayerAttributeMessage_WeaponsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PlayerAttributeMessage_WeaponsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   void MergeFrom(const PlayerAttributeMessage_WeaponsEntry_DoNotUse& other);
   static const PlayerAttributeMessage_WeaponsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const PlayerAttributeMessage_WeaponsEntry_DoNotUse*>(&_PlayerAttributeMessage_WeaponsEntry_DoNotUse_default_instance_); }
-  void MergeFrom(const ::google::protobuf::Message& other) final;
-  ::google::protobuf::Metadata GetMetadata() const;
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "PlayerAttributeMessage.WeaponsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_NetworkMessage_2eproto;
 };
 
 // -------------------------------------------------------------------
 
-class PlayerAttributeMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:PlayerAttributeMessage) */ {
+class PlayerAttributeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PlayerAttributeMessage) */ {
  public:
-  PlayerAttributeMessage();
-  virtual ~PlayerAttributeMessage();
+  inline PlayerAttributeMessage() : PlayerAttributeMessage(nullptr) {}
+  ~PlayerAttributeMessage() override;
+  explicit PROTOBUF_CONSTEXPR PlayerAttributeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PlayerAttributeMessage(const PlayerAttributeMessage& from);
-
-  inline PlayerAttributeMessage& operator=(const PlayerAttributeMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PlayerAttributeMessage(PlayerAttributeMessage&& from) noexcept
     : PlayerAttributeMessage() {
     *this = ::std::move(from);
   }
 
+  inline PlayerAttributeMessage& operator=(const PlayerAttributeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PlayerAttributeMessage& operator=(PlayerAttributeMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerAttributeMessage& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerAttributeMessage& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PlayerAttributeMessage* internal_default_instance() {
     return reinterpret_cast<const PlayerAttributeMessage*>(
                &_PlayerAttributeMessage_default_instance_);
@@ -309,175 +441,262 @@ class PlayerAttributeMessage : public ::google::protobuf::Message /* @@protoc_in
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(PlayerAttributeMessage* other);
   friend void swap(PlayerAttributeMessage& a, PlayerAttributeMessage& b) {
     a.Swap(&b);
   }
+  inline void Swap(PlayerAttributeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerAttributeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PlayerAttributeMessage* New() const final {
-    return CreateMaybeMessage<PlayerAttributeMessage>(NULL);
-  }
-
-  PlayerAttributeMessage* New(::google::protobuf::Arena* arena) const final {
+  PlayerAttributeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PlayerAttributeMessage>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayerAttributeMessage& from);
-  void MergeFrom(const PlayerAttributeMessage& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerAttributeMessage& from) {
+    PlayerAttributeMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PlayerAttributeMessage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PlayerAttributeMessage";
   }
+  protected:
+  explicit PlayerAttributeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kAmmoFieldNumber = 4,
+    kWeaponsFieldNumber = 5,
+    kPlayerIdFieldNumber = 1,
+    kHealthFieldNumber = 2,
+    kMaxHealthFieldNumber = 3,
+    kArmorFieldNumber = 6,
+    kScoreFieldNumber = 7,
+    kKillsFieldNumber = 8,
+    kDeathsFieldNumber = 9,
+  };
   // map<string, int32> ammo = 4;
   int ammo_size() const;
+  private:
+  int _internal_ammo_size() const;
+  public:
   void clear_ammo();
-  static const int kAmmoFieldNumber = 4;
-  const ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >&
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
+      _internal_ammo() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
+      _internal_mutable_ammo();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
       ammo() const;
-  ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
       mutable_ammo();
 
   // map<string, int32> weapons = 5;
   int weapons_size() const;
+  private:
+  int _internal_weapons_size() const;
+  public:
   void clear_weapons();
-  static const int kWeaponsFieldNumber = 5;
-  const ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >&
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
+      _internal_weapons() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
+      _internal_mutable_weapons();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
       weapons() const;
-  ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
       mutable_weapons();
 
   // uint32 player_id = 1;
   void clear_player_id();
-  static const int kPlayerIdFieldNumber = 1;
-  ::google::protobuf::uint32 player_id() const;
-  void set_player_id(::google::protobuf::uint32 value);
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
 
   // float health = 2;
   void clear_health();
-  static const int kHealthFieldNumber = 2;
   float health() const;
   void set_health(float value);
+  private:
+  float _internal_health() const;
+  void _internal_set_health(float value);
+  public:
 
   // float max_health = 3;
   void clear_max_health();
-  static const int kMaxHealthFieldNumber = 3;
   float max_health() const;
   void set_max_health(float value);
+  private:
+  float _internal_max_health() const;
+  void _internal_set_max_health(float value);
+  public:
 
   // float armor = 6;
   void clear_armor();
-  static const int kArmorFieldNumber = 6;
   float armor() const;
   void set_armor(float value);
+  private:
+  float _internal_armor() const;
+  void _internal_set_armor(float value);
+  public:
 
   // int32 score = 7;
   void clear_score();
-  static const int kScoreFieldNumber = 7;
-  ::google::protobuf::int32 score() const;
-  void set_score(::google::protobuf::int32 value);
+  int32_t score() const;
+  void set_score(int32_t value);
+  private:
+  int32_t _internal_score() const;
+  void _internal_set_score(int32_t value);
+  public:
 
   // int32 kills = 8;
   void clear_kills();
-  static const int kKillsFieldNumber = 8;
-  ::google::protobuf::int32 kills() const;
-  void set_kills(::google::protobuf::int32 value);
+  int32_t kills() const;
+  void set_kills(int32_t value);
+  private:
+  int32_t _internal_kills() const;
+  void _internal_set_kills(int32_t value);
+  public:
 
   // int32 deaths = 9;
   void clear_deaths();
-  static const int kDeathsFieldNumber = 9;
-  ::google::protobuf::int32 deaths() const;
-  void set_deaths(::google::protobuf::int32 value);
+  int32_t deaths() const;
+  void set_deaths(int32_t value);
+  private:
+  int32_t _internal_deaths() const;
+  void _internal_set_deaths(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:PlayerAttributeMessage)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::MapField<
-      PlayerAttributeMessage_AmmoEntry_DoNotUse,
-      ::std::string, ::google::protobuf::int32,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-      0 > ammo_;
-  ::google::protobuf::internal::MapField<
-      PlayerAttributeMessage_WeaponsEntry_DoNotUse,
-      ::std::string, ::google::protobuf::int32,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-      0 > weapons_;
-  ::google::protobuf::uint32 player_id_;
-  float health_;
-  float max_health_;
-  float armor_;
-  ::google::protobuf::int32 score_;
-  ::google::protobuf::int32 kills_;
-  ::google::protobuf::int32 deaths_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_NetworkMessage_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        PlayerAttributeMessage_AmmoEntry_DoNotUse,
+        std::string, int32_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> ammo_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        PlayerAttributeMessage_WeaponsEntry_DoNotUse,
+        std::string, int32_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> weapons_;
+    uint32_t player_id_;
+    float health_;
+    float max_health_;
+    float armor_;
+    int32_t score_;
+    int32_t kills_;
+    int32_t deaths_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerStateMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:PlayerStateMessage) */ {
+class PlayerStateMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PlayerStateMessage) */ {
  public:
-  PlayerStateMessage();
-  virtual ~PlayerStateMessage();
+  inline PlayerStateMessage() : PlayerStateMessage(nullptr) {}
+  ~PlayerStateMessage() override;
+  explicit PROTOBUF_CONSTEXPR PlayerStateMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PlayerStateMessage(const PlayerStateMessage& from);
-
-  inline PlayerStateMessage& operator=(const PlayerStateMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PlayerStateMessage(PlayerStateMessage&& from) noexcept
     : PlayerStateMessage() {
     *this = ::std::move(from);
   }
 
+  inline PlayerStateMessage& operator=(const PlayerStateMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PlayerStateMessage& operator=(PlayerStateMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerStateMessage& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerStateMessage& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PlayerStateMessage* internal_default_instance() {
     return reinterpret_cast<const PlayerStateMessage*>(
                &_PlayerStateMessage_default_instance_);
@@ -485,155 +704,244 @@ class PlayerStateMessage : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(PlayerStateMessage* other);
   friend void swap(PlayerStateMessage& a, PlayerStateMessage& b) {
     a.Swap(&b);
   }
+  inline void Swap(PlayerStateMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerStateMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PlayerStateMessage* New() const final {
-    return CreateMaybeMessage<PlayerStateMessage>(NULL);
-  }
-
-  PlayerStateMessage* New(::google::protobuf::Arena* arena) const final {
+  PlayerStateMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PlayerStateMessage>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayerStateMessage& from);
-  void MergeFrom(const PlayerStateMessage& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerStateMessage& from) {
+    PlayerStateMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PlayerStateMessage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PlayerStateMessage";
   }
+  protected:
+  explicit PlayerStateMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kCompactTransformFieldNumber = 7,
+    kPositionFieldNumber = 2,
+    kRotationFieldNumber = 3,
+    kAttributesFieldNumber = 4,
+    kPlayerIdFieldNumber = 1,
+    kIsAliveFieldNumber = 5,
+    kTeamIdFieldNumber = 6,
+  };
+  // bytes compact_transform = 7;
+  void clear_compact_transform();
+  const std::string& compact_transform() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_compact_transform(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_compact_transform();
+  PROTOBUF_NODISCARD std::string* release_compact_transform();
+  void set_allocated_compact_transform(std::string* compact_transform);
+  private:
+  const std::string& _internal_compact_transform() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_compact_transform(const std::string& value);
+  std::string* _internal_mutable_compact_transform();
+  public:
+
   // .Vector3 position = 2;
   bool has_position() const;
-  void clear_position();
-  static const int kPositionFieldNumber = 2;
   private:
-  const ::Vector3& _internal_position() const;
+  bool _internal_has_position() const;
   public:
+  void clear_position();
   const ::Vector3& position() const;
-  ::Vector3* release_position();
+  PROTOBUF_NODISCARD ::Vector3* release_position();
   ::Vector3* mutable_position();
   void set_allocated_position(::Vector3* position);
+  private:
+  const ::Vector3& _internal_position() const;
+  ::Vector3* _internal_mutable_position();
+  public:
+  void unsafe_arena_set_allocated_position(
+      ::Vector3* position);
+  ::Vector3* unsafe_arena_release_position();
 
   // .Vector3 rotation = 3;
   bool has_rotation() const;
-  void clear_rotation();
-  static const int kRotationFieldNumber = 3;
   private:
-  const ::Vector3& _internal_rotation() const;
+  bool _internal_has_rotation() const;
   public:
+  void clear_rotation();
   const ::Vector3& rotation() const;
-  ::Vector3* release_rotation();
+  PROTOBUF_NODISCARD ::Vector3* release_rotation();
   ::Vector3* mutable_rotation();
   void set_allocated_rotation(::Vector3* rotation);
+  private:
+  const ::Vector3& _internal_rotation() const;
+  ::Vector3* _internal_mutable_rotation();
+  public:
+  void unsafe_arena_set_allocated_rotation(
+      ::Vector3* rotation);
+  ::Vector3* unsafe_arena_release_rotation();
 
   // .PlayerAttributeMessage attributes = 4;
   bool has_attributes() const;
-  void clear_attributes();
-  static const int kAttributesFieldNumber = 4;
   private:
-  const ::PlayerAttributeMessage& _internal_attributes() const;
+  bool _internal_has_attributes() const;
   public:
+  void clear_attributes();
   const ::PlayerAttributeMessage& attributes() const;
-  ::PlayerAttributeMessage* release_attributes();
+  PROTOBUF_NODISCARD ::PlayerAttributeMessage* release_attributes();
   ::PlayerAttributeMessage* mutable_attributes();
   void set_allocated_attributes(::PlayerAttributeMessage* attributes);
+  private:
+  const ::PlayerAttributeMessage& _internal_attributes() const;
+  ::PlayerAttributeMessage* _internal_mutable_attributes();
+  public:
+  void unsafe_arena_set_allocated_attributes(
+      ::PlayerAttributeMessage* attributes);
+  ::PlayerAttributeMessage* unsafe_arena_release_attributes();
 
   // uint32 player_id = 1;
   void clear_player_id();
-  static const int kPlayerIdFieldNumber = 1;
-  ::google::protobuf::uint32 player_id() const;
-  void set_player_id(::google::protobuf::uint32 value);
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
 
   // bool is_alive = 5;
   void clear_is_alive();
-  static const int kIsAliveFieldNumber = 5;
   bool is_alive() const;
   void set_is_alive(bool value);
+  private:
+  bool _internal_is_alive() const;
+  void _internal_set_is_alive(bool value);
+  public:
 
   // uint32 team_id = 6;
   void clear_team_id();
-  static const int kTeamIdFieldNumber = 6;
-  ::google::protobuf::uint32 team_id() const;
-  void set_team_id(::google::protobuf::uint32 value);
+  uint32_t team_id() const;
+  void set_team_id(uint32_t value);
+  private:
+  uint32_t _internal_team_id() const;
+  void _internal_set_team_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:PlayerStateMessage)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::Vector3* position_;
-  ::Vector3* rotation_;
-  ::PlayerAttributeMessage* attributes_;
-  ::google::protobuf::uint32 player_id_;
-  bool is_alive_;
-  ::google::protobuf::uint32 team_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_NetworkMessage_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr compact_transform_;
+    ::Vector3* position_;
+    ::Vector3* rotation_;
+    ::PlayerAttributeMessage* attributes_;
+    uint32_t player_id_;
+    bool is_alive_;
+    uint32_t team_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HeartbeatMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HeartbeatMessage) */ {
+class HeartbeatMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:HeartbeatMessage) */ {
  public:
-  HeartbeatMessage();
-  virtual ~HeartbeatMessage();
+  inline HeartbeatMessage() : HeartbeatMessage(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR HeartbeatMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HeartbeatMessage(const HeartbeatMessage& from);
-
-  inline HeartbeatMessage& operator=(const HeartbeatMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   HeartbeatMessage(HeartbeatMessage&& from) noexcept
     : HeartbeatMessage() {
     *this = ::std::move(from);
   }
 
+  inline HeartbeatMessage& operator=(const HeartbeatMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline HeartbeatMessage& operator=(HeartbeatMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HeartbeatMessage& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HeartbeatMessage& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const HeartbeatMessage* internal_default_instance() {
     return reinterpret_cast<const HeartbeatMessage*>(
                &_HeartbeatMessage_default_instance_);
@@ -641,51 +949,57 @@ class HeartbeatMessage : public ::google::protobuf::Message /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(HeartbeatMessage* other);
   friend void swap(HeartbeatMessage& a, HeartbeatMessage& b) {
     a.Swap(&b);
   }
+  inline void Swap(HeartbeatMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HeartbeatMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HeartbeatMessage* New() const final {
-    return CreateMaybeMessage<HeartbeatMessage>(NULL);
-  }
-
-  HeartbeatMessage* New(::google::protobuf::Arena* arena) const final {
+  HeartbeatMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<HeartbeatMessage>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const HeartbeatMessage& from);
-  void MergeFrom(const HeartbeatMessage& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const HeartbeatMessage& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const HeartbeatMessage& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(HeartbeatMessage* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HeartbeatMessage";
   }
+  protected:
+  explicit HeartbeatMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -693,43 +1007,60 @@ class HeartbeatMessage : public ::google::protobuf::Message /* @@protoc_insertio
 
   // @@protoc_insertion_point(class_scope:HeartbeatMessage)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_NetworkMessage_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerUpdateMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:PlayerUpdateMessage) */ {
+class PlayerUpdateMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PlayerUpdateMessage) */ {
  public:
-  PlayerUpdateMessage();
-  virtual ~PlayerUpdateMessage();
+  inline PlayerUpdateMessage() : PlayerUpdateMessage(nullptr) {}
+  ~PlayerUpdateMessage() override;
+  explicit PROTOBUF_CONSTEXPR PlayerUpdateMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PlayerUpdateMessage(const PlayerUpdateMessage& from);
-
-  inline PlayerUpdateMessage& operator=(const PlayerUpdateMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PlayerUpdateMessage(PlayerUpdateMessage&& from) noexcept
     : PlayerUpdateMessage() {
     *this = ::std::move(from);
   }
 
+  inline PlayerUpdateMessage& operator=(const PlayerUpdateMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PlayerUpdateMessage& operator=(PlayerUpdateMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerUpdateMessage& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerUpdateMessage& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PlayerUpdateMessage* internal_default_instance() {
     return reinterpret_cast<const PlayerUpdateMessage*>(
                &_PlayerUpdateMessage_default_instance_);
@@ -737,894 +1068,2943 @@ class PlayerUpdateMessage : public ::google::protobuf::Message /* @@protoc_inser
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(PlayerUpdateMessage* other);
   friend void swap(PlayerUpdateMessage& a, PlayerUpdateMessage& b) {
     a.Swap(&b);
   }
+  inline void Swap(PlayerUpdateMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerUpdateMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PlayerUpdateMessage* New() const final {
-    return CreateMaybeMessage<PlayerUpdateMessage>(NULL);
-  }
-
-  PlayerUpdateMessage* New(::google::protobuf::Arena* arena) const final {
+  PlayerUpdateMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PlayerUpdateMessage>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayerUpdateMessage& from);
-  void MergeFrom(const PlayerUpdateMessage& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerUpdateMessage& from) {
+    PlayerUpdateMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PlayerUpdateMessage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PlayerUpdateMessage";
   }
+  protected:
+  explicit PlayerUpdateMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPositionXFieldNumber = 1,
+    kPositionYFieldNumber = 2,
+    kPositionZFieldNumber = 3,
+    kRotationXFieldNumber = 4,
+    kRotationYFieldNumber = 5,
+    kRotationZFieldNumber = 6,
+    kVelocityXFieldNumber = 7,
+    kVelocityYFieldNumber = 8,
+    kVelocityZFieldNumber = 9,
+    kIsGroundedFieldNumber = 10,
+    kHealthFieldNumber = 11,
+  };
   // float position_x = 1;
   void clear_position_x();
-  static const int kPositionXFieldNumber = 1;
   float position_x() const;
   void set_position_x(float value);
+  private:
+  float _internal_position_x() const;
+  void _internal_set_position_x(float value);
+  public:
 
   // float position_y = 2;
   void clear_position_y();
-  static const int kPositionYFieldNumber = 2;
   float position_y() const;
   void set_position_y(float value);
+  private:
+  float _internal_position_y() const;
+  void _internal_set_position_y(float value);
+  public:
 
   // float position_z = 3;
   void clear_position_z();
-  static const int kPositionZFieldNumber = 3;
   float position_z() const;
   void set_position_z(float value);
+  private:
+  float _internal_position_z() const;
+  void _internal_set_position_z(float value);
+  public:
 
   // float rotation_x = 4;
   void clear_rotation_x();
-  static const int kRotationXFieldNumber = 4;
   float rotation_x() const;
   void set_rotation_x(float value);
+  private:
+  float _internal_rotation_x() const;
+  void _internal_set_rotation_x(float value);
+  public:
 
   // float rotation_y = 5;
   void clear_rotation_y();
-  static const int kRotationYFieldNumber = 5;
   float rotation_y() const;
   void set_rotation_y(float value);
+  private:
+  float _internal_rotation_y() const;
+  void _internal_set_rotation_y(float value);
+  public:
 
   // float rotation_z = 6;
   void clear_rotation_z();
-  static const int kRotationZFieldNumber = 6;
   float rotation_z() const;
   void set_rotation_z(float value);
+  private:
+  float _internal_rotation_z() const;
+  void _internal_set_rotation_z(float value);
+  public:
 
   // float velocity_x = 7;
   void clear_velocity_x();
-  static const int kVelocityXFieldNumber = 7;
   float velocity_x() const;
   void set_velocity_x(float value);
+  private:
+  float _internal_velocity_x() const;
+  void _internal_set_velocity_x(float value);
+  public:
 
   // float velocity_y = 8;
   void clear_velocity_y();
-  static const int kVelocityYFieldNumber = 8;
   float velocity_y() const;
   void set_velocity_y(float value);
+  private:
+  float _internal_velocity_y() const;
+  void _internal_set_velocity_y(float value);
+  public:
 
   // float velocity_z = 9;
   void clear_velocity_z();
-  static const int kVelocityZFieldNumber = 9;
   float velocity_z() const;
   void set_velocity_z(float value);
+  private:
+  float _internal_velocity_z() const;
+  void _internal_set_velocity_z(float value);
+  public:
 
   // bool is_grounded = 10;
   void clear_is_grounded();
-  static const int kIsGroundedFieldNumber = 10;
   bool is_grounded() const;
   void set_is_grounded(bool value);
+  private:
+  bool _internal_is_grounded() const;
+  void _internal_set_is_grounded(bool value);
+  public:
 
   // float health = 11;
   void clear_health();
-  static const int kHealthFieldNumber = 11;
   float health() const;
   void set_health(float value);
+  private:
+  float _internal_health() const;
+  void _internal_set_health(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:PlayerUpdateMessage)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float position_x_;
-  float position_y_;
-  float position_z_;
-  float rotation_x_;
-  float rotation_y_;
-  float rotation_z_;
-  float velocity_x_;
-  float velocity_y_;
-  float velocity_z_;
-  bool is_grounded_;
-  float health_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_NetworkMessage_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float position_x_;
+    float position_y_;
+    float position_z_;
+    float rotation_x_;
+    float rotation_y_;
+    float rotation_z_;
+    float velocity_x_;
+    float velocity_y_;
+    float velocity_z_;
+    bool is_grounded_;
+    float health_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NetworkMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:NetworkMessage) */ {
+class CompactPlayerUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CompactPlayerUpdate) */ {
  public:
-  NetworkMessage();
-  virtual ~NetworkMessage();
+  inline CompactPlayerUpdate() : CompactPlayerUpdate(nullptr) {}
+  ~CompactPlayerUpdate() override;
+  explicit PROTOBUF_CONSTEXPR CompactPlayerUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  NetworkMessage(const NetworkMessage& from);
+  CompactPlayerUpdate(const CompactPlayerUpdate& from);
+  CompactPlayerUpdate(CompactPlayerUpdate&& from) noexcept
+    : CompactPlayerUpdate() {
+    *this = ::std::move(from);
+  }
 
-  inline NetworkMessage& operator=(const NetworkMessage& from) {
+  inline CompactPlayerUpdate& operator=(const CompactPlayerUpdate& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  NetworkMessage(NetworkMessage&& from) noexcept
-    : NetworkMessage() {
-    *this = ::std::move(from);
-  }
-
-  inline NetworkMessage& operator=(NetworkMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline CompactPlayerUpdate& operator=(CompactPlayerUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NetworkMessage& default_instance();
-
-  enum DataCase {
-    kHeartbeat = 4,
-    kPlayerUpdate = 5,
-    kPlayerAttribute = 6,
-    kPlayerState = 7,
-    DATA_NOT_SET = 0,
-  };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const NetworkMessage* internal_default_instance() {
-    return reinterpret_cast<const NetworkMessage*>(
-               &_NetworkMessage_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompactPlayerUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompactPlayerUpdate* internal_default_instance() {
+    return reinterpret_cast<const CompactPlayerUpdate*>(
+               &_CompactPlayerUpdate_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(NetworkMessage* other);
-  friend void swap(NetworkMessage& a, NetworkMessage& b) {
+  friend void swap(CompactPlayerUpdate& a, CompactPlayerUpdate& b) {
     a.Swap(&b);
   }
+  inline void Swap(CompactPlayerUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompactPlayerUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline NetworkMessage* New() const final {
-    return CreateMaybeMessage<NetworkMessage>(NULL);
+  CompactPlayerUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompactPlayerUpdate>(arena);
   }
-
-  NetworkMessage* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<NetworkMessage>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompactPlayerUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompactPlayerUpdate& from) {
+    CompactPlayerUpdate::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const NetworkMessage& from);
-  void MergeFrom(const NetworkMessage& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(NetworkMessage* other);
+  void InternalSwap(CompactPlayerUpdate* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CompactPlayerUpdate";
   }
+  protected:
+  explicit CompactPlayerUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // .MessageType msg_id = 1;
-  void clear_msg_id();
-  static const int kMsgIdFieldNumber = 1;
-  ::MessageType msg_id() const;
-  void set_msg_id(::MessageType value);
+  enum : int {
+    kStateFieldNumber = 1,
+    kHealthFieldNumber = 2,
+  };
+  // bytes state = 1;
+  void clear_state();
+  const std::string& state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_state();
+  PROTOBUF_NODISCARD std::string* release_state();
+  void set_allocated_state(std::string* state);
+  private:
+  const std::string& _internal_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_state(const std::string& value);
+  std::string* _internal_mutable_state();
+  public:
 
-  // uint32 player_id = 2;
-  void clear_player_id();
-  static const int kPlayerIdFieldNumber = 2;
-  ::google::protobuf::uint32 player_id() const;
-  void set_player_id(::google::protobuf::uint32 value);
+  // uint32 health = 2;
+  void clear_health();
+  uint32_t health() const;
+  void set_health(uint32_t value);
+  private:
+  uint32_t _internal_health() const;
+  void _internal_set_health(uint32_t value);
+  public:
 
-  // uint32 timestamp = 3;
-  void clear_timestamp();
-  static const int kTimestampFieldNumber = 3;
-  ::google::protobuf::uint32 timestamp() const;
-  void set_timestamp(::google::protobuf::uint32 value);
+  // @@protoc_insertion_point(class_scope:CompactPlayerUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr state_;
+    uint32_t health_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
+};
+// -------------------------------------------------------------------
 
-  // .HeartbeatMessage heartbeat = 4;
-  bool has_heartbeat() const;
-  void clear_heartbeat();
-  static const int kHeartbeatFieldNumber = 4;
+class UdpBindMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UdpBindMessage) */ {
+ public:
+  inline UdpBindMessage() : UdpBindMessage(nullptr) {}
+  ~UdpBindMessage() override;
+  explicit PROTOBUF_CONSTEXPR UdpBindMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UdpBindMessage(const UdpBindMessage& from);
+  UdpBindMessage(UdpBindMessage&& from) noexcept
+    : UdpBindMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline UdpBindMessage& operator=(const UdpBindMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UdpBindMessage& operator=(UdpBindMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UdpBindMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UdpBindMessage* internal_default_instance() {
+    return reinterpret_cast<const UdpBindMessage*>(
+               &_UdpBindMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(UdpBindMessage& a, UdpBindMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UdpBindMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UdpBindMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UdpBindMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UdpBindMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UdpBindMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UdpBindMessage& from) {
+    UdpBindMessage::MergeImpl(*this, from);
+  }
   private:
-  const ::HeartbeatMessage& _internal_heartbeat() const;
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  const ::HeartbeatMessage& heartbeat() const;
-  ::HeartbeatMessage* release_heartbeat();
-  ::HeartbeatMessage* mutable_heartbeat();
-  void set_allocated_heartbeat(::HeartbeatMessage* heartbeat);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // .PlayerUpdateMessage player_update = 5;
-  bool has_player_update() const;
-  void clear_player_update();
-  static const int kPlayerUpdateFieldNumber = 5;
   private:
-  const ::PlayerUpdateMessage& _internal_player_update() const;
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UdpBindMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UdpBindMessage";
+  }
+  protected:
+  explicit UdpBindMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  const ::PlayerUpdateMessage& player_update() const;
-  ::PlayerUpdateMessage* release_player_update();
-  ::PlayerUpdateMessage* mutable_player_update();
-  void set_allocated_player_update(::PlayerUpdateMessage* player_update);
 
-  // .PlayerAttributeMessage player_attribute = 6;
-  bool has_player_attribute() const;
-  void clear_player_attribute();
-  static const int kPlayerAttributeFieldNumber = 6;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTokenFieldNumber = 1,
+    kPortFieldNumber = 2,
+  };
+  // fixed64 token = 1;
+  void clear_token();
+  uint64_t token() const;
+  void set_token(uint64_t value);
   private:
-  const ::PlayerAttributeMessage& _internal_player_attribute() const;
+  uint64_t _internal_token() const;
+  void _internal_set_token(uint64_t value);
   public:
-  const ::PlayerAttributeMessage& player_attribute() const;
-  ::PlayerAttributeMessage* release_player_attribute();
-  ::PlayerAttributeMessage* mutable_player_attribute();
-  void set_allocated_player_attribute(::PlayerAttributeMessage* player_attribute);
 
-  // .PlayerStateMessage player_state = 7;
-  bool has_player_state() const;
-  void clear_player_state();
-  static const int kPlayerStateFieldNumber = 7;
+  // uint32 port = 2;
+  void clear_port();
+  uint32_t port() const;
+  void set_port(uint32_t value);
   private:
-  const ::PlayerStateMessage& _internal_player_state() const;
+  uint32_t _internal_port() const;
+  void _internal_set_port(uint32_t value);
   public:
-  const ::PlayerStateMessage& player_state() const;
-  ::PlayerStateMessage* release_player_state();
-  ::PlayerStateMessage* mutable_player_state();
-  void set_allocated_player_state(::PlayerStateMessage* player_state);
 
-  void clear_data();
-  DataCase data_case() const;
-  // @@protoc_insertion_point(class_scope:NetworkMessage)
+  // @@protoc_insertion_point(class_scope:UdpBindMessage)
  private:
-  void set_has_heartbeat();
-  void set_has_player_update();
-  void set_has_player_attribute();
-  void set_has_player_state();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t token_;
+    uint32_t port_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
+};
+// -------------------------------------------------------------------
 
-  inline bool has_data() const;
-  inline void clear_has_data();
+class EntityDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:EntityDelta) */ {
+ public:
+  inline EntityDelta() : EntityDelta(nullptr) {}
+  ~EntityDelta() override;
+  explicit PROTOBUF_CONSTEXPR EntityDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int msg_id_;
-  ::google::protobuf::uint32 player_id_;
-  ::google::protobuf::uint32 timestamp_;
-  union DataUnion {
-    DataUnion() {}
-    ::HeartbeatMessage* heartbeat_;
-    ::PlayerUpdateMessage* player_update_;
-    ::PlayerAttributeMessage* player_attribute_;
-    ::PlayerStateMessage* player_state_;
-  } data_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend struct ::protobuf_NetworkMessage_2eproto::TableStruct;
-};
-// ===================================================================
+  EntityDelta(const EntityDelta& from);
+  EntityDelta(EntityDelta&& from) noexcept
+    : EntityDelta() {
+    *this = ::std::move(from);
+  }
 
+  inline EntityDelta& operator=(const EntityDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EntityDelta& operator=(EntityDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// ===================================================================
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EntityDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EntityDelta* internal_default_instance() {
+    return reinterpret_cast<const EntityDelta*>(
+               &_EntityDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Vector3
+  friend void swap(EntityDelta& a, EntityDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EntityDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EntityDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// float x = 1;
-inline void Vector3::clear_x() {
-  x_ = 0;
-}
-inline float Vector3::x() const {
-  // @@protoc_insertion_point(field_get:Vector3.x)
-  return x_;
-}
-inline void Vector3::set_x(float value) {
-  
-  x_ = value;
-  // @@protoc_insertion_point(field_set:Vector3.x)
-}
+  // implements Message ----------------------------------------------
 
-// float y = 2;
-inline void Vector3::clear_y() {
-  y_ = 0;
-}
-inline float Vector3::y() const {
-  // @@protoc_insertion_point(field_get:Vector3.y)
-  return y_;
-}
-inline void Vector3::set_y(float value) {
-  
-  y_ = value;
-  // @@protoc_insertion_point(field_set:Vector3.y)
-}
+  EntityDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EntityDelta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EntityDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EntityDelta& from) {
+    EntityDelta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// float z = 3;
-inline void Vector3::clear_z() {
-  z_ = 0;
-}
-inline float Vector3::z() const {
-  // @@protoc_insertion_point(field_get:Vector3.z)
-  return z_;
-}
-inline void Vector3::set_z(float value) {
-  
-  z_ = value;
-  // @@protoc_insertion_point(field_set:Vector3.z)
-}
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// -------------------------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EntityDelta* other);
 
-// -------------------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "EntityDelta";
+  }
+  protected:
+  explicit EntityDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStateFieldNumber = 2,
+    kChangedFieldNumber = 1,
+  };
+  // .PlayerStateMessage state = 2;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  const ::PlayerStateMessage& state() const;
+  PROTOBUF_NODISCARD ::PlayerStateMessage* release_state();
+  ::PlayerStateMessage* mutable_state();
+  void set_allocated_state(::PlayerStateMessage* state);
+  private:
+  const ::PlayerStateMessage& _internal_state() const;
+  ::PlayerStateMessage* _internal_mutable_state();
+  public:
+  void unsafe_arena_set_allocated_state(
+      ::PlayerStateMessage* state);
+  ::PlayerStateMessage* unsafe_arena_release_state();
+
+  // uint32 changed = 1;
+  void clear_changed();
+  uint32_t changed() const;
+  void set_changed(uint32_t value);
+  private:
+  uint32_t _internal_changed() const;
+  void _internal_set_changed(uint32_t value);
+  public:
 
+  // @@protoc_insertion_point(class_scope:EntityDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PlayerStateMessage* state_;
+    uint32_t changed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
+};
 // -------------------------------------------------------------------
 
-// PlayerAttributeMessage
+class WorldSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WorldSnapshot) */ {
+ public:
+  inline WorldSnapshot() : WorldSnapshot(nullptr) {}
+  ~WorldSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR WorldSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// uint32 player_id = 1;
-inline void PlayerAttributeMessage::clear_player_id() {
-  player_id_ = 0u;
-}
-inline ::google::protobuf::uint32 PlayerAttributeMessage::player_id() const {
-  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.player_id)
-  return player_id_;
+  WorldSnapshot(const WorldSnapshot& from);
+  WorldSnapshot(WorldSnapshot&& from) noexcept
+    : WorldSnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline WorldSnapshot& operator=(const WorldSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WorldSnapshot& operator=(WorldSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorldSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WorldSnapshot* internal_default_instance() {
+    return reinterpret_cast<const WorldSnapshot*>(
+               &_WorldSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(WorldSnapshot& a, WorldSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WorldSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorldSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WorldSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WorldSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WorldSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorldSnapshot& from) {
+    WorldSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WorldSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WorldSnapshot";
+  }
+  protected:
+  explicit WorldSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntitiesFieldNumber = 3,
+    kRemovedFieldNumber = 4,
+    kSequenceFieldNumber = 1,
+    kBaselineFieldNumber = 2,
+  };
+  // repeated .EntityDelta entities = 3;
+  int entities_size() const;
+  private:
+  int _internal_entities_size() const;
+  public:
+  void clear_entities();
+  ::EntityDelta* mutable_entities(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::EntityDelta >*
+      mutable_entities();
+  private:
+  const ::EntityDelta& _internal_entities(int index) const;
+  ::EntityDelta* _internal_add_entities();
+  public:
+  const ::EntityDelta& entities(int index) const;
+  ::EntityDelta* add_entities();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::EntityDelta >&
+      entities() const;
+
+  // repeated uint32 removed = 4;
+  int removed_size() const;
+  private:
+  int _internal_removed_size() const;
+  public:
+  void clear_removed();
+  private:
+  uint32_t _internal_removed(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_removed() const;
+  void _internal_add_removed(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_removed();
+  public:
+  uint32_t removed(int index) const;
+  void set_removed(int index, uint32_t value);
+  void add_removed(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      removed() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_removed();
+
+  // uint32 sequence = 1;
+  void clear_sequence();
+  uint32_t sequence() const;
+  void set_sequence(uint32_t value);
+  private:
+  uint32_t _internal_sequence() const;
+  void _internal_set_sequence(uint32_t value);
+  public:
+
+  // uint32 baseline = 2;
+  void clear_baseline();
+  uint32_t baseline() const;
+  void set_baseline(uint32_t value);
+  private:
+  uint32_t _internal_baseline() const;
+  void _internal_set_baseline(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:WorldSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::EntityDelta > entities_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > removed_;
+    mutable std::atomic<int> _removed_cached_byte_size_;
+    uint32_t sequence_;
+    uint32_t baseline_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SnapshotAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SnapshotAck) */ {
+ public:
+  inline SnapshotAck() : SnapshotAck(nullptr) {}
+  ~SnapshotAck() override;
+  explicit PROTOBUF_CONSTEXPR SnapshotAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SnapshotAck(const SnapshotAck& from);
+  SnapshotAck(SnapshotAck&& from) noexcept
+    : SnapshotAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SnapshotAck& operator=(const SnapshotAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SnapshotAck& operator=(SnapshotAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SnapshotAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SnapshotAck* internal_default_instance() {
+    return reinterpret_cast<const SnapshotAck*>(
+               &_SnapshotAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(SnapshotAck& a, SnapshotAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SnapshotAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SnapshotAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SnapshotAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SnapshotAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SnapshotAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SnapshotAck& from) {
+    SnapshotAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SnapshotAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SnapshotAck";
+  }
+  protected:
+  explicit SnapshotAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSequenceFieldNumber = 1,
+  };
+  // uint32 sequence = 1;
+  void clear_sequence();
+  uint32_t sequence() const;
+  void set_sequence(uint32_t value);
+  private:
+  uint32_t _internal_sequence() const;
+  void _internal_set_sequence(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SnapshotAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MessageBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MessageBatch) */ {
+ public:
+  inline MessageBatch() : MessageBatch(nullptr) {}
+  ~MessageBatch() override;
+  explicit PROTOBUF_CONSTEXPR MessageBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MessageBatch(const MessageBatch& from);
+  MessageBatch(MessageBatch&& from) noexcept
+    : MessageBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline MessageBatch& operator=(const MessageBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MessageBatch& operator=(MessageBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MessageBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MessageBatch* internal_default_instance() {
+    return reinterpret_cast<const MessageBatch*>(
+               &_MessageBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(MessageBatch& a, MessageBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MessageBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MessageBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MessageBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MessageBatch& from) {
+    MessageBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MessageBatch";
+  }
+  protected:
+  explicit MessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated bytes messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  const std::string& messages(int index) const;
+  std::string* mutable_messages(int index);
+  void set_messages(int index, const std::string& value);
+  void set_messages(int index, std::string&& value);
+  void set_messages(int index, const char* value);
+  void set_messages(int index, const void* value, size_t size);
+  std::string* add_messages();
+  void add_messages(const std::string& value);
+  void add_messages(std::string&& value);
+  void add_messages(const char* value);
+  void add_messages(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& messages() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_messages();
+  private:
+  const std::string& _internal_messages(int index) const;
+  std::string* _internal_add_messages();
+  public:
+
+  // @@protoc_insertion_point(class_scope:MessageBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NetworkMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetworkMessage) */ {
+ public:
+  inline NetworkMessage() : NetworkMessage(nullptr) {}
+  ~NetworkMessage() override;
+  explicit PROTOBUF_CONSTEXPR NetworkMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NetworkMessage(const NetworkMessage& from);
+  NetworkMessage(NetworkMessage&& from) noexcept
+    : NetworkMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline NetworkMessage& operator=(const NetworkMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NetworkMessage& operator=(NetworkMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NetworkMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum DataCase {
+    kHeartbeat = 4,
+    kPlayerUpdate = 5,
+    kPlayerAttribute = 6,
+    kPlayerState = 7,
+    kUdpBind = 8,
+    kPlayerUpdateCompact = 9,
+    kWorldSnapshot = 11,
+    kSnapshotAck = 12,
+    DATA_NOT_SET = 0,
+  };
+
+  static inline const NetworkMessage* internal_default_instance() {
+    return reinterpret_cast<const NetworkMessage*>(
+               &_NetworkMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(NetworkMessage& a, NetworkMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NetworkMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NetworkMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NetworkMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NetworkMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NetworkMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NetworkMessage& from) {
+    NetworkMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NetworkMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetworkMessage";
+  }
+  protected:
+  explicit NetworkMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgIdFieldNumber = 1,
+    kPlayerIdFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+    kCapabilitiesFieldNumber = 10,
+    kHeartbeatFieldNumber = 4,
+    kPlayerUpdateFieldNumber = 5,
+    kPlayerAttributeFieldNumber = 6,
+    kPlayerStateFieldNumber = 7,
+    kUdpBindFieldNumber = 8,
+    kPlayerUpdateCompactFieldNumber = 9,
+    kWorldSnapshotFieldNumber = 11,
+    kSnapshotAckFieldNumber = 12,
+  };
+  // .MessageType msg_id = 1;
+  void clear_msg_id();
+  ::MessageType msg_id() const;
+  void set_msg_id(::MessageType value);
+  private:
+  ::MessageType _internal_msg_id() const;
+  void _internal_set_msg_id(::MessageType value);
+  public:
+
+  // uint32 player_id = 2;
+  void clear_player_id();
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
+
+  // uint32 timestamp = 3;
+  void clear_timestamp();
+  uint32_t timestamp() const;
+  void set_timestamp(uint32_t value);
+  private:
+  uint32_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint32_t value);
+  public:
+
+  // uint32 capabilities = 10;
+  void clear_capabilities();
+  uint32_t capabilities() const;
+  void set_capabilities(uint32_t value);
+  private:
+  uint32_t _internal_capabilities() const;
+  void _internal_set_capabilities(uint32_t value);
+  public:
+
+  // .HeartbeatMessage heartbeat = 4;
+  bool has_heartbeat() const;
+  private:
+  bool _internal_has_heartbeat() const;
+  public:
+  void clear_heartbeat();
+  const ::HeartbeatMessage& heartbeat() const;
+  PROTOBUF_NODISCARD ::HeartbeatMessage* release_heartbeat();
+  ::HeartbeatMessage* mutable_heartbeat();
+  void set_allocated_heartbeat(::HeartbeatMessage* heartbeat);
+  private:
+  const ::HeartbeatMessage& _internal_heartbeat() const;
+  ::HeartbeatMessage* _internal_mutable_heartbeat();
+  public:
+  void unsafe_arena_set_allocated_heartbeat(
+      ::HeartbeatMessage* heartbeat);
+  ::HeartbeatMessage* unsafe_arena_release_heartbeat();
+
+  // .PlayerUpdateMessage player_update = 5;
+  bool has_player_update() const;
+  private:
+  bool _internal_has_player_update() const;
+  public:
+  void clear_player_update();
+  const ::PlayerUpdateMessage& player_update() const;
+  PROTOBUF_NODISCARD ::PlayerUpdateMessage* release_player_update();
+  ::PlayerUpdateMessage* mutable_player_update();
+  void set_allocated_player_update(::PlayerUpdateMessage* player_update);
+  private:
+  const ::PlayerUpdateMessage& _internal_player_update() const;
+  ::PlayerUpdateMessage* _internal_mutable_player_update();
+  public:
+  void unsafe_arena_set_allocated_player_update(
+      ::PlayerUpdateMessage* player_update);
+  ::PlayerUpdateMessage* unsafe_arena_release_player_update();
+
+  // .PlayerAttributeMessage player_attribute = 6;
+  bool has_player_attribute() const;
+  private:
+  bool _internal_has_player_attribute() const;
+  public:
+  void clear_player_attribute();
+  const ::PlayerAttributeMessage& player_attribute() const;
+  PROTOBUF_NODISCARD ::PlayerAttributeMessage* release_player_attribute();
+  ::PlayerAttributeMessage* mutable_player_attribute();
+  void set_allocated_player_attribute(::PlayerAttributeMessage* player_attribute);
+  private:
+  const ::PlayerAttributeMessage& _internal_player_attribute() const;
+  ::PlayerAttributeMessage* _internal_mutable_player_attribute();
+  public:
+  void unsafe_arena_set_allocated_player_attribute(
+      ::PlayerAttributeMessage* player_attribute);
+  ::PlayerAttributeMessage* unsafe_arena_release_player_attribute();
+
+  // .PlayerStateMessage player_state = 7;
+  bool has_player_state() const;
+  private:
+  bool _internal_has_player_state() const;
+  public:
+  void clear_player_state();
+  const ::PlayerStateMessage& player_state() const;
+  PROTOBUF_NODISCARD ::PlayerStateMessage* release_player_state();
+  ::PlayerStateMessage* mutable_player_state();
+  void set_allocated_player_state(::PlayerStateMessage* player_state);
+  private:
+  const ::PlayerStateMessage& _internal_player_state() const;
+  ::PlayerStateMessage* _internal_mutable_player_state();
+  public:
+  void unsafe_arena_set_allocated_player_state(
+      ::PlayerStateMessage* player_state);
+  ::PlayerStateMessage* unsafe_arena_release_player_state();
+
+  // .UdpBindMessage udp_bind = 8;
+  bool has_udp_bind() const;
+  private:
+  bool _internal_has_udp_bind() const;
+  public:
+  void clear_udp_bind();
+  const ::UdpBindMessage& udp_bind() const;
+  PROTOBUF_NODISCARD ::UdpBindMessage* release_udp_bind();
+  ::UdpBindMessage* mutable_udp_bind();
+  void set_allocated_udp_bind(::UdpBindMessage* udp_bind);
+  private:
+  const ::UdpBindMessage& _internal_udp_bind() const;
+  ::UdpBindMessage* _internal_mutable_udp_bind();
+  public:
+  void unsafe_arena_set_allocated_udp_bind(
+      ::UdpBindMessage* udp_bind);
+  ::UdpBindMessage* unsafe_arena_release_udp_bind();
+
+  // .CompactPlayerUpdate player_update_compact = 9;
+  bool has_player_update_compact() const;
+  private:
+  bool _internal_has_player_update_compact() const;
+  public:
+  void clear_player_update_compact();
+  const ::CompactPlayerUpdate& player_update_compact() const;
+  PROTOBUF_NODISCARD ::CompactPlayerUpdate* release_player_update_compact();
+  ::CompactPlayerUpdate* mutable_player_update_compact();
+  void set_allocated_player_update_compact(::CompactPlayerUpdate* player_update_compact);
+  private:
+  const ::CompactPlayerUpdate& _internal_player_update_compact() const;
+  ::CompactPlayerUpdate* _internal_mutable_player_update_compact();
+  public:
+  void unsafe_arena_set_allocated_player_update_compact(
+      ::CompactPlayerUpdate* player_update_compact);
+  ::CompactPlayerUpdate* unsafe_arena_release_player_update_compact();
+
+  // .WorldSnapshot world_snapshot = 11;
+  bool has_world_snapshot() const;
+  private:
+  bool _internal_has_world_snapshot() const;
+  public:
+  void clear_world_snapshot();
+  const ::WorldSnapshot& world_snapshot() const;
+  PROTOBUF_NODISCARD ::WorldSnapshot* release_world_snapshot();
+  ::WorldSnapshot* mutable_world_snapshot();
+  void set_allocated_world_snapshot(::WorldSnapshot* world_snapshot);
+  private:
+  const ::WorldSnapshot& _internal_world_snapshot() const;
+  ::WorldSnapshot* _internal_mutable_world_snapshot();
+  public:
+  void unsafe_arena_set_allocated_world_snapshot(
+      ::WorldSnapshot* world_snapshot);
+  ::WorldSnapshot* unsafe_arena_release_world_snapshot();
+
+  // .SnapshotAck snapshot_ack = 12;
+  bool has_snapshot_ack() const;
+  private:
+  bool _internal_has_snapshot_ack() const;
+  public:
+  void clear_snapshot_ack();
+  const ::SnapshotAck& snapshot_ack() const;
+  PROTOBUF_NODISCARD ::SnapshotAck* release_snapshot_ack();
+  ::SnapshotAck* mutable_snapshot_ack();
+  void set_allocated_snapshot_ack(::SnapshotAck* snapshot_ack);
+  private:
+  const ::SnapshotAck& _internal_snapshot_ack() const;
+  ::SnapshotAck* _internal_mutable_snapshot_ack();
+  public:
+  void unsafe_arena_set_allocated_snapshot_ack(
+      ::SnapshotAck* snapshot_ack);
+  ::SnapshotAck* unsafe_arena_release_snapshot_ack();
+
+  void clear_data();
+  DataCase data_case() const;
+  // @@protoc_insertion_point(class_scope:NetworkMessage)
+ private:
+  class _Internal;
+  void set_has_heartbeat();
+  void set_has_player_update();
+  void set_has_player_attribute();
+  void set_has_player_state();
+  void set_has_udp_bind();
+  void set_has_player_update_compact();
+  void set_has_world_snapshot();
+  void set_has_snapshot_ack();
+
+  inline bool has_data() const;
+  inline void clear_has_data();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int msg_id_;
+    uint32_t player_id_;
+    uint32_t timestamp_;
+    uint32_t capabilities_;
+    union DataUnion {
+      constexpr DataUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::HeartbeatMessage* heartbeat_;
+      ::PlayerUpdateMessage* player_update_;
+      ::PlayerAttributeMessage* player_attribute_;
+      ::PlayerStateMessage* player_state_;
+      ::UdpBindMessage* udp_bind_;
+      ::CompactPlayerUpdate* player_update_compact_;
+      ::WorldSnapshot* world_snapshot_;
+      ::SnapshotAck* snapshot_ack_;
+    } data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetworkMessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Vector3
+
+// float x = 1;
+inline void Vector3::clear_x() {
+  _impl_.x_ = 0;
+}
+inline float Vector3::_internal_x() const {
+  return _impl_.x_;
+}
+inline float Vector3::x() const {
+  // @@protoc_insertion_point(field_get:Vector3.x)
+  return _internal_x();
+}
+inline void Vector3::_internal_set_x(float value) {
+  
+  _impl_.x_ = value;
+}
+inline void Vector3::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:Vector3.x)
+}
+
+// float y = 2;
+inline void Vector3::clear_y() {
+  _impl_.y_ = 0;
+}
+inline float Vector3::_internal_y() const {
+  return _impl_.y_;
+}
+inline float Vector3::y() const {
+  // @@protoc_insertion_point(field_get:Vector3.y)
+  return _internal_y();
+}
+inline void Vector3::_internal_set_y(float value) {
+  
+  _impl_.y_ = value;
+}
+inline void Vector3::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:Vector3.y)
+}
+
+// float z = 3;
+inline void Vector3::clear_z() {
+  _impl_.z_ = 0;
+}
+inline float Vector3::_internal_z() const {
+  return _impl_.z_;
+}
+inline float Vector3::z() const {
+  // @@protoc_insertion_point(field_get:Vector3.z)
+  return _internal_z();
+}
+inline void Vector3::_internal_set_z(float value) {
+  
+  _impl_.z_ = value;
+}
+inline void Vector3::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:Vector3.z)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// PlayerAttributeMessage
+
+// uint32 player_id = 1;
+inline void PlayerAttributeMessage::clear_player_id() {
+  _impl_.player_id_ = 0u;
+}
+inline uint32_t PlayerAttributeMessage::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint32_t PlayerAttributeMessage::player_id() const {
+  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.player_id)
+  return _internal_player_id();
+}
+inline void PlayerAttributeMessage::_internal_set_player_id(uint32_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void PlayerAttributeMessage::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.player_id)
+}
+
+// float health = 2;
+inline void PlayerAttributeMessage::clear_health() {
+  _impl_.health_ = 0;
+}
+inline float PlayerAttributeMessage::_internal_health() const {
+  return _impl_.health_;
+}
+inline float PlayerAttributeMessage::health() const {
+  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.health)
+  return _internal_health();
+}
+inline void PlayerAttributeMessage::_internal_set_health(float value) {
+  
+  _impl_.health_ = value;
+}
+inline void PlayerAttributeMessage::set_health(float value) {
+  _internal_set_health(value);
+  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.health)
+}
+
+// float max_health = 3;
+inline void PlayerAttributeMessage::clear_max_health() {
+  _impl_.max_health_ = 0;
+}
+inline float PlayerAttributeMessage::_internal_max_health() const {
+  return _impl_.max_health_;
+}
+inline float PlayerAttributeMessage::max_health() const {
+  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.max_health)
+  return _internal_max_health();
+}
+inline void PlayerAttributeMessage::_internal_set_max_health(float value) {
+  
+  _impl_.max_health_ = value;
+}
+inline void PlayerAttributeMessage::set_max_health(float value) {
+  _internal_set_max_health(value);
+  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.max_health)
+}
+
+// map<string, int32> ammo = 4;
+inline int PlayerAttributeMessage::_internal_ammo_size() const {
+  return _impl_.ammo_.size();
+}
+inline int PlayerAttributeMessage::ammo_size() const {
+  return _internal_ammo_size();
+}
+inline void PlayerAttributeMessage::clear_ammo() {
+  _impl_.ammo_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
+PlayerAttributeMessage::_internal_ammo() const {
+  return _impl_.ammo_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
+PlayerAttributeMessage::ammo() const {
+  // @@protoc_insertion_point(field_map:PlayerAttributeMessage.ammo)
+  return _internal_ammo();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
+PlayerAttributeMessage::_internal_mutable_ammo() {
+  return _impl_.ammo_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
+PlayerAttributeMessage::mutable_ammo() {
+  // @@protoc_insertion_point(field_mutable_map:PlayerAttributeMessage.ammo)
+  return _internal_mutable_ammo();
+}
+
+// map<string, int32> weapons = 5;
+inline int PlayerAttributeMessage::_internal_weapons_size() const {
+  return _impl_.weapons_.size();
+}
+inline int PlayerAttributeMessage::weapons_size() const {
+  return _internal_weapons_size();
+}
+inline void PlayerAttributeMessage::clear_weapons() {
+  _impl_.weapons_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
+PlayerAttributeMessage::_internal_weapons() const {
+  return _impl_.weapons_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >&
+PlayerAttributeMessage::weapons() const {
+  // @@protoc_insertion_point(field_map:PlayerAttributeMessage.weapons)
+  return _internal_weapons();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
+PlayerAttributeMessage::_internal_mutable_weapons() {
+  return _impl_.weapons_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int32_t >*
+PlayerAttributeMessage::mutable_weapons() {
+  // @@protoc_insertion_point(field_mutable_map:PlayerAttributeMessage.weapons)
+  return _internal_mutable_weapons();
+}
+
+// float armor = 6;
+inline void PlayerAttributeMessage::clear_armor() {
+  _impl_.armor_ = 0;
+}
+inline float PlayerAttributeMessage::_internal_armor() const {
+  return _impl_.armor_;
+}
+inline float PlayerAttributeMessage::armor() const {
+  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.armor)
+  return _internal_armor();
+}
+inline void PlayerAttributeMessage::_internal_set_armor(float value) {
+  
+  _impl_.armor_ = value;
+}
+inline void PlayerAttributeMessage::set_armor(float value) {
+  _internal_set_armor(value);
+  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.armor)
+}
+
+// int32 score = 7;
+inline void PlayerAttributeMessage::clear_score() {
+  _impl_.score_ = 0;
+}
+inline int32_t PlayerAttributeMessage::_internal_score() const {
+  return _impl_.score_;
+}
+inline int32_t PlayerAttributeMessage::score() const {
+  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.score)
+  return _internal_score();
+}
+inline void PlayerAttributeMessage::_internal_set_score(int32_t value) {
+  
+  _impl_.score_ = value;
+}
+inline void PlayerAttributeMessage::set_score(int32_t value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.score)
+}
+
+// int32 kills = 8;
+inline void PlayerAttributeMessage::clear_kills() {
+  _impl_.kills_ = 0;
+}
+inline int32_t PlayerAttributeMessage::_internal_kills() const {
+  return _impl_.kills_;
+}
+inline int32_t PlayerAttributeMessage::kills() const {
+  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.kills)
+  return _internal_kills();
+}
+inline void PlayerAttributeMessage::_internal_set_kills(int32_t value) {
+  
+  _impl_.kills_ = value;
+}
+inline void PlayerAttributeMessage::set_kills(int32_t value) {
+  _internal_set_kills(value);
+  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.kills)
+}
+
+// int32 deaths = 9;
+inline void PlayerAttributeMessage::clear_deaths() {
+  _impl_.deaths_ = 0;
+}
+inline int32_t PlayerAttributeMessage::_internal_deaths() const {
+  return _impl_.deaths_;
+}
+inline int32_t PlayerAttributeMessage::deaths() const {
+  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.deaths)
+  return _internal_deaths();
+}
+inline void PlayerAttributeMessage::_internal_set_deaths(int32_t value) {
+  
+  _impl_.deaths_ = value;
+}
+inline void PlayerAttributeMessage::set_deaths(int32_t value) {
+  _internal_set_deaths(value);
+  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.deaths)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerStateMessage
+
+// uint32 player_id = 1;
+inline void PlayerStateMessage::clear_player_id() {
+  _impl_.player_id_ = 0u;
+}
+inline uint32_t PlayerStateMessage::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint32_t PlayerStateMessage::player_id() const {
+  // @@protoc_insertion_point(field_get:PlayerStateMessage.player_id)
+  return _internal_player_id();
+}
+inline void PlayerStateMessage::_internal_set_player_id(uint32_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void PlayerStateMessage::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:PlayerStateMessage.player_id)
+}
+
+// .Vector3 position = 2;
+inline bool PlayerStateMessage::_internal_has_position() const {
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
+}
+inline bool PlayerStateMessage::has_position() const {
+  return _internal_has_position();
+}
+inline void PlayerStateMessage::clear_position() {
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
+  }
+  _impl_.position_ = nullptr;
+}
+inline const ::Vector3& PlayerStateMessage::_internal_position() const {
+  const ::Vector3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Vector3&>(
+      ::_Vector3_default_instance_);
+}
+inline const ::Vector3& PlayerStateMessage::position() const {
+  // @@protoc_insertion_point(field_get:PlayerStateMessage.position)
+  return _internal_position();
+}
+inline void PlayerStateMessage::unsafe_arena_set_allocated_position(
+    ::Vector3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:PlayerStateMessage.position)
+}
+inline ::Vector3* PlayerStateMessage::release_position() {
+  
+  ::Vector3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Vector3* PlayerStateMessage::unsafe_arena_release_position() {
+  // @@protoc_insertion_point(field_release:PlayerStateMessage.position)
+  
+  ::Vector3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+  return temp;
+}
+inline ::Vector3* PlayerStateMessage::_internal_mutable_position() {
+  
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Vector3>(GetArenaForAllocation());
+    _impl_.position_ = p;
+  }
+  return _impl_.position_;
+}
+inline ::Vector3* PlayerStateMessage::mutable_position() {
+  ::Vector3* _msg = _internal_mutable_position();
+  // @@protoc_insertion_point(field_mutable:PlayerStateMessage.position)
+  return _msg;
+}
+inline void PlayerStateMessage::set_allocated_position(::Vector3* position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.position_;
+  }
+  if (position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
+    if (message_arena != submessage_arena) {
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:PlayerStateMessage.position)
+}
+
+// .Vector3 rotation = 3;
+inline bool PlayerStateMessage::_internal_has_rotation() const {
+  return this != internal_default_instance() && _impl_.rotation_ != nullptr;
+}
+inline bool PlayerStateMessage::has_rotation() const {
+  return _internal_has_rotation();
+}
+inline void PlayerStateMessage::clear_rotation() {
+  if (GetArenaForAllocation() == nullptr && _impl_.rotation_ != nullptr) {
+    delete _impl_.rotation_;
+  }
+  _impl_.rotation_ = nullptr;
+}
+inline const ::Vector3& PlayerStateMessage::_internal_rotation() const {
+  const ::Vector3* p = _impl_.rotation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Vector3&>(
+      ::_Vector3_default_instance_);
+}
+inline const ::Vector3& PlayerStateMessage::rotation() const {
+  // @@protoc_insertion_point(field_get:PlayerStateMessage.rotation)
+  return _internal_rotation();
+}
+inline void PlayerStateMessage::unsafe_arena_set_allocated_rotation(
+    ::Vector3* rotation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rotation_);
+  }
+  _impl_.rotation_ = rotation;
+  if (rotation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:PlayerStateMessage.rotation)
+}
+inline ::Vector3* PlayerStateMessage::release_rotation() {
+  
+  ::Vector3* temp = _impl_.rotation_;
+  _impl_.rotation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Vector3* PlayerStateMessage::unsafe_arena_release_rotation() {
+  // @@protoc_insertion_point(field_release:PlayerStateMessage.rotation)
+  
+  ::Vector3* temp = _impl_.rotation_;
+  _impl_.rotation_ = nullptr;
+  return temp;
+}
+inline ::Vector3* PlayerStateMessage::_internal_mutable_rotation() {
+  
+  if (_impl_.rotation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Vector3>(GetArenaForAllocation());
+    _impl_.rotation_ = p;
+  }
+  return _impl_.rotation_;
+}
+inline ::Vector3* PlayerStateMessage::mutable_rotation() {
+  ::Vector3* _msg = _internal_mutable_rotation();
+  // @@protoc_insertion_point(field_mutable:PlayerStateMessage.rotation)
+  return _msg;
+}
+inline void PlayerStateMessage::set_allocated_rotation(::Vector3* rotation) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rotation_;
+  }
+  if (rotation) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rotation);
+    if (message_arena != submessage_arena) {
+      rotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rotation, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.rotation_ = rotation;
+  // @@protoc_insertion_point(field_set_allocated:PlayerStateMessage.rotation)
+}
+
+// .PlayerAttributeMessage attributes = 4;
+inline bool PlayerStateMessage::_internal_has_attributes() const {
+  return this != internal_default_instance() && _impl_.attributes_ != nullptr;
+}
+inline bool PlayerStateMessage::has_attributes() const {
+  return _internal_has_attributes();
+}
+inline void PlayerStateMessage::clear_attributes() {
+  if (GetArenaForAllocation() == nullptr && _impl_.attributes_ != nullptr) {
+    delete _impl_.attributes_;
+  }
+  _impl_.attributes_ = nullptr;
+}
+inline const ::PlayerAttributeMessage& PlayerStateMessage::_internal_attributes() const {
+  const ::PlayerAttributeMessage* p = _impl_.attributes_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PlayerAttributeMessage&>(
+      ::_PlayerAttributeMessage_default_instance_);
+}
+inline const ::PlayerAttributeMessage& PlayerStateMessage::attributes() const {
+  // @@protoc_insertion_point(field_get:PlayerStateMessage.attributes)
+  return _internal_attributes();
+}
+inline void PlayerStateMessage::unsafe_arena_set_allocated_attributes(
+    ::PlayerAttributeMessage* attributes) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.attributes_);
+  }
+  _impl_.attributes_ = attributes;
+  if (attributes) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:PlayerStateMessage.attributes)
+}
+inline ::PlayerAttributeMessage* PlayerStateMessage::release_attributes() {
+  
+  ::PlayerAttributeMessage* temp = _impl_.attributes_;
+  _impl_.attributes_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PlayerAttributeMessage* PlayerStateMessage::unsafe_arena_release_attributes() {
+  // @@protoc_insertion_point(field_release:PlayerStateMessage.attributes)
+  
+  ::PlayerAttributeMessage* temp = _impl_.attributes_;
+  _impl_.attributes_ = nullptr;
+  return temp;
+}
+inline ::PlayerAttributeMessage* PlayerStateMessage::_internal_mutable_attributes() {
+  
+  if (_impl_.attributes_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PlayerAttributeMessage>(GetArenaForAllocation());
+    _impl_.attributes_ = p;
+  }
+  return _impl_.attributes_;
+}
+inline ::PlayerAttributeMessage* PlayerStateMessage::mutable_attributes() {
+  ::PlayerAttributeMessage* _msg = _internal_mutable_attributes();
+  // @@protoc_insertion_point(field_mutable:PlayerStateMessage.attributes)
+  return _msg;
+}
+inline void PlayerStateMessage::set_allocated_attributes(::PlayerAttributeMessage* attributes) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.attributes_;
+  }
+  if (attributes) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(attributes);
+    if (message_arena != submessage_arena) {
+      attributes = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attributes, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.attributes_ = attributes;
+  // @@protoc_insertion_point(field_set_allocated:PlayerStateMessage.attributes)
+}
+
+// bool is_alive = 5;
+inline void PlayerStateMessage::clear_is_alive() {
+  _impl_.is_alive_ = false;
+}
+inline bool PlayerStateMessage::_internal_is_alive() const {
+  return _impl_.is_alive_;
+}
+inline bool PlayerStateMessage::is_alive() const {
+  // @@protoc_insertion_point(field_get:PlayerStateMessage.is_alive)
+  return _internal_is_alive();
+}
+inline void PlayerStateMessage::_internal_set_is_alive(bool value) {
+  
+  _impl_.is_alive_ = value;
+}
+inline void PlayerStateMessage::set_is_alive(bool value) {
+  _internal_set_is_alive(value);
+  // @@protoc_insertion_point(field_set:PlayerStateMessage.is_alive)
+}
+
+// uint32 team_id = 6;
+inline void PlayerStateMessage::clear_team_id() {
+  _impl_.team_id_ = 0u;
+}
+inline uint32_t PlayerStateMessage::_internal_team_id() const {
+  return _impl_.team_id_;
+}
+inline uint32_t PlayerStateMessage::team_id() const {
+  // @@protoc_insertion_point(field_get:PlayerStateMessage.team_id)
+  return _internal_team_id();
+}
+inline void PlayerStateMessage::_internal_set_team_id(uint32_t value) {
+  
+  _impl_.team_id_ = value;
+}
+inline void PlayerStateMessage::set_team_id(uint32_t value) {
+  _internal_set_team_id(value);
+  // @@protoc_insertion_point(field_set:PlayerStateMessage.team_id)
+}
+
+// bytes compact_transform = 7;
+inline void PlayerStateMessage::clear_compact_transform() {
+  _impl_.compact_transform_.ClearToEmpty();
+}
+inline const std::string& PlayerStateMessage::compact_transform() const {
+  // @@protoc_insertion_point(field_get:PlayerStateMessage.compact_transform)
+  return _internal_compact_transform();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PlayerStateMessage::set_compact_transform(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.compact_transform_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PlayerStateMessage.compact_transform)
+}
+inline std::string* PlayerStateMessage::mutable_compact_transform() {
+  std::string* _s = _internal_mutable_compact_transform();
+  // @@protoc_insertion_point(field_mutable:PlayerStateMessage.compact_transform)
+  return _s;
+}
+inline const std::string& PlayerStateMessage::_internal_compact_transform() const {
+  return _impl_.compact_transform_.Get();
+}
+inline void PlayerStateMessage::_internal_set_compact_transform(const std::string& value) {
+  
+  _impl_.compact_transform_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PlayerStateMessage::_internal_mutable_compact_transform() {
+  
+  return _impl_.compact_transform_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PlayerStateMessage::release_compact_transform() {
+  // @@protoc_insertion_point(field_release:PlayerStateMessage.compact_transform)
+  return _impl_.compact_transform_.Release();
+}
+inline void PlayerStateMessage::set_allocated_compact_transform(std::string* compact_transform) {
+  if (compact_transform != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.compact_transform_.SetAllocated(compact_transform, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.compact_transform_.IsDefault()) {
+    _impl_.compact_transform_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PlayerStateMessage.compact_transform)
+}
+
+// -------------------------------------------------------------------
+
+// HeartbeatMessage
+
+// -------------------------------------------------------------------
+
+// PlayerUpdateMessage
+
+// float position_x = 1;
+inline void PlayerUpdateMessage::clear_position_x() {
+  _impl_.position_x_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_position_x() const {
+  return _impl_.position_x_;
+}
+inline float PlayerUpdateMessage::position_x() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.position_x)
+  return _internal_position_x();
+}
+inline void PlayerUpdateMessage::_internal_set_position_x(float value) {
+  
+  _impl_.position_x_ = value;
+}
+inline void PlayerUpdateMessage::set_position_x(float value) {
+  _internal_set_position_x(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.position_x)
+}
+
+// float position_y = 2;
+inline void PlayerUpdateMessage::clear_position_y() {
+  _impl_.position_y_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_position_y() const {
+  return _impl_.position_y_;
+}
+inline float PlayerUpdateMessage::position_y() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.position_y)
+  return _internal_position_y();
+}
+inline void PlayerUpdateMessage::_internal_set_position_y(float value) {
+  
+  _impl_.position_y_ = value;
+}
+inline void PlayerUpdateMessage::set_position_y(float value) {
+  _internal_set_position_y(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.position_y)
+}
+
+// float position_z = 3;
+inline void PlayerUpdateMessage::clear_position_z() {
+  _impl_.position_z_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_position_z() const {
+  return _impl_.position_z_;
+}
+inline float PlayerUpdateMessage::position_z() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.position_z)
+  return _internal_position_z();
+}
+inline void PlayerUpdateMessage::_internal_set_position_z(float value) {
+  
+  _impl_.position_z_ = value;
+}
+inline void PlayerUpdateMessage::set_position_z(float value) {
+  _internal_set_position_z(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.position_z)
+}
+
+// float rotation_x = 4;
+inline void PlayerUpdateMessage::clear_rotation_x() {
+  _impl_.rotation_x_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_rotation_x() const {
+  return _impl_.rotation_x_;
+}
+inline float PlayerUpdateMessage::rotation_x() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.rotation_x)
+  return _internal_rotation_x();
+}
+inline void PlayerUpdateMessage::_internal_set_rotation_x(float value) {
+  
+  _impl_.rotation_x_ = value;
+}
+inline void PlayerUpdateMessage::set_rotation_x(float value) {
+  _internal_set_rotation_x(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.rotation_x)
+}
+
+// float rotation_y = 5;
+inline void PlayerUpdateMessage::clear_rotation_y() {
+  _impl_.rotation_y_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_rotation_y() const {
+  return _impl_.rotation_y_;
+}
+inline float PlayerUpdateMessage::rotation_y() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.rotation_y)
+  return _internal_rotation_y();
+}
+inline void PlayerUpdateMessage::_internal_set_rotation_y(float value) {
+  
+  _impl_.rotation_y_ = value;
+}
+inline void PlayerUpdateMessage::set_rotation_y(float value) {
+  _internal_set_rotation_y(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.rotation_y)
+}
+
+// float rotation_z = 6;
+inline void PlayerUpdateMessage::clear_rotation_z() {
+  _impl_.rotation_z_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_rotation_z() const {
+  return _impl_.rotation_z_;
+}
+inline float PlayerUpdateMessage::rotation_z() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.rotation_z)
+  return _internal_rotation_z();
+}
+inline void PlayerUpdateMessage::_internal_set_rotation_z(float value) {
+  
+  _impl_.rotation_z_ = value;
+}
+inline void PlayerUpdateMessage::set_rotation_z(float value) {
+  _internal_set_rotation_z(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.rotation_z)
+}
+
+// float velocity_x = 7;
+inline void PlayerUpdateMessage::clear_velocity_x() {
+  _impl_.velocity_x_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_velocity_x() const {
+  return _impl_.velocity_x_;
+}
+inline float PlayerUpdateMessage::velocity_x() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.velocity_x)
+  return _internal_velocity_x();
+}
+inline void PlayerUpdateMessage::_internal_set_velocity_x(float value) {
+  
+  _impl_.velocity_x_ = value;
+}
+inline void PlayerUpdateMessage::set_velocity_x(float value) {
+  _internal_set_velocity_x(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.velocity_x)
+}
+
+// float velocity_y = 8;
+inline void PlayerUpdateMessage::clear_velocity_y() {
+  _impl_.velocity_y_ = 0;
+}
+inline float PlayerUpdateMessage::_internal_velocity_y() const {
+  return _impl_.velocity_y_;
+}
+inline float PlayerUpdateMessage::velocity_y() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.velocity_y)
+  return _internal_velocity_y();
 }
-inline void PlayerAttributeMessage::set_player_id(::google::protobuf::uint32 value) {
+inline void PlayerUpdateMessage::_internal_set_velocity_y(float value) {
   
-  player_id_ = value;
-  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.player_id)
+  _impl_.velocity_y_ = value;
+}
+inline void PlayerUpdateMessage::set_velocity_y(float value) {
+  _internal_set_velocity_y(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.velocity_y)
 }
 
-// float health = 2;
-inline void PlayerAttributeMessage::clear_health() {
-  health_ = 0;
+// float velocity_z = 9;
+inline void PlayerUpdateMessage::clear_velocity_z() {
+  _impl_.velocity_z_ = 0;
 }
-inline float PlayerAttributeMessage::health() const {
-  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.health)
-  return health_;
+inline float PlayerUpdateMessage::_internal_velocity_z() const {
+  return _impl_.velocity_z_;
 }
-inline void PlayerAttributeMessage::set_health(float value) {
+inline float PlayerUpdateMessage::velocity_z() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.velocity_z)
+  return _internal_velocity_z();
+}
+inline void PlayerUpdateMessage::_internal_set_velocity_z(float value) {
   
-  health_ = value;
-  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.health)
+  _impl_.velocity_z_ = value;
+}
+inline void PlayerUpdateMessage::set_velocity_z(float value) {
+  _internal_set_velocity_z(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.velocity_z)
 }
 
-// float max_health = 3;
-inline void PlayerAttributeMessage::clear_max_health() {
-  max_health_ = 0;
+// bool is_grounded = 10;
+inline void PlayerUpdateMessage::clear_is_grounded() {
+  _impl_.is_grounded_ = false;
 }
-inline float PlayerAttributeMessage::max_health() const {
-  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.max_health)
-  return max_health_;
+inline bool PlayerUpdateMessage::_internal_is_grounded() const {
+  return _impl_.is_grounded_;
 }
-inline void PlayerAttributeMessage::set_max_health(float value) {
+inline bool PlayerUpdateMessage::is_grounded() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.is_grounded)
+  return _internal_is_grounded();
+}
+inline void PlayerUpdateMessage::_internal_set_is_grounded(bool value) {
   
-  max_health_ = value;
-  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.max_health)
+  _impl_.is_grounded_ = value;
+}
+inline void PlayerUpdateMessage::set_is_grounded(bool value) {
+  _internal_set_is_grounded(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.is_grounded)
 }
 
-// map<string, int32> ammo = 4;
-inline int PlayerAttributeMessage::ammo_size() const {
-  return ammo_.size();
+// float health = 11;
+inline void PlayerUpdateMessage::clear_health() {
+  _impl_.health_ = 0;
 }
-inline void PlayerAttributeMessage::clear_ammo() {
-  ammo_.Clear();
+inline float PlayerUpdateMessage::_internal_health() const {
+  return _impl_.health_;
 }
-inline const ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >&
-PlayerAttributeMessage::ammo() const {
-  // @@protoc_insertion_point(field_map:PlayerAttributeMessage.ammo)
-  return ammo_.GetMap();
+inline float PlayerUpdateMessage::health() const {
+  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.health)
+  return _internal_health();
 }
-inline ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >*
-PlayerAttributeMessage::mutable_ammo() {
-  // @@protoc_insertion_point(field_mutable_map:PlayerAttributeMessage.ammo)
-  return ammo_.MutableMap();
+inline void PlayerUpdateMessage::_internal_set_health(float value) {
+  
+  _impl_.health_ = value;
+}
+inline void PlayerUpdateMessage::set_health(float value) {
+  _internal_set_health(value);
+  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.health)
 }
 
-// map<string, int32> weapons = 5;
-inline int PlayerAttributeMessage::weapons_size() const {
-  return weapons_.size();
+// -------------------------------------------------------------------
+
+// CompactPlayerUpdate
+
+// bytes state = 1;
+inline void CompactPlayerUpdate::clear_state() {
+  _impl_.state_.ClearToEmpty();
 }
-inline void PlayerAttributeMessage::clear_weapons() {
-  weapons_.Clear();
+inline const std::string& CompactPlayerUpdate::state() const {
+  // @@protoc_insertion_point(field_get:CompactPlayerUpdate.state)
+  return _internal_state();
 }
-inline const ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >&
-PlayerAttributeMessage::weapons() const {
-  // @@protoc_insertion_point(field_map:PlayerAttributeMessage.weapons)
-  return weapons_.GetMap();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompactPlayerUpdate::set_state(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.state_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CompactPlayerUpdate.state)
 }
-inline ::google::protobuf::Map< ::std::string, ::google::protobuf::int32 >*
-PlayerAttributeMessage::mutable_weapons() {
-  // @@protoc_insertion_point(field_mutable_map:PlayerAttributeMessage.weapons)
-  return weapons_.MutableMap();
+inline std::string* CompactPlayerUpdate::mutable_state() {
+  std::string* _s = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:CompactPlayerUpdate.state)
+  return _s;
 }
-
-// float armor = 6;
-inline void PlayerAttributeMessage::clear_armor() {
-  armor_ = 0;
+inline const std::string& CompactPlayerUpdate::_internal_state() const {
+  return _impl_.state_.Get();
 }
-inline float PlayerAttributeMessage::armor() const {
-  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.armor)
-  return armor_;
+inline void CompactPlayerUpdate::_internal_set_state(const std::string& value) {
+  
+  _impl_.state_.Set(value, GetArenaForAllocation());
 }
-inline void PlayerAttributeMessage::set_armor(float value) {
+inline std::string* CompactPlayerUpdate::_internal_mutable_state() {
   
-  armor_ = value;
-  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.armor)
+  return _impl_.state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompactPlayerUpdate::release_state() {
+  // @@protoc_insertion_point(field_release:CompactPlayerUpdate.state)
+  return _impl_.state_.Release();
+}
+inline void CompactPlayerUpdate::set_allocated_state(std::string* state) {
+  if (state != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.state_.SetAllocated(state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.state_.IsDefault()) {
+    _impl_.state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CompactPlayerUpdate.state)
 }
 
-// int32 score = 7;
-inline void PlayerAttributeMessage::clear_score() {
-  score_ = 0;
+// uint32 health = 2;
+inline void CompactPlayerUpdate::clear_health() {
+  _impl_.health_ = 0u;
 }
-inline ::google::protobuf::int32 PlayerAttributeMessage::score() const {
-  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.score)
-  return score_;
+inline uint32_t CompactPlayerUpdate::_internal_health() const {
+  return _impl_.health_;
 }
-inline void PlayerAttributeMessage::set_score(::google::protobuf::int32 value) {
+inline uint32_t CompactPlayerUpdate::health() const {
+  // @@protoc_insertion_point(field_get:CompactPlayerUpdate.health)
+  return _internal_health();
+}
+inline void CompactPlayerUpdate::_internal_set_health(uint32_t value) {
   
-  score_ = value;
-  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.score)
+  _impl_.health_ = value;
+}
+inline void CompactPlayerUpdate::set_health(uint32_t value) {
+  _internal_set_health(value);
+  // @@protoc_insertion_point(field_set:CompactPlayerUpdate.health)
 }
 
-// int32 kills = 8;
-inline void PlayerAttributeMessage::clear_kills() {
-  kills_ = 0;
+// -------------------------------------------------------------------
+
+// UdpBindMessage
+
+// fixed64 token = 1;
+inline void UdpBindMessage::clear_token() {
+  _impl_.token_ = uint64_t{0u};
 }
-inline ::google::protobuf::int32 PlayerAttributeMessage::kills() const {
-  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.kills)
-  return kills_;
+inline uint64_t UdpBindMessage::_internal_token() const {
+  return _impl_.token_;
+}
+inline uint64_t UdpBindMessage::token() const {
+  // @@protoc_insertion_point(field_get:UdpBindMessage.token)
+  return _internal_token();
 }
-inline void PlayerAttributeMessage::set_kills(::google::protobuf::int32 value) {
+inline void UdpBindMessage::_internal_set_token(uint64_t value) {
   
-  kills_ = value;
-  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.kills)
+  _impl_.token_ = value;
+}
+inline void UdpBindMessage::set_token(uint64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:UdpBindMessage.token)
 }
 
-// int32 deaths = 9;
-inline void PlayerAttributeMessage::clear_deaths() {
-  deaths_ = 0;
+// uint32 port = 2;
+inline void UdpBindMessage::clear_port() {
+  _impl_.port_ = 0u;
 }
-inline ::google::protobuf::int32 PlayerAttributeMessage::deaths() const {
-  // @@protoc_insertion_point(field_get:PlayerAttributeMessage.deaths)
-  return deaths_;
+inline uint32_t UdpBindMessage::_internal_port() const {
+  return _impl_.port_;
+}
+inline uint32_t UdpBindMessage::port() const {
+  // @@protoc_insertion_point(field_get:UdpBindMessage.port)
+  return _internal_port();
 }
-inline void PlayerAttributeMessage::set_deaths(::google::protobuf::int32 value) {
+inline void UdpBindMessage::_internal_set_port(uint32_t value) {
   
-  deaths_ = value;
-  // @@protoc_insertion_point(field_set:PlayerAttributeMessage.deaths)
+  _impl_.port_ = value;
+}
+inline void UdpBindMessage::set_port(uint32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:UdpBindMessage.port)
 }
 
 // -------------------------------------------------------------------
 
-// PlayerStateMessage
+// EntityDelta
 
-// uint32 player_id = 1;
-inline void PlayerStateMessage::clear_player_id() {
-  player_id_ = 0u;
+// uint32 changed = 1;
+inline void EntityDelta::clear_changed() {
+  _impl_.changed_ = 0u;
 }
-inline ::google::protobuf::uint32 PlayerStateMessage::player_id() const {
-  // @@protoc_insertion_point(field_get:PlayerStateMessage.player_id)
-  return player_id_;
+inline uint32_t EntityDelta::_internal_changed() const {
+  return _impl_.changed_;
 }
-inline void PlayerStateMessage::set_player_id(::google::protobuf::uint32 value) {
+inline uint32_t EntityDelta::changed() const {
+  // @@protoc_insertion_point(field_get:EntityDelta.changed)
+  return _internal_changed();
+}
+inline void EntityDelta::_internal_set_changed(uint32_t value) {
   
-  player_id_ = value;
-  // @@protoc_insertion_point(field_set:PlayerStateMessage.player_id)
+  _impl_.changed_ = value;
 }
-
-// .Vector3 position = 2;
-inline bool PlayerStateMessage::has_position() const {
-  return this != internal_default_instance() && position_ != NULL;
+inline void EntityDelta::set_changed(uint32_t value) {
+  _internal_set_changed(value);
+  // @@protoc_insertion_point(field_set:EntityDelta.changed)
 }
-inline void PlayerStateMessage::clear_position() {
-  if (GetArenaNoVirtual() == NULL && position_ != NULL) {
-    delete position_;
-  }
-  position_ = NULL;
+
+// .PlayerStateMessage state = 2;
+inline bool EntityDelta::_internal_has_state() const {
+  return this != internal_default_instance() && _impl_.state_ != nullptr;
 }
-inline const ::Vector3& PlayerStateMessage::_internal_position() const {
-  return *position_;
+inline bool EntityDelta::has_state() const {
+  return _internal_has_state();
 }
-inline const ::Vector3& PlayerStateMessage::position() const {
-  const ::Vector3* p = position_;
-  // @@protoc_insertion_point(field_get:PlayerStateMessage.position)
-  return p != NULL ? *p : *reinterpret_cast<const ::Vector3*>(
-      &::_Vector3_default_instance_);
+inline void EntityDelta::clear_state() {
+  if (GetArenaForAllocation() == nullptr && _impl_.state_ != nullptr) {
+    delete _impl_.state_;
+  }
+  _impl_.state_ = nullptr;
 }
-inline ::Vector3* PlayerStateMessage::release_position() {
-  // @@protoc_insertion_point(field_release:PlayerStateMessage.position)
-  
-  ::Vector3* temp = position_;
-  position_ = NULL;
-  return temp;
+inline const ::PlayerStateMessage& EntityDelta::_internal_state() const {
+  const ::PlayerStateMessage* p = _impl_.state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PlayerStateMessage&>(
+      ::_PlayerStateMessage_default_instance_);
 }
-inline ::Vector3* PlayerStateMessage::mutable_position() {
-  
-  if (position_ == NULL) {
-    auto* p = CreateMaybeMessage<::Vector3>(GetArenaNoVirtual());
-    position_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:PlayerStateMessage.position)
-  return position_;
+inline const ::PlayerStateMessage& EntityDelta::state() const {
+  // @@protoc_insertion_point(field_get:EntityDelta.state)
+  return _internal_state();
 }
-inline void PlayerStateMessage::set_allocated_position(::Vector3* position) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete position_;
+inline void EntityDelta::unsafe_arena_set_allocated_state(
+    ::PlayerStateMessage* state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.state_);
   }
-  if (position) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      position = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, position, submessage_arena);
-    }
+  _impl_.state_ = state;
+  if (state) {
     
   } else {
     
   }
-  position_ = position;
-  // @@protoc_insertion_point(field_set_allocated:PlayerStateMessage.position)
-}
-
-// .Vector3 rotation = 3;
-inline bool PlayerStateMessage::has_rotation() const {
-  return this != internal_default_instance() && rotation_ != NULL;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:EntityDelta.state)
 }
-inline void PlayerStateMessage::clear_rotation() {
-  if (GetArenaNoVirtual() == NULL && rotation_ != NULL) {
-    delete rotation_;
+inline ::PlayerStateMessage* EntityDelta::release_state() {
+  
+  ::PlayerStateMessage* temp = _impl_.state_;
+  _impl_.state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  rotation_ = NULL;
-}
-inline const ::Vector3& PlayerStateMessage::_internal_rotation() const {
-  return *rotation_;
-}
-inline const ::Vector3& PlayerStateMessage::rotation() const {
-  const ::Vector3* p = rotation_;
-  // @@protoc_insertion_point(field_get:PlayerStateMessage.rotation)
-  return p != NULL ? *p : *reinterpret_cast<const ::Vector3*>(
-      &::_Vector3_default_instance_);
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::Vector3* PlayerStateMessage::release_rotation() {
-  // @@protoc_insertion_point(field_release:PlayerStateMessage.rotation)
+inline ::PlayerStateMessage* EntityDelta::unsafe_arena_release_state() {
+  // @@protoc_insertion_point(field_release:EntityDelta.state)
   
-  ::Vector3* temp = rotation_;
-  rotation_ = NULL;
+  ::PlayerStateMessage* temp = _impl_.state_;
+  _impl_.state_ = nullptr;
   return temp;
 }
-inline ::Vector3* PlayerStateMessage::mutable_rotation() {
+inline ::PlayerStateMessage* EntityDelta::_internal_mutable_state() {
   
-  if (rotation_ == NULL) {
-    auto* p = CreateMaybeMessage<::Vector3>(GetArenaNoVirtual());
-    rotation_ = p;
+  if (_impl_.state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PlayerStateMessage>(GetArenaForAllocation());
+    _impl_.state_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:PlayerStateMessage.rotation)
-  return rotation_;
+  return _impl_.state_;
 }
-inline void PlayerStateMessage::set_allocated_rotation(::Vector3* rotation) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete rotation_;
+inline ::PlayerStateMessage* EntityDelta::mutable_state() {
+  ::PlayerStateMessage* _msg = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:EntityDelta.state)
+  return _msg;
+}
+inline void EntityDelta::set_allocated_state(::PlayerStateMessage* state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.state_;
   }
-  if (rotation) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state);
     if (message_arena != submessage_arena) {
-      rotation = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, rotation, submessage_arena);
+      state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state, submessage_arena);
     }
     
   } else {
     
   }
-  rotation_ = rotation;
-  // @@protoc_insertion_point(field_set_allocated:PlayerStateMessage.rotation)
+  _impl_.state_ = state;
+  // @@protoc_insertion_point(field_set_allocated:EntityDelta.state)
 }
 
-// .PlayerAttributeMessage attributes = 4;
-inline bool PlayerStateMessage::has_attributes() const {
-  return this != internal_default_instance() && attributes_ != NULL;
-}
-inline void PlayerStateMessage::clear_attributes() {
-  if (GetArenaNoVirtual() == NULL && attributes_ != NULL) {
-    delete attributes_;
-  }
-  attributes_ = NULL;
-}
-inline const ::PlayerAttributeMessage& PlayerStateMessage::_internal_attributes() const {
-  return *attributes_;
+// -------------------------------------------------------------------
+
+// WorldSnapshot
+
+// uint32 sequence = 1;
+inline void WorldSnapshot::clear_sequence() {
+  _impl_.sequence_ = 0u;
 }
-inline const ::PlayerAttributeMessage& PlayerStateMessage::attributes() const {
-  const ::PlayerAttributeMessage* p = attributes_;
-  // @@protoc_insertion_point(field_get:PlayerStateMessage.attributes)
-  return p != NULL ? *p : *reinterpret_cast<const ::PlayerAttributeMessage*>(
-      &::_PlayerAttributeMessage_default_instance_);
+inline uint32_t WorldSnapshot::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-inline ::PlayerAttributeMessage* PlayerStateMessage::release_attributes() {
-  // @@protoc_insertion_point(field_release:PlayerStateMessage.attributes)
-  
-  ::PlayerAttributeMessage* temp = attributes_;
-  attributes_ = NULL;
-  return temp;
+inline uint32_t WorldSnapshot::sequence() const {
+  // @@protoc_insertion_point(field_get:WorldSnapshot.sequence)
+  return _internal_sequence();
 }
-inline ::PlayerAttributeMessage* PlayerStateMessage::mutable_attributes() {
+inline void WorldSnapshot::_internal_set_sequence(uint32_t value) {
   
-  if (attributes_ == NULL) {
-    auto* p = CreateMaybeMessage<::PlayerAttributeMessage>(GetArenaNoVirtual());
-    attributes_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:PlayerStateMessage.attributes)
-  return attributes_;
+  _impl_.sequence_ = value;
 }
-inline void PlayerStateMessage::set_allocated_attributes(::PlayerAttributeMessage* attributes) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete attributes_;
-  }
-  if (attributes) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      attributes = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, attributes, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  attributes_ = attributes;
-  // @@protoc_insertion_point(field_set_allocated:PlayerStateMessage.attributes)
+inline void WorldSnapshot::set_sequence(uint32_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:WorldSnapshot.sequence)
 }
 
-// bool is_alive = 5;
-inline void PlayerStateMessage::clear_is_alive() {
-  is_alive_ = false;
+// uint32 baseline = 2;
+inline void WorldSnapshot::clear_baseline() {
+  _impl_.baseline_ = 0u;
 }
-inline bool PlayerStateMessage::is_alive() const {
-  // @@protoc_insertion_point(field_get:PlayerStateMessage.is_alive)
-  return is_alive_;
+inline uint32_t WorldSnapshot::_internal_baseline() const {
+  return _impl_.baseline_;
 }
-inline void PlayerStateMessage::set_is_alive(bool value) {
+inline uint32_t WorldSnapshot::baseline() const {
+  // @@protoc_insertion_point(field_get:WorldSnapshot.baseline)
+  return _internal_baseline();
+}
+inline void WorldSnapshot::_internal_set_baseline(uint32_t value) {
   
-  is_alive_ = value;
-  // @@protoc_insertion_point(field_set:PlayerStateMessage.is_alive)
+  _impl_.baseline_ = value;
+}
+inline void WorldSnapshot::set_baseline(uint32_t value) {
+  _internal_set_baseline(value);
+  // @@protoc_insertion_point(field_set:WorldSnapshot.baseline)
 }
 
-// uint32 team_id = 6;
-inline void PlayerStateMessage::clear_team_id() {
-  team_id_ = 0u;
+// repeated .EntityDelta entities = 3;
+inline int WorldSnapshot::_internal_entities_size() const {
+  return _impl_.entities_.size();
 }
-inline ::google::protobuf::uint32 PlayerStateMessage::team_id() const {
-  // @@protoc_insertion_point(field_get:PlayerStateMessage.team_id)
-  return team_id_;
+inline int WorldSnapshot::entities_size() const {
+  return _internal_entities_size();
 }
-inline void PlayerStateMessage::set_team_id(::google::protobuf::uint32 value) {
-  
-  team_id_ = value;
-  // @@protoc_insertion_point(field_set:PlayerStateMessage.team_id)
+inline void WorldSnapshot::clear_entities() {
+  _impl_.entities_.Clear();
 }
-
-// -------------------------------------------------------------------
-
-// HeartbeatMessage
-
-// -------------------------------------------------------------------
-
-// PlayerUpdateMessage
-
-// float position_x = 1;
-inline void PlayerUpdateMessage::clear_position_x() {
-  position_x_ = 0;
+inline ::EntityDelta* WorldSnapshot::mutable_entities(int index) {
+  // @@protoc_insertion_point(field_mutable:WorldSnapshot.entities)
+  return _impl_.entities_.Mutable(index);
 }
-inline float PlayerUpdateMessage::position_x() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.position_x)
-  return position_x_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::EntityDelta >*
+WorldSnapshot::mutable_entities() {
+  // @@protoc_insertion_point(field_mutable_list:WorldSnapshot.entities)
+  return &_impl_.entities_;
 }
-inline void PlayerUpdateMessage::set_position_x(float value) {
-  
-  position_x_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.position_x)
+inline const ::EntityDelta& WorldSnapshot::_internal_entities(int index) const {
+  return _impl_.entities_.Get(index);
 }
-
-// float position_y = 2;
-inline void PlayerUpdateMessage::clear_position_y() {
-  position_y_ = 0;
+inline const ::EntityDelta& WorldSnapshot::entities(int index) const {
+  // @@protoc_insertion_point(field_get:WorldSnapshot.entities)
+  return _internal_entities(index);
 }
-inline float PlayerUpdateMessage::position_y() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.position_y)
-  return position_y_;
+inline ::EntityDelta* WorldSnapshot::_internal_add_entities() {
+  return _impl_.entities_.Add();
 }
-inline void PlayerUpdateMessage::set_position_y(float value) {
-  
-  position_y_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.position_y)
+inline ::EntityDelta* WorldSnapshot::add_entities() {
+  ::EntityDelta* _add = _internal_add_entities();
+  // @@protoc_insertion_point(field_add:WorldSnapshot.entities)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::EntityDelta >&
+WorldSnapshot::entities() const {
+  // @@protoc_insertion_point(field_list:WorldSnapshot.entities)
+  return _impl_.entities_;
 }
 
-// float position_z = 3;
-inline void PlayerUpdateMessage::clear_position_z() {
-  position_z_ = 0;
+// repeated uint32 removed = 4;
+inline int WorldSnapshot::_internal_removed_size() const {
+  return _impl_.removed_.size();
 }
-inline float PlayerUpdateMessage::position_z() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.position_z)
-  return position_z_;
+inline int WorldSnapshot::removed_size() const {
+  return _internal_removed_size();
 }
-inline void PlayerUpdateMessage::set_position_z(float value) {
-  
-  position_z_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.position_z)
+inline void WorldSnapshot::clear_removed() {
+  _impl_.removed_.Clear();
 }
-
-// float rotation_x = 4;
-inline void PlayerUpdateMessage::clear_rotation_x() {
-  rotation_x_ = 0;
+inline uint32_t WorldSnapshot::_internal_removed(int index) const {
+  return _impl_.removed_.Get(index);
 }
-inline float PlayerUpdateMessage::rotation_x() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.rotation_x)
-  return rotation_x_;
+inline uint32_t WorldSnapshot::removed(int index) const {
+  // @@protoc_insertion_point(field_get:WorldSnapshot.removed)
+  return _internal_removed(index);
 }
-inline void PlayerUpdateMessage::set_rotation_x(float value) {
-  
-  rotation_x_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.rotation_x)
+inline void WorldSnapshot::set_removed(int index, uint32_t value) {
+  _impl_.removed_.Set(index, value);
+  // @@protoc_insertion_point(field_set:WorldSnapshot.removed)
 }
-
-// float rotation_y = 5;
-inline void PlayerUpdateMessage::clear_rotation_y() {
-  rotation_y_ = 0;
+inline void WorldSnapshot::_internal_add_removed(uint32_t value) {
+  _impl_.removed_.Add(value);
 }
-inline float PlayerUpdateMessage::rotation_y() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.rotation_y)
-  return rotation_y_;
+inline void WorldSnapshot::add_removed(uint32_t value) {
+  _internal_add_removed(value);
+  // @@protoc_insertion_point(field_add:WorldSnapshot.removed)
 }
-inline void PlayerUpdateMessage::set_rotation_y(float value) {
-  
-  rotation_y_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.rotation_y)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+WorldSnapshot::_internal_removed() const {
+  return _impl_.removed_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+WorldSnapshot::removed() const {
+  // @@protoc_insertion_point(field_list:WorldSnapshot.removed)
+  return _internal_removed();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+WorldSnapshot::_internal_mutable_removed() {
+  return &_impl_.removed_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+WorldSnapshot::mutable_removed() {
+  // @@protoc_insertion_point(field_mutable_list:WorldSnapshot.removed)
+  return _internal_mutable_removed();
 }
 
-// float rotation_z = 6;
-inline void PlayerUpdateMessage::clear_rotation_z() {
-  rotation_z_ = 0;
+// -------------------------------------------------------------------
+
+// SnapshotAck
+
+// uint32 sequence = 1;
+inline void SnapshotAck::clear_sequence() {
+  _impl_.sequence_ = 0u;
 }
-inline float PlayerUpdateMessage::rotation_z() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.rotation_z)
-  return rotation_z_;
+inline uint32_t SnapshotAck::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-inline void PlayerUpdateMessage::set_rotation_z(float value) {
+inline uint32_t SnapshotAck::sequence() const {
+  // @@protoc_insertion_point(field_get:SnapshotAck.sequence)
+  return _internal_sequence();
+}
+inline void SnapshotAck::_internal_set_sequence(uint32_t value) {
   
-  rotation_z_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.rotation_z)
+  _impl_.sequence_ = value;
+}
+inline void SnapshotAck::set_sequence(uint32_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:SnapshotAck.sequence)
 }
 
-// float velocity_x = 7;
-inline void PlayerUpdateMessage::clear_velocity_x() {
-  velocity_x_ = 0;
+// -------------------------------------------------------------------
+
+// MessageBatch
+
+// repeated bytes messages = 1;
+inline int MessageBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int MessageBatch::messages_size() const {
+  return _internal_messages_size();
 }
-inline float PlayerUpdateMessage::velocity_x() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.velocity_x)
-  return velocity_x_;
+inline void MessageBatch::clear_messages() {
+  _impl_.messages_.Clear();
 }
-inline void PlayerUpdateMessage::set_velocity_x(float value) {
-  
-  velocity_x_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.velocity_x)
+inline std::string* MessageBatch::add_messages() {
+  std::string* _s = _internal_add_messages();
+  // @@protoc_insertion_point(field_add_mutable:MessageBatch.messages)
+  return _s;
 }
-
-// float velocity_y = 8;
-inline void PlayerUpdateMessage::clear_velocity_y() {
-  velocity_y_ = 0;
+inline const std::string& MessageBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
 }
-inline float PlayerUpdateMessage::velocity_y() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.velocity_y)
-  return velocity_y_;
+inline const std::string& MessageBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:MessageBatch.messages)
+  return _internal_messages(index);
 }
-inline void PlayerUpdateMessage::set_velocity_y(float value) {
-  
-  velocity_y_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.velocity_y)
+inline std::string* MessageBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:MessageBatch.messages)
+  return _impl_.messages_.Mutable(index);
 }
-
-// float velocity_z = 9;
-inline void PlayerUpdateMessage::clear_velocity_z() {
-  velocity_z_ = 0;
+inline void MessageBatch::set_messages(int index, const std::string& value) {
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:MessageBatch.messages)
 }
-inline float PlayerUpdateMessage::velocity_z() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.velocity_z)
-  return velocity_z_;
+inline void MessageBatch::set_messages(int index, std::string&& value) {
+  _impl_.messages_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:MessageBatch.messages)
 }
-inline void PlayerUpdateMessage::set_velocity_z(float value) {
-  
-  velocity_z_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.velocity_z)
+inline void MessageBatch::set_messages(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:MessageBatch.messages)
 }
-
-// bool is_grounded = 10;
-inline void PlayerUpdateMessage::clear_is_grounded() {
-  is_grounded_ = false;
+inline void MessageBatch::set_messages(int index, const void* value, size_t size) {
+  _impl_.messages_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:MessageBatch.messages)
 }
-inline bool PlayerUpdateMessage::is_grounded() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.is_grounded)
-  return is_grounded_;
+inline std::string* MessageBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
 }
-inline void PlayerUpdateMessage::set_is_grounded(bool value) {
-  
-  is_grounded_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.is_grounded)
+inline void MessageBatch::add_messages(const std::string& value) {
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:MessageBatch.messages)
 }
-
-// float health = 11;
-inline void PlayerUpdateMessage::clear_health() {
-  health_ = 0;
+inline void MessageBatch::add_messages(std::string&& value) {
+  _impl_.messages_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:MessageBatch.messages)
 }
-inline float PlayerUpdateMessage::health() const {
-  // @@protoc_insertion_point(field_get:PlayerUpdateMessage.health)
-  return health_;
+inline void MessageBatch::add_messages(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:MessageBatch.messages)
 }
-inline void PlayerUpdateMessage::set_health(float value) {
-  
-  health_ = value;
-  // @@protoc_insertion_point(field_set:PlayerUpdateMessage.health)
+inline void MessageBatch::add_messages(const void* value, size_t size) {
+  _impl_.messages_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:MessageBatch.messages)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MessageBatch::messages() const {
+  // @@protoc_insertion_point(field_list:MessageBatch.messages)
+  return _impl_.messages_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MessageBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:MessageBatch.messages)
+  return &_impl_.messages_;
 }
 
 // -------------------------------------------------------------------
@@ -1633,230 +4013,684 @@ inline void PlayerUpdateMessage::set_health(float value) {
 
 // .MessageType msg_id = 1;
 inline void NetworkMessage::clear_msg_id() {
-  msg_id_ = 0;
+  _impl_.msg_id_ = 0;
+}
+inline ::MessageType NetworkMessage::_internal_msg_id() const {
+  return static_cast< ::MessageType >(_impl_.msg_id_);
 }
 inline ::MessageType NetworkMessage::msg_id() const {
   // @@protoc_insertion_point(field_get:NetworkMessage.msg_id)
-  return static_cast< ::MessageType >(msg_id_);
+  return _internal_msg_id();
 }
-inline void NetworkMessage::set_msg_id(::MessageType value) {
+inline void NetworkMessage::_internal_set_msg_id(::MessageType value) {
   
-  msg_id_ = value;
+  _impl_.msg_id_ = value;
+}
+inline void NetworkMessage::set_msg_id(::MessageType value) {
+  _internal_set_msg_id(value);
   // @@protoc_insertion_point(field_set:NetworkMessage.msg_id)
 }
 
 // uint32 player_id = 2;
 inline void NetworkMessage::clear_player_id() {
-  player_id_ = 0u;
+  _impl_.player_id_ = 0u;
+}
+inline uint32_t NetworkMessage::_internal_player_id() const {
+  return _impl_.player_id_;
 }
-inline ::google::protobuf::uint32 NetworkMessage::player_id() const {
+inline uint32_t NetworkMessage::player_id() const {
   // @@protoc_insertion_point(field_get:NetworkMessage.player_id)
-  return player_id_;
+  return _internal_player_id();
 }
-inline void NetworkMessage::set_player_id(::google::protobuf::uint32 value) {
+inline void NetworkMessage::_internal_set_player_id(uint32_t value) {
   
-  player_id_ = value;
+  _impl_.player_id_ = value;
+}
+inline void NetworkMessage::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
   // @@protoc_insertion_point(field_set:NetworkMessage.player_id)
 }
 
 // uint32 timestamp = 3;
 inline void NetworkMessage::clear_timestamp() {
-  timestamp_ = 0u;
+  _impl_.timestamp_ = 0u;
+}
+inline uint32_t NetworkMessage::_internal_timestamp() const {
+  return _impl_.timestamp_;
 }
-inline ::google::protobuf::uint32 NetworkMessage::timestamp() const {
+inline uint32_t NetworkMessage::timestamp() const {
   // @@protoc_insertion_point(field_get:NetworkMessage.timestamp)
-  return timestamp_;
+  return _internal_timestamp();
 }
-inline void NetworkMessage::set_timestamp(::google::protobuf::uint32 value) {
+inline void NetworkMessage::_internal_set_timestamp(uint32_t value) {
   
-  timestamp_ = value;
+  _impl_.timestamp_ = value;
+}
+inline void NetworkMessage::set_timestamp(uint32_t value) {
+  _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:NetworkMessage.timestamp)
 }
 
 // .HeartbeatMessage heartbeat = 4;
-inline bool NetworkMessage::has_heartbeat() const {
+inline bool NetworkMessage::_internal_has_heartbeat() const {
   return data_case() == kHeartbeat;
 }
+inline bool NetworkMessage::has_heartbeat() const {
+  return _internal_has_heartbeat();
+}
 inline void NetworkMessage::set_has_heartbeat() {
-  _oneof_case_[0] = kHeartbeat;
+  _impl_._oneof_case_[0] = kHeartbeat;
 }
 inline void NetworkMessage::clear_heartbeat() {
-  if (has_heartbeat()) {
-    delete data_.heartbeat_;
+  if (_internal_has_heartbeat()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.heartbeat_;
+    }
     clear_has_data();
   }
 }
-inline const ::HeartbeatMessage& NetworkMessage::_internal_heartbeat() const {
-  return *data_.heartbeat_;
-}
 inline ::HeartbeatMessage* NetworkMessage::release_heartbeat() {
   // @@protoc_insertion_point(field_release:NetworkMessage.heartbeat)
-  if (has_heartbeat()) {
+  if (_internal_has_heartbeat()) {
     clear_has_data();
-      ::HeartbeatMessage* temp = data_.heartbeat_;
-    data_.heartbeat_ = NULL;
+    ::HeartbeatMessage* temp = _impl_.data_.heartbeat_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.heartbeat_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::HeartbeatMessage& NetworkMessage::_internal_heartbeat() const {
+  return _internal_has_heartbeat()
+      ? *_impl_.data_.heartbeat_
+      : reinterpret_cast< ::HeartbeatMessage&>(::_HeartbeatMessage_default_instance_);
+}
 inline const ::HeartbeatMessage& NetworkMessage::heartbeat() const {
   // @@protoc_insertion_point(field_get:NetworkMessage.heartbeat)
-  return has_heartbeat()
-      ? *data_.heartbeat_
-      : *reinterpret_cast< ::HeartbeatMessage*>(&::_HeartbeatMessage_default_instance_);
+  return _internal_heartbeat();
 }
-inline ::HeartbeatMessage* NetworkMessage::mutable_heartbeat() {
-  if (!has_heartbeat()) {
+inline ::HeartbeatMessage* NetworkMessage::unsafe_arena_release_heartbeat() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_data();
+    ::HeartbeatMessage* temp = _impl_.data_.heartbeat_;
+    _impl_.data_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_heartbeat(::HeartbeatMessage* heartbeat) {
+  clear_data();
+  if (heartbeat) {
+    set_has_heartbeat();
+    _impl_.data_.heartbeat_ = heartbeat;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.heartbeat)
+}
+inline ::HeartbeatMessage* NetworkMessage::_internal_mutable_heartbeat() {
+  if (!_internal_has_heartbeat()) {
     clear_data();
     set_has_heartbeat();
-    data_.heartbeat_ = CreateMaybeMessage< ::HeartbeatMessage >(
-        GetArenaNoVirtual());
+    _impl_.data_.heartbeat_ = CreateMaybeMessage< ::HeartbeatMessage >(GetArenaForAllocation());
   }
+  return _impl_.data_.heartbeat_;
+}
+inline ::HeartbeatMessage* NetworkMessage::mutable_heartbeat() {
+  ::HeartbeatMessage* _msg = _internal_mutable_heartbeat();
   // @@protoc_insertion_point(field_mutable:NetworkMessage.heartbeat)
-  return data_.heartbeat_;
+  return _msg;
 }
 
 // .PlayerUpdateMessage player_update = 5;
-inline bool NetworkMessage::has_player_update() const {
+inline bool NetworkMessage::_internal_has_player_update() const {
   return data_case() == kPlayerUpdate;
 }
+inline bool NetworkMessage::has_player_update() const {
+  return _internal_has_player_update();
+}
 inline void NetworkMessage::set_has_player_update() {
-  _oneof_case_[0] = kPlayerUpdate;
+  _impl_._oneof_case_[0] = kPlayerUpdate;
 }
 inline void NetworkMessage::clear_player_update() {
-  if (has_player_update()) {
-    delete data_.player_update_;
+  if (_internal_has_player_update()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.player_update_;
+    }
     clear_has_data();
   }
 }
-inline const ::PlayerUpdateMessage& NetworkMessage::_internal_player_update() const {
-  return *data_.player_update_;
-}
 inline ::PlayerUpdateMessage* NetworkMessage::release_player_update() {
   // @@protoc_insertion_point(field_release:NetworkMessage.player_update)
-  if (has_player_update()) {
+  if (_internal_has_player_update()) {
     clear_has_data();
-      ::PlayerUpdateMessage* temp = data_.player_update_;
-    data_.player_update_ = NULL;
+    ::PlayerUpdateMessage* temp = _impl_.data_.player_update_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.player_update_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::PlayerUpdateMessage& NetworkMessage::_internal_player_update() const {
+  return _internal_has_player_update()
+      ? *_impl_.data_.player_update_
+      : reinterpret_cast< ::PlayerUpdateMessage&>(::_PlayerUpdateMessage_default_instance_);
+}
 inline const ::PlayerUpdateMessage& NetworkMessage::player_update() const {
   // @@protoc_insertion_point(field_get:NetworkMessage.player_update)
-  return has_player_update()
-      ? *data_.player_update_
-      : *reinterpret_cast< ::PlayerUpdateMessage*>(&::_PlayerUpdateMessage_default_instance_);
+  return _internal_player_update();
 }
-inline ::PlayerUpdateMessage* NetworkMessage::mutable_player_update() {
-  if (!has_player_update()) {
+inline ::PlayerUpdateMessage* NetworkMessage::unsafe_arena_release_player_update() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.player_update)
+  if (_internal_has_player_update()) {
+    clear_has_data();
+    ::PlayerUpdateMessage* temp = _impl_.data_.player_update_;
+    _impl_.data_.player_update_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_player_update(::PlayerUpdateMessage* player_update) {
+  clear_data();
+  if (player_update) {
+    set_has_player_update();
+    _impl_.data_.player_update_ = player_update;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.player_update)
+}
+inline ::PlayerUpdateMessage* NetworkMessage::_internal_mutable_player_update() {
+  if (!_internal_has_player_update()) {
     clear_data();
     set_has_player_update();
-    data_.player_update_ = CreateMaybeMessage< ::PlayerUpdateMessage >(
-        GetArenaNoVirtual());
+    _impl_.data_.player_update_ = CreateMaybeMessage< ::PlayerUpdateMessage >(GetArenaForAllocation());
   }
+  return _impl_.data_.player_update_;
+}
+inline ::PlayerUpdateMessage* NetworkMessage::mutable_player_update() {
+  ::PlayerUpdateMessage* _msg = _internal_mutable_player_update();
   // @@protoc_insertion_point(field_mutable:NetworkMessage.player_update)
-  return data_.player_update_;
+  return _msg;
 }
 
 // .PlayerAttributeMessage player_attribute = 6;
-inline bool NetworkMessage::has_player_attribute() const {
+inline bool NetworkMessage::_internal_has_player_attribute() const {
   return data_case() == kPlayerAttribute;
 }
+inline bool NetworkMessage::has_player_attribute() const {
+  return _internal_has_player_attribute();
+}
 inline void NetworkMessage::set_has_player_attribute() {
-  _oneof_case_[0] = kPlayerAttribute;
+  _impl_._oneof_case_[0] = kPlayerAttribute;
 }
 inline void NetworkMessage::clear_player_attribute() {
-  if (has_player_attribute()) {
-    delete data_.player_attribute_;
+  if (_internal_has_player_attribute()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.player_attribute_;
+    }
     clear_has_data();
   }
 }
-inline const ::PlayerAttributeMessage& NetworkMessage::_internal_player_attribute() const {
-  return *data_.player_attribute_;
-}
 inline ::PlayerAttributeMessage* NetworkMessage::release_player_attribute() {
   // @@protoc_insertion_point(field_release:NetworkMessage.player_attribute)
-  if (has_player_attribute()) {
+  if (_internal_has_player_attribute()) {
     clear_has_data();
-      ::PlayerAttributeMessage* temp = data_.player_attribute_;
-    data_.player_attribute_ = NULL;
+    ::PlayerAttributeMessage* temp = _impl_.data_.player_attribute_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.player_attribute_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::PlayerAttributeMessage& NetworkMessage::_internal_player_attribute() const {
+  return _internal_has_player_attribute()
+      ? *_impl_.data_.player_attribute_
+      : reinterpret_cast< ::PlayerAttributeMessage&>(::_PlayerAttributeMessage_default_instance_);
+}
 inline const ::PlayerAttributeMessage& NetworkMessage::player_attribute() const {
   // @@protoc_insertion_point(field_get:NetworkMessage.player_attribute)
-  return has_player_attribute()
-      ? *data_.player_attribute_
-      : *reinterpret_cast< ::PlayerAttributeMessage*>(&::_PlayerAttributeMessage_default_instance_);
+  return _internal_player_attribute();
 }
-inline ::PlayerAttributeMessage* NetworkMessage::mutable_player_attribute() {
-  if (!has_player_attribute()) {
+inline ::PlayerAttributeMessage* NetworkMessage::unsafe_arena_release_player_attribute() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.player_attribute)
+  if (_internal_has_player_attribute()) {
+    clear_has_data();
+    ::PlayerAttributeMessage* temp = _impl_.data_.player_attribute_;
+    _impl_.data_.player_attribute_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_player_attribute(::PlayerAttributeMessage* player_attribute) {
+  clear_data();
+  if (player_attribute) {
+    set_has_player_attribute();
+    _impl_.data_.player_attribute_ = player_attribute;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.player_attribute)
+}
+inline ::PlayerAttributeMessage* NetworkMessage::_internal_mutable_player_attribute() {
+  if (!_internal_has_player_attribute()) {
     clear_data();
     set_has_player_attribute();
-    data_.player_attribute_ = CreateMaybeMessage< ::PlayerAttributeMessage >(
-        GetArenaNoVirtual());
+    _impl_.data_.player_attribute_ = CreateMaybeMessage< ::PlayerAttributeMessage >(GetArenaForAllocation());
   }
+  return _impl_.data_.player_attribute_;
+}
+inline ::PlayerAttributeMessage* NetworkMessage::mutable_player_attribute() {
+  ::PlayerAttributeMessage* _msg = _internal_mutable_player_attribute();
   // @@protoc_insertion_point(field_mutable:NetworkMessage.player_attribute)
-  return data_.player_attribute_;
+  return _msg;
 }
 
 // .PlayerStateMessage player_state = 7;
-inline bool NetworkMessage::has_player_state() const {
+inline bool NetworkMessage::_internal_has_player_state() const {
   return data_case() == kPlayerState;
 }
+inline bool NetworkMessage::has_player_state() const {
+  return _internal_has_player_state();
+}
 inline void NetworkMessage::set_has_player_state() {
-  _oneof_case_[0] = kPlayerState;
+  _impl_._oneof_case_[0] = kPlayerState;
 }
 inline void NetworkMessage::clear_player_state() {
-  if (has_player_state()) {
-    delete data_.player_state_;
+  if (_internal_has_player_state()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.player_state_;
+    }
     clear_has_data();
   }
 }
-inline const ::PlayerStateMessage& NetworkMessage::_internal_player_state() const {
-  return *data_.player_state_;
-}
 inline ::PlayerStateMessage* NetworkMessage::release_player_state() {
   // @@protoc_insertion_point(field_release:NetworkMessage.player_state)
-  if (has_player_state()) {
+  if (_internal_has_player_state()) {
     clear_has_data();
-      ::PlayerStateMessage* temp = data_.player_state_;
-    data_.player_state_ = NULL;
+    ::PlayerStateMessage* temp = _impl_.data_.player_state_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.player_state_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::PlayerStateMessage& NetworkMessage::_internal_player_state() const {
+  return _internal_has_player_state()
+      ? *_impl_.data_.player_state_
+      : reinterpret_cast< ::PlayerStateMessage&>(::_PlayerStateMessage_default_instance_);
+}
 inline const ::PlayerStateMessage& NetworkMessage::player_state() const {
   // @@protoc_insertion_point(field_get:NetworkMessage.player_state)
-  return has_player_state()
-      ? *data_.player_state_
-      : *reinterpret_cast< ::PlayerStateMessage*>(&::_PlayerStateMessage_default_instance_);
+  return _internal_player_state();
 }
-inline ::PlayerStateMessage* NetworkMessage::mutable_player_state() {
-  if (!has_player_state()) {
+inline ::PlayerStateMessage* NetworkMessage::unsafe_arena_release_player_state() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.player_state)
+  if (_internal_has_player_state()) {
+    clear_has_data();
+    ::PlayerStateMessage* temp = _impl_.data_.player_state_;
+    _impl_.data_.player_state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_player_state(::PlayerStateMessage* player_state) {
+  clear_data();
+  if (player_state) {
+    set_has_player_state();
+    _impl_.data_.player_state_ = player_state;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.player_state)
+}
+inline ::PlayerStateMessage* NetworkMessage::_internal_mutable_player_state() {
+  if (!_internal_has_player_state()) {
     clear_data();
     set_has_player_state();
-    data_.player_state_ = CreateMaybeMessage< ::PlayerStateMessage >(
-        GetArenaNoVirtual());
+    _impl_.data_.player_state_ = CreateMaybeMessage< ::PlayerStateMessage >(GetArenaForAllocation());
   }
+  return _impl_.data_.player_state_;
+}
+inline ::PlayerStateMessage* NetworkMessage::mutable_player_state() {
+  ::PlayerStateMessage* _msg = _internal_mutable_player_state();
   // @@protoc_insertion_point(field_mutable:NetworkMessage.player_state)
-  return data_.player_state_;
+  return _msg;
+}
+
+// .UdpBindMessage udp_bind = 8;
+inline bool NetworkMessage::_internal_has_udp_bind() const {
+  return data_case() == kUdpBind;
+}
+inline bool NetworkMessage::has_udp_bind() const {
+  return _internal_has_udp_bind();
+}
+inline void NetworkMessage::set_has_udp_bind() {
+  _impl_._oneof_case_[0] = kUdpBind;
+}
+inline void NetworkMessage::clear_udp_bind() {
+  if (_internal_has_udp_bind()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.udp_bind_;
+    }
+    clear_has_data();
+  }
+}
+inline ::UdpBindMessage* NetworkMessage::release_udp_bind() {
+  // @@protoc_insertion_point(field_release:NetworkMessage.udp_bind)
+  if (_internal_has_udp_bind()) {
+    clear_has_data();
+    ::UdpBindMessage* temp = _impl_.data_.udp_bind_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.udp_bind_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::UdpBindMessage& NetworkMessage::_internal_udp_bind() const {
+  return _internal_has_udp_bind()
+      ? *_impl_.data_.udp_bind_
+      : reinterpret_cast< ::UdpBindMessage&>(::_UdpBindMessage_default_instance_);
+}
+inline const ::UdpBindMessage& NetworkMessage::udp_bind() const {
+  // @@protoc_insertion_point(field_get:NetworkMessage.udp_bind)
+  return _internal_udp_bind();
+}
+inline ::UdpBindMessage* NetworkMessage::unsafe_arena_release_udp_bind() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.udp_bind)
+  if (_internal_has_udp_bind()) {
+    clear_has_data();
+    ::UdpBindMessage* temp = _impl_.data_.udp_bind_;
+    _impl_.data_.udp_bind_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_udp_bind(::UdpBindMessage* udp_bind) {
+  clear_data();
+  if (udp_bind) {
+    set_has_udp_bind();
+    _impl_.data_.udp_bind_ = udp_bind;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.udp_bind)
+}
+inline ::UdpBindMessage* NetworkMessage::_internal_mutable_udp_bind() {
+  if (!_internal_has_udp_bind()) {
+    clear_data();
+    set_has_udp_bind();
+    _impl_.data_.udp_bind_ = CreateMaybeMessage< ::UdpBindMessage >(GetArenaForAllocation());
+  }
+  return _impl_.data_.udp_bind_;
+}
+inline ::UdpBindMessage* NetworkMessage::mutable_udp_bind() {
+  ::UdpBindMessage* _msg = _internal_mutable_udp_bind();
+  // @@protoc_insertion_point(field_mutable:NetworkMessage.udp_bind)
+  return _msg;
+}
+
+// .CompactPlayerUpdate player_update_compact = 9;
+inline bool NetworkMessage::_internal_has_player_update_compact() const {
+  return data_case() == kPlayerUpdateCompact;
+}
+inline bool NetworkMessage::has_player_update_compact() const {
+  return _internal_has_player_update_compact();
+}
+inline void NetworkMessage::set_has_player_update_compact() {
+  _impl_._oneof_case_[0] = kPlayerUpdateCompact;
+}
+inline void NetworkMessage::clear_player_update_compact() {
+  if (_internal_has_player_update_compact()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.player_update_compact_;
+    }
+    clear_has_data();
+  }
+}
+inline ::CompactPlayerUpdate* NetworkMessage::release_player_update_compact() {
+  // @@protoc_insertion_point(field_release:NetworkMessage.player_update_compact)
+  if (_internal_has_player_update_compact()) {
+    clear_has_data();
+    ::CompactPlayerUpdate* temp = _impl_.data_.player_update_compact_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.player_update_compact_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::CompactPlayerUpdate& NetworkMessage::_internal_player_update_compact() const {
+  return _internal_has_player_update_compact()
+      ? *_impl_.data_.player_update_compact_
+      : reinterpret_cast< ::CompactPlayerUpdate&>(::_CompactPlayerUpdate_default_instance_);
+}
+inline const ::CompactPlayerUpdate& NetworkMessage::player_update_compact() const {
+  // @@protoc_insertion_point(field_get:NetworkMessage.player_update_compact)
+  return _internal_player_update_compact();
+}
+inline ::CompactPlayerUpdate* NetworkMessage::unsafe_arena_release_player_update_compact() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.player_update_compact)
+  if (_internal_has_player_update_compact()) {
+    clear_has_data();
+    ::CompactPlayerUpdate* temp = _impl_.data_.player_update_compact_;
+    _impl_.data_.player_update_compact_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_player_update_compact(::CompactPlayerUpdate* player_update_compact) {
+  clear_data();
+  if (player_update_compact) {
+    set_has_player_update_compact();
+    _impl_.data_.player_update_compact_ = player_update_compact;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.player_update_compact)
+}
+inline ::CompactPlayerUpdate* NetworkMessage::_internal_mutable_player_update_compact() {
+  if (!_internal_has_player_update_compact()) {
+    clear_data();
+    set_has_player_update_compact();
+    _impl_.data_.player_update_compact_ = CreateMaybeMessage< ::CompactPlayerUpdate >(GetArenaForAllocation());
+  }
+  return _impl_.data_.player_update_compact_;
+}
+inline ::CompactPlayerUpdate* NetworkMessage::mutable_player_update_compact() {
+  ::CompactPlayerUpdate* _msg = _internal_mutable_player_update_compact();
+  // @@protoc_insertion_point(field_mutable:NetworkMessage.player_update_compact)
+  return _msg;
+}
+
+// .WorldSnapshot world_snapshot = 11;
+inline bool NetworkMessage::_internal_has_world_snapshot() const {
+  return data_case() == kWorldSnapshot;
+}
+inline bool NetworkMessage::has_world_snapshot() const {
+  return _internal_has_world_snapshot();
+}
+inline void NetworkMessage::set_has_world_snapshot() {
+  _impl_._oneof_case_[0] = kWorldSnapshot;
+}
+inline void NetworkMessage::clear_world_snapshot() {
+  if (_internal_has_world_snapshot()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.world_snapshot_;
+    }
+    clear_has_data();
+  }
+}
+inline ::WorldSnapshot* NetworkMessage::release_world_snapshot() {
+  // @@protoc_insertion_point(field_release:NetworkMessage.world_snapshot)
+  if (_internal_has_world_snapshot()) {
+    clear_has_data();
+    ::WorldSnapshot* temp = _impl_.data_.world_snapshot_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.world_snapshot_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::WorldSnapshot& NetworkMessage::_internal_world_snapshot() const {
+  return _internal_has_world_snapshot()
+      ? *_impl_.data_.world_snapshot_
+      : reinterpret_cast< ::WorldSnapshot&>(::_WorldSnapshot_default_instance_);
+}
+inline const ::WorldSnapshot& NetworkMessage::world_snapshot() const {
+  // @@protoc_insertion_point(field_get:NetworkMessage.world_snapshot)
+  return _internal_world_snapshot();
+}
+inline ::WorldSnapshot* NetworkMessage::unsafe_arena_release_world_snapshot() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.world_snapshot)
+  if (_internal_has_world_snapshot()) {
+    clear_has_data();
+    ::WorldSnapshot* temp = _impl_.data_.world_snapshot_;
+    _impl_.data_.world_snapshot_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_world_snapshot(::WorldSnapshot* world_snapshot) {
+  clear_data();
+  if (world_snapshot) {
+    set_has_world_snapshot();
+    _impl_.data_.world_snapshot_ = world_snapshot;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.world_snapshot)
+}
+inline ::WorldSnapshot* NetworkMessage::_internal_mutable_world_snapshot() {
+  if (!_internal_has_world_snapshot()) {
+    clear_data();
+    set_has_world_snapshot();
+    _impl_.data_.world_snapshot_ = CreateMaybeMessage< ::WorldSnapshot >(GetArenaForAllocation());
+  }
+  return _impl_.data_.world_snapshot_;
+}
+inline ::WorldSnapshot* NetworkMessage::mutable_world_snapshot() {
+  ::WorldSnapshot* _msg = _internal_mutable_world_snapshot();
+  // @@protoc_insertion_point(field_mutable:NetworkMessage.world_snapshot)
+  return _msg;
+}
+
+// .SnapshotAck snapshot_ack = 12;
+inline bool NetworkMessage::_internal_has_snapshot_ack() const {
+  return data_case() == kSnapshotAck;
+}
+inline bool NetworkMessage::has_snapshot_ack() const {
+  return _internal_has_snapshot_ack();
+}
+inline void NetworkMessage::set_has_snapshot_ack() {
+  _impl_._oneof_case_[0] = kSnapshotAck;
+}
+inline void NetworkMessage::clear_snapshot_ack() {
+  if (_internal_has_snapshot_ack()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.snapshot_ack_;
+    }
+    clear_has_data();
+  }
+}
+inline ::SnapshotAck* NetworkMessage::release_snapshot_ack() {
+  // @@protoc_insertion_point(field_release:NetworkMessage.snapshot_ack)
+  if (_internal_has_snapshot_ack()) {
+    clear_has_data();
+    ::SnapshotAck* temp = _impl_.data_.snapshot_ack_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.snapshot_ack_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::SnapshotAck& NetworkMessage::_internal_snapshot_ack() const {
+  return _internal_has_snapshot_ack()
+      ? *_impl_.data_.snapshot_ack_
+      : reinterpret_cast< ::SnapshotAck&>(::_SnapshotAck_default_instance_);
+}
+inline const ::SnapshotAck& NetworkMessage::snapshot_ack() const {
+  // @@protoc_insertion_point(field_get:NetworkMessage.snapshot_ack)
+  return _internal_snapshot_ack();
+}
+inline ::SnapshotAck* NetworkMessage::unsafe_arena_release_snapshot_ack() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:NetworkMessage.snapshot_ack)
+  if (_internal_has_snapshot_ack()) {
+    clear_has_data();
+    ::SnapshotAck* temp = _impl_.data_.snapshot_ack_;
+    _impl_.data_.snapshot_ack_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NetworkMessage::unsafe_arena_set_allocated_snapshot_ack(::SnapshotAck* snapshot_ack) {
+  clear_data();
+  if (snapshot_ack) {
+    set_has_snapshot_ack();
+    _impl_.data_.snapshot_ack_ = snapshot_ack;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetworkMessage.snapshot_ack)
+}
+inline ::SnapshotAck* NetworkMessage::_internal_mutable_snapshot_ack() {
+  if (!_internal_has_snapshot_ack()) {
+    clear_data();
+    set_has_snapshot_ack();
+    _impl_.data_.snapshot_ack_ = CreateMaybeMessage< ::SnapshotAck >(GetArenaForAllocation());
+  }
+  return _impl_.data_.snapshot_ack_;
+}
+inline ::SnapshotAck* NetworkMessage::mutable_snapshot_ack() {
+  ::SnapshotAck* _msg = _internal_mutable_snapshot_ack();
+  // @@protoc_insertion_point(field_mutable:NetworkMessage.snapshot_ack)
+  return _msg;
+}
+
+// uint32 capabilities = 10;
+inline void NetworkMessage::clear_capabilities() {
+  _impl_.capabilities_ = 0u;
+}
+inline uint32_t NetworkMessage::_internal_capabilities() const {
+  return _impl_.capabilities_;
+}
+inline uint32_t NetworkMessage::capabilities() const {
+  // @@protoc_insertion_point(field_get:NetworkMessage.capabilities)
+  return _internal_capabilities();
+}
+inline void NetworkMessage::_internal_set_capabilities(uint32_t value) {
+  
+  _impl_.capabilities_ = value;
+}
+inline void NetworkMessage::set_capabilities(uint32_t value) {
+  _internal_set_capabilities(value);
+  // @@protoc_insertion_point(field_set:NetworkMessage.capabilities)
 }
 
 inline bool NetworkMessage::has_data() const {
   return data_case() != DATA_NOT_SET;
 }
 inline void NetworkMessage::clear_has_data() {
-  _oneof_case_[0] = DATA_NOT_SET;
+  _impl_._oneof_case_[0] = DATA_NOT_SET;
 }
 inline NetworkMessage::DataCase NetworkMessage::data_case() const {
-  return NetworkMessage::DataCase(_oneof_case_[0]);
+  return NetworkMessage::DataCase(_impl_._oneof_case_[0]);
 }
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
@@ -1875,22 +4709,38 @@ inline NetworkMessage::DataCase NetworkMessage::data_case() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::MessageType>() {
   return ::MessageType_descriptor();
 }
+template <> struct is_proto_enum< ::Capability> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Capability>() {
+  return ::Capability_descriptor();
+}
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_NetworkMessage_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_NetworkMessage_2eproto
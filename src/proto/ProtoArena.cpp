@@ -0,0 +1,23 @@
+#include "ProtoArena.h"
+#include <google/protobuf/arena.h>
+
+std::shared_ptr<NetworkMessage> ProtoArena::newNetworkMessage() {
+    struct Batch {
+        std::shared_ptr<google::protobuf::Arena> arena;
+        size_t messages = 0;
+    };
+    thread_local Batch batch;
+
+    // 当前批次用满后换新的，旧批次随其中最后一条消息一起释放
+    if (!batch.arena || batch.messages >= MESSAGES_PER_BATCH) {
+        google::protobuf::ArenaOptions options;
+        options.start_block_size = START_BLOCK_SIZE;
+        options.max_block_size = MAX_BLOCK_SIZE;
+        batch.arena = std::make_shared<google::protobuf::Arena>(options);
+        batch.messages = 0;
+    }
+    batch.messages++;
+
+    NetworkMessage* msg = google::protobuf::Arena::CreateMessage<NetworkMessage>(batch.arena.get());
+    return std::shared_ptr<NetworkMessage>(batch.arena, msg);
+}
@@ -0,0 +1,33 @@
+/**
+ * @file ProtoArena.h
+ * @brief 解码用的批次 protobuf Arena
+ *
+ * 该模块负责：
+ * - 每个线程持有一个当前批次的 Arena，连续 MESSAGES_PER_BATCH 条消息的解析结果
+ *   （含嵌套消息、map 条目、字符串）都分配在同一个 Arena 上
+ * - 返回的 shared_ptr 以别名方式持有所属批次，批次内最后一条消息释放时整块回收，
+ *   不再逐个对象 malloc/free
+ *
+ * 批次在哪个线程释放都可以（Arena 的分配和析构是线程安全的）。注意长期保存某条消息
+ * （如 Lua 脚本保存 msg.proto）会让整个批次的内存一直驻留。
+ *
+ * @author Nevermore1102
+ * @date 2025-05-05
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include "NetworkMessage.pb.h"
+
+class ProtoArena {
+public:
+    // 在当前线程的批次 Arena 上创建一个空的 NetworkMessage
+    static std::shared_ptr<NetworkMessage> newNetworkMessage();
+
+private:
+    static constexpr size_t MESSAGES_PER_BATCH = 256;
+    static constexpr size_t START_BLOCK_SIZE = 4 * 1024;
+    static constexpr size_t MAX_BLOCK_SIZE = 64 * 1024;
+};
@@ -1,11 +1,52 @@
 #include "script/LuaVM.h"
+#include <cstring>
+#include <new>
 #include <stdexcept>
 #include <spdlog/spdlog.h>
+#include <google/protobuf/descriptor.h>
+#include "proto/CompactCodec.h"
+
+namespace {
+
+// NetworkMessage 视图的 userdata 内容
+struct ProtoView {
+    std::shared_ptr<const NetworkMessage> root;   // 保证 msg 存活
+    const google::protobuf::Message* msg;
+};
+
+constexpr const char* PROTO_VIEW_METATABLE = "NetworkMessageView";
+constexpr const char* MESSAGE_TABLE_METATABLE = "NetworkMessageTable";
+
+// 读取表或消息视图中的数值字段，缺省为 0
+float getNumberField(lua_State* L, int index, const char* name) {
+    lua_getfield(L, index, name);
+    float value = static_cast<float>(lua_tonumber(L, -1));
+    lua_pop(L, 1);
+    return value;
+}
+
+void getVector3(lua_State* L, int index, Vector3* out) {
+    out->set_x(getNumberField(L, index, "x"));
+    out->set_y(getNumberField(L, index, "y"));
+    out->set_z(getNumberField(L, index, "z"));
+}
+
+void pushVector3(lua_State* L, const Vector3& v) {
+    lua_createtable(L, 0, 3);
+    lua_pushnumber(L, v.x());
+    lua_setfield(L, -2, "x");
+    lua_pushnumber(L, v.y());
+    lua_setfield(L, -2, "y");
+    lua_pushnumber(L, v.z());
+    lua_setfield(L, -2, "z");
+}
+
+} // namespace
 
 // 添加send_response函数的C++实现
 static int lua_send_response(lua_State* L) {
     // 获取参数
-    int msgType = luaL_checkinteger(L, 1);
+    luaL_checkinteger(L, 1);  // 消息类型已包含在编码后的 NetworkMessage 中
     size_t len = 0;
     const char* body = lua_tolstring(L, 2, &len);
     
@@ -20,12 +61,8 @@ static int lua_send_response(lua_State* L) {
         return 1;
     }
     
-    // 创建响应消息
-    std::vector<uint8_t> bodyData(body, body + len);
-    Message response(static_cast<MessageType>(msgType), bodyData);
-    
-    // 发送响应
-    bool success = vm->current_connection_->sendMessage(response);
+    // 发送响应：Lua 已编码好的消息体直接写入输出缓冲区
+    bool success = vm->current_connection_->sendBody(body, len);
     if (!success) {
         spdlog::error("Failed to send response message");
     }
@@ -34,7 +71,7 @@ static int lua_send_response(lua_State* L) {
     return 1;
 }
 
-LuaVM::LuaVM() : L_(nullptr) {}
+LuaVM::LuaVM() : L_(nullptr), current_message_(nullptr), current_message_table_(nullptr) {}
 
 LuaVM::~LuaVM() {
     if (L_) {
@@ -59,6 +96,13 @@ bool LuaVM::init() {
     
     // 注册PlayerData类
     registerPlayerDataClass();
+
+    // 注册消息视图
+    registerProtoViewClass();
+    registerMessageTableClass();
+
+    // 注册紧凑编码
+    registerCompactCodec();
     
     return true;
 }
@@ -74,6 +118,8 @@ bool LuaVM::loadScript(const std::string& filename) {
     }
     
     loadedScripts_[filename] = filename;
+    // 脚本可能重新定义了处理函数
+    resolveHandlers();
     return true;
 }
 
@@ -165,59 +211,92 @@ void LuaVM::registerBaseFunctions() {
     // 注册MessageType枚举
     lua_newtable(L_);
     
-    // 注册消息类型枚举
-    lua_pushinteger(L_, static_cast<int>(MessageType::HEARTBEAT));
-    lua_setfield(L_, -2, "HEARTBEAT");
-    
-    lua_pushinteger(L_, static_cast<int>(MessageType::PLAYER_UPDATE));
-    lua_setfield(L_, -2, "PLAYER_UPDATE");
-    
-    lua_pushinteger(L_, static_cast<int>(MessageType::PLAYER_ATTRIBUTE));
-    lua_setfield(L_, -2, "PLAYER_ATTRIBUTE");
-    
-    lua_pushinteger(L_, static_cast<int>(MessageType::PLAYER_STATE));
-    lua_setfield(L_, -2, "PLAYER_STATE");
-    
-    lua_pushinteger(L_, static_cast<int>(MessageType::PLAYER_JOIN));
-    lua_setfield(L_, -2, "PLAYER_JOIN");
-    
-    lua_pushinteger(L_, static_cast<int>(MessageType::PLAYER_LEAVE));
-    lua_setfield(L_, -2, "PLAYER_LEAVE");
+    // 注册消息类型枚举：取自 proto 生成的描述符，与 NetworkMessage.proto 保持一致
+    const google::protobuf::EnumDescriptor* types = MessageType_descriptor();
+    for (int i = 0; i < types->value_count(); ++i) {
+        lua_pushinteger(L_, types->value(i)->number());
+        lua_setfield(L_, -2, types->value(i)->name().c_str());
+    }
     
     // 将MessageType表设置为全局变量
     lua_setglobal(L_, "MessageType");
 }
 
 bool LuaVM::handleMessage(const Message& msg) {
-    auto it = message_handlers_.find(msg.getType());
-    if (it == message_handlers_.end()) {
+    size_t index = dispatchIndex(msg.getType());
+    if (index >= MESSAGE_TYPE_COUNT || message_handlers_[index].name.empty()) {
         return false;
     }
 
-    const std::string& handlerName = it->second;
-    
-    // 将消息压入Lua栈
+    const LuaHandler& handler = message_handlers_[index];
+    if (handler.ref == LUA_NOREF) {
+        spdlog::error("Function {} is not found or not a function", handler.name);
+        return false;
+    }
+
+    // 直接从注册表取出处理函数，再压入消息
+    lua_rawgeti(L_, LUA_REGISTRYINDEX, handler.ref);
     if (!pushMessageToLua(msg)) {
+        lua_pop(L_, 1);
         return false;
     }
     
     // 调用Lua处理函数
-    bool result = callFunction(handlerName.c_str(), "t");
+    int status = lua_pcall(L_, 1, 0, 0);
+    current_message_ = nullptr;
+    current_message_table_ = nullptr;
+    if (status != LUA_OK) {
+        handleError("Failed to call function: " + handler.name);
+        return false;
+    }
     
-    return result;
+    return true;
+}
+
+void LuaVM::resolveHandler(LuaHandler& handler) {
+    if (handler.ref != LUA_NOREF) {
+        luaL_unref(L_, LUA_REGISTRYINDEX, handler.ref);
+        handler.ref = LUA_NOREF;
+    }
+    if (handler.name.empty() || !L_) {
+        return;
+    }
+
+    lua_getglobal(L_, handler.name.c_str());
+    if (!lua_isfunction(L_, -1)) {
+        lua_pop(L_, 1);
+        spdlog::warn("Lua handler {} is not defined", handler.name);
+        return;
+    }
+    handler.ref = luaL_ref(L_, LUA_REGISTRYINDEX);
+}
+
+void LuaVM::resolveHandlers() {
+    for (auto& handler : message_handlers_) {
+        if (!handler.name.empty()) {
+            resolveHandler(handler);
+        }
+    }
 }
 
 bool LuaVM::registerMessageHandler(MessageType type, const std::string& luaFuncName) {
-    message_handlers_[type] = luaFuncName;
+    size_t index = dispatchIndex(type);
+    if (index >= MESSAGE_TYPE_COUNT) {
+        spdlog::error("Cannot register Lua handler for unknown message type {}", static_cast<int>(type));
+        return false;
+    }
+    message_handlers_[index].name = luaFuncName;
+    resolveHandler(message_handlers_[index]);
     spdlog::info("Registered Lua message handler for type {}: {}", 
                  static_cast<int>(type), luaFuncName);
     return true;
 }
 
 bool LuaVM::unregisterMessageHandler(MessageType type) {
-    auto it = message_handlers_.find(type);
-    if (it != message_handlers_.end()) {
-        message_handlers_.erase(it);
+    size_t index = dispatchIndex(type);
+    if (index < MESSAGE_TYPE_COUNT && !message_handlers_[index].name.empty()) {
+        message_handlers_[index].name.clear();
+        resolveHandler(message_handlers_[index]);
         spdlog::info("Unregistered Lua message handler for type {}", 
                      static_cast<int>(type));
         return true;
@@ -233,15 +312,307 @@ bool LuaVM::pushMessageToLua(const Message& msg) {
     lua_pushinteger(L_, static_cast<int>(msg.getType()));
     lua_settable(L_, -3);
     
-    // 压入消息体
-    lua_pushstring(L_, "body");
-    lua_pushlstring(L_, reinterpret_cast<const char*>(msg.getBody().data()), 
-                    msg.getBody().size());
-    lua_settable(L_, -3);
+    // 消息体不在这里复制，脚本访问 msg.body 时再生成
+    luaL_getmetatable(L_, MESSAGE_TABLE_METATABLE);
+    lua_setmetatable(L_, -2);
+    current_message_ = &msg;
+    current_message_table_ = lua_topointer(L_, -1);
+
+    // 压入已解析消息的视图，脚本用 msg.proto 代替 pb.decode("NetworkMessage", msg.body)
+    auto proto = msg.getSharedProto();
+    if (proto) {
+        lua_pushstring(L_, "proto");
+        pushProtoView(L_, proto, proto.get());
+        lua_settable(L_, -3);
+    }
     
     return true;
 }
 
+void LuaVM::pushProtoView(lua_State* L, const std::shared_ptr<const NetworkMessage>& root,
+                          const google::protobuf::Message* msg) {
+    void* ud = lua_newuserdata(L, sizeof(ProtoView));
+    new (ud) ProtoView{root, msg};
+    luaL_getmetatable(L, PROTO_VIEW_METATABLE);
+    lua_setmetatable(L, -2);
+}
+
+void LuaVM::pushProtoField(lua_State* L, const std::shared_ptr<const NetworkMessage>& root,
+                           const google::protobuf::Message& msg,
+                           const google::protobuf::FieldDescriptor* field, int index) {
+    using google::protobuf::FieldDescriptor;
+    const auto* reflection = msg.GetReflection();
+    bool repeated = index >= 0;
+
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            lua_pushinteger(L, repeated ? reflection->GetRepeatedInt32(msg, field, index)
+                                        : reflection->GetInt32(msg, field));
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            lua_pushinteger(L, repeated ? reflection->GetRepeatedInt64(msg, field, index)
+                                        : reflection->GetInt64(msg, field));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            lua_pushinteger(L, repeated ? reflection->GetRepeatedUInt32(msg, field, index)
+                                        : reflection->GetUInt32(msg, field));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            lua_pushinteger(L, static_cast<lua_Integer>(repeated ? reflection->GetRepeatedUInt64(msg, field, index)
+                                                                 : reflection->GetUInt64(msg, field)));
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            lua_pushnumber(L, repeated ? reflection->GetRepeatedFloat(msg, field, index)
+                                       : reflection->GetFloat(msg, field));
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            lua_pushnumber(L, repeated ? reflection->GetRepeatedDouble(msg, field, index)
+                                       : reflection->GetDouble(msg, field));
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            lua_pushboolean(L, repeated ? reflection->GetRepeatedBool(msg, field, index)
+                                        : reflection->GetBool(msg, field));
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM: {
+            // 与 lua-protobuf 的默认行为一致，枚举以名字返回
+            const auto* value = repeated ? reflection->GetRepeatedEnum(msg, field, index)
+                                         : reflection->GetEnum(msg, field);
+            lua_pushstring(L, value->name().c_str());
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_STRING: {
+            std::string scratch;
+            const std::string& value = repeated ? reflection->GetRepeatedStringReference(msg, field, index, &scratch)
+                                                : reflection->GetStringReference(msg, field, &scratch);
+            lua_pushlstring(L, value.data(), value.size());
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            pushProtoView(L, root, repeated ? &reflection->GetRepeatedMessage(msg, field, index)
+                                            : &reflection->GetMessage(msg, field));
+            break;
+        default:
+            lua_pushnil(L);
+            break;
+    }
+}
+
+int LuaVM::lua_protoview_index(lua_State* L) {
+    auto view = static_cast<ProtoView*>(luaL_checkudata(L, 1, PROTO_VIEW_METATABLE));
+    const char* name = luaL_checkstring(L, 2);
+    const google::protobuf::Message& msg = *view->msg;
+    const auto* field = msg.GetDescriptor()->FindFieldByName(name);
+    if (!field) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    const auto* reflection = msg.GetReflection();
+    if (field->is_map()) {
+        // map 字段转成普通表：key -> value
+        const auto* key_field = field->message_type()->map_key();
+        const auto* value_field = field->message_type()->map_value();
+        int size = reflection->FieldSize(msg, field);
+        lua_createtable(L, 0, size);
+        for (int i = 0; i < size; ++i) {
+            const auto& entry = reflection->GetRepeatedMessage(msg, field, i);
+            pushProtoField(L, view->root, entry, key_field, -1);
+            pushProtoField(L, view->root, entry, value_field, -1);
+            lua_settable(L, -3);
+        }
+    } else if (field->is_repeated()) {
+        int size = reflection->FieldSize(msg, field);
+        lua_createtable(L, size, 0);
+        for (int i = 0; i < size; ++i) {
+            pushProtoField(L, view->root, msg, field, i);
+            lua_rawseti(L, -2, i + 1);
+        }
+    } else if (field->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE &&
+               !reflection->HasField(msg, field)) {
+        // 未设置的子消息（如 oneof 的其他分支）返回 nil，便于脚本判断
+        lua_pushnil(L);
+    } else {
+        pushProtoField(L, view->root, msg, field, -1);
+    }
+    return 1;
+}
+
+int LuaVM::lua_protoview_gc(lua_State* L) {
+    auto view = static_cast<ProtoView*>(luaL_checkudata(L, 1, PROTO_VIEW_METATABLE));
+    view->~ProtoView();
+    return 0;
+}
+
+void LuaVM::registerProtoViewClass() {
+    luaL_newmetatable(L_, PROTO_VIEW_METATABLE);
+
+    lua_pushcfunction(L_, lua_protoview_index);
+    lua_setfield(L_, -2, "__index");
+
+    lua_pushcfunction(L_, lua_protoview_gc);
+    lua_setfield(L_, -2, "__gc");
+
+    lua_pop(L_, 1);
+}
+
+int LuaVM::lua_message_index(lua_State* L) {
+    if (lua_type(L, 2) != LUA_TSTRING || std::strcmp(lua_tostring(L, 2), "body") != 0) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_getglobal(L, "LUA_VM");
+    LuaVM* vm = static_cast<LuaVM*>(lua_touserdata(L, -1));
+    lua_pop(L, 1);
+    if (!vm || !vm->current_message_ || lua_topointer(L, 1) != vm->current_message_table_) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    const BufferSlice& body = vm->current_message_->getBody();
+    lua_pushlstring(L, reinterpret_cast<const char*>(body.data()), body.size());
+    lua_pushvalue(L, -1);
+    lua_setfield(L, 1, "body");
+    return 1;
+}
+
+void LuaVM::registerMessageTableClass() {
+    luaL_newmetatable(L_, MESSAGE_TABLE_METATABLE);
+
+    lua_pushcfunction(L_, lua_message_index);
+    lua_setfield(L_, -2, "__index");
+
+    lua_pop(L_, 1);
+}
+
+int LuaVM::lua_compact_enabled(lua_State* L) {
+    lua_getglobal(L, "LUA_VM");
+    LuaVM* vm = static_cast<LuaVM*>(lua_touserdata(L, -1));
+    lua_pop(L, 1);
+
+    lua_pushboolean(L, vm && vm->current_connection_ &&
+                       vm->current_connection_->hasCapability(Capability::CAPABILITY_COMPACT_TRANSFORM));
+    return 1;
+}
+
+int LuaVM::lua_compact_encode_player_update(lua_State* L) {
+    PlayerUpdateMessage update;
+    update.set_position_x(getNumberField(L, 1, "position_x"));
+    update.set_position_y(getNumberField(L, 1, "position_y"));
+    update.set_position_z(getNumberField(L, 1, "position_z"));
+    update.set_rotation_x(getNumberField(L, 1, "rotation_x"));
+    update.set_rotation_y(getNumberField(L, 1, "rotation_y"));
+    update.set_velocity_x(getNumberField(L, 1, "velocity_x"));
+    update.set_velocity_y(getNumberField(L, 1, "velocity_y"));
+    update.set_velocity_z(getNumberField(L, 1, "velocity_z"));
+    update.set_health(getNumberField(L, 1, "health"));
+    lua_getfield(L, 1, "is_grounded");
+    update.set_is_grounded(lua_toboolean(L, -1));
+    lua_pop(L, 1);
+
+    CompactPlayerUpdate compact;
+    CompactCodec::encodePlayerUpdate(update, &compact);
+
+    lua_createtable(L, 0, 2);
+    lua_pushlstring(L, compact.state().data(), compact.state().size());
+    lua_setfield(L, -2, "state");
+    lua_pushinteger(L, compact.health());
+    lua_setfield(L, -2, "health");
+    return 1;
+}
+
+int LuaVM::lua_compact_decode_player_update(lua_State* L) {
+    CompactPlayerUpdate compact;
+    lua_getfield(L, 1, "state");
+    size_t len = 0;
+    const char* state = lua_tolstring(L, -1, &len);
+    if (state) {
+        compact.set_state(state, len);
+    }
+    lua_pop(L, 1);
+    compact.set_health(static_cast<uint32_t>(getNumberField(L, 1, "health")));
+
+    PlayerUpdateMessage update;
+    if (!CompactCodec::decodePlayerUpdate(compact, &update)) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    // 字段名与 PlayerUpdateMessage 一致，处理器无需区分两种格式
+    lua_createtable(L, 0, 11);
+    lua_pushnumber(L, update.position_x());
+    lua_setfield(L, -2, "position_x");
+    lua_pushnumber(L, update.position_y());
+    lua_setfield(L, -2, "position_y");
+    lua_pushnumber(L, update.position_z());
+    lua_setfield(L, -2, "position_z");
+    lua_pushnumber(L, update.rotation_x());
+    lua_setfield(L, -2, "rotation_x");
+    lua_pushnumber(L, update.rotation_y());
+    lua_setfield(L, -2, "rotation_y");
+    lua_pushnumber(L, update.rotation_z());
+    lua_setfield(L, -2, "rotation_z");
+    lua_pushnumber(L, update.velocity_x());
+    lua_setfield(L, -2, "velocity_x");
+    lua_pushnumber(L, update.velocity_y());
+    lua_setfield(L, -2, "velocity_y");
+    lua_pushnumber(L, update.velocity_z());
+    lua_setfield(L, -2, "velocity_z");
+    lua_pushboolean(L, update.is_grounded());
+    lua_setfield(L, -2, "is_grounded");
+    lua_pushnumber(L, update.health());
+    lua_setfield(L, -2, "health");
+    return 1;
+}
+
+int LuaVM::lua_compact_encode_transform(lua_State* L) {
+    Vector3 position;
+    Vector3 rotation;
+    getVector3(L, 1, &position);
+    getVector3(L, 2, &rotation);
+
+    std::string packed;
+    CompactCodec::encodeTransform(position, rotation, &packed);
+    lua_pushlstring(L, packed.data(), packed.size());
+    return 1;
+}
+
+int LuaVM::lua_compact_decode_transform(lua_State* L) {
+    size_t len = 0;
+    const char* data = luaL_checklstring(L, 1, &len);
+
+    Vector3 position;
+    Vector3 rotation;
+    if (!CompactCodec::decodeTransform(std::string(data, len), &position, &rotation)) {
+        lua_pushnil(L);
+        return 1;
+    }
+    pushVector3(L, position);
+    pushVector3(L, rotation);
+    return 2;
+}
+
+void LuaVM::registerCompactCodec() {
+    lua_newtable(L_);
+
+    lua_pushcfunction(L_, lua_compact_enabled);
+    lua_setfield(L_, -2, "enabled");
+
+    lua_pushcfunction(L_, lua_compact_encode_player_update);
+    lua_setfield(L_, -2, "encode_player_update");
+
+    lua_pushcfunction(L_, lua_compact_decode_player_update);
+    lua_setfield(L_, -2, "decode_player_update");
+
+    lua_pushcfunction(L_, lua_compact_encode_transform);
+    lua_setfield(L_, -2, "encode_transform");
+
+    lua_pushcfunction(L_, lua_compact_decode_transform);
+    lua_setfield(L_, -2, "decode_transform");
+
+    lua_setglobal(L_, "compact");
+}
+
 bool LuaVM::getMessageFromLua(Message& msg) {
     if (!lua_istable(L_, -1)) {
         return false;
@@ -266,10 +637,10 @@ bool LuaVM::getMessageFromLua(Message& msg) {
     }
     size_t len;
     const char* body = lua_tolstring(L_, -1, &len);
-    std::vector<uint8_t> bodyData(body, body + len);
+    BufferSlice bodyData = BufferSlice::copyOf(body, len);
     lua_pop(L_, 1);
     
-    msg = Message(type, bodyData);
+    msg = Message(type, std::move(bodyData));
     return true;
 }
 
@@ -19,6 +19,7 @@
 #include <memory>
 #include <unordered_map>
 #include "proto/Message.h"
+#include "proto/MessageDispatch.h"
 #include "net/Connection.h"
 #include "data/PlayerData.h"
 
@@ -57,8 +58,17 @@ public:
 private:
     lua_State* L_;
     std::unordered_map<std::string, std::string> loadedScripts_;
-    std::unordered_map<MessageType, std::string> message_handlers_;
+    // 消息处理函数：注册时按名字解析一次，保存在注册表中；每次加载脚本后重新解析
+    struct LuaHandler {
+        std::string name;       // 空串表示未注册
+        int ref = LUA_NOREF;    // 注册表中的函数引用，函数不存在时为 LUA_NOREF
+    };
+    // 按消息类型索引
+    DispatchTable<LuaHandler> message_handlers_;
     std::shared_ptr<Connection> current_connection_;
+    // 正在处理的消息及其 Lua 表（只用于比较身份）
+    const Message* current_message_;
+    const void* current_message_table_;
     
     // 错误处理
     void handleError(const std::string& msg);
@@ -66,10 +76,43 @@ private:
     // 注册基础函数
     void registerBaseFunctions();
 
+    // 按名字重新解析处理函数的注册表引用
+    void resolveHandler(LuaHandler& handler);
+    void resolveHandlers();
+
     // 消息处理辅助方法
     bool pushMessageToLua(const Message& msg);
     bool getMessageFromLua(Message& msg);
 
+    // NetworkMessage 只读视图：按字段名通过反射读取已解析的消息，不再在 Lua 中重复 pb.decode。
+    // 视图持有解析结果的引用，脚本保存视图也不会悬空
+    static void pushProtoView(lua_State* L, const std::shared_ptr<const NetworkMessage>& root,
+                              const google::protobuf::Message* msg);
+    static void pushProtoField(lua_State* L, const std::shared_ptr<const NetworkMessage>& root,
+                               const google::protobuf::Message& msg,
+                               const google::protobuf::FieldDescriptor* field, int index);
+    static int lua_protoview_index(lua_State* L);
+    static int lua_protoview_gc(lua_State* L);
+    void registerProtoViewClass();
+
+    // 消息表的 body 字段在首次访问时才从消息缓冲区生成字符串（并缓存在表中），
+    // 只在处理函数执行期间可用
+    static int lua_message_index(lua_State* L);
+    void registerMessageTableClass();
+
+    // 紧凑编码（全局表 compact）：
+    //   compact.enabled()                    当前连接是否协商了 CAPABILITY_COMPACT_TRANSFORM
+    //   compact.encode_player_update(update) PlayerUpdateMessage 字段 -> CompactPlayerUpdate 表
+    //   compact.decode_player_update(c)      CompactPlayerUpdate（表或视图）-> PlayerUpdateMessage 字段，非法时为 nil
+    //   compact.encode_transform(pos, rot)   -> PlayerStateMessage.compact_transform
+    //   compact.decode_transform(s)          -> pos, rot
+    static int lua_compact_enabled(lua_State* L);
+    static int lua_compact_encode_player_update(lua_State* L);
+    static int lua_compact_decode_player_update(lua_State* L);
+    static int lua_compact_encode_transform(lua_State* L);
+    static int lua_compact_decode_transform(lua_State* L);
+    void registerCompactCodec();
+
     // PlayerData Lua绑定函数
     static int lua_playerdata_new(lua_State* L);
     static int lua_playerdata_update_position(lua_State* L);
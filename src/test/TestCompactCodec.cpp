@@ -0,0 +1,289 @@
+#include "TestCompactCodec.h"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include "../proto/CompactCodec.h"
+
+namespace test {
+
+namespace {
+
+// 文档中的精度为量化步长，四舍五入后的误差不超过半个步长（留出浮点余量）
+constexpr float HORIZONTAL_ERROR = 0.004f / 2;
+constexpr float VERTICAL_ERROR = 0.016f / 2;
+constexpr float VELOCITY_ERROR = 0.51f / 2;
+constexpr float YAW_ERROR = 360.0f / 1024 / 2 + 1e-3f;
+constexpr float PITCH_ERROR = 180.0f / 254 / 2 + 1e-3f;
+
+constexpr float NAN_VALUE = std::numeric_limits<float>::quiet_NaN();
+constexpr float INF_VALUE = std::numeric_limits<float>::infinity();
+
+PlayerUpdateMessage makeUpdate(float px, float py, float pz, float pitch, float yaw,
+                               float vx, float vy, float vz) {
+    PlayerUpdateMessage update;
+    update.set_position_x(px);
+    update.set_position_y(py);
+    update.set_position_z(pz);
+    update.set_rotation_x(pitch);
+    update.set_rotation_y(yaw);
+    update.set_velocity_x(vx);
+    update.set_velocity_y(vy);
+    update.set_velocity_z(vz);
+    return update;
+}
+
+bool roundTrip(const PlayerUpdateMessage& in, PlayerUpdateMessage& out) {
+    CompactPlayerUpdate compact;
+    CompactCodec::encodePlayerUpdate(in, &compact);
+    return compact.state().size() == CompactCodec::PLAYER_UPDATE_BYTES &&
+           CompactCodec::decodePlayerUpdate(compact, &out);
+}
+
+// 偏航角按圆周距离比较
+float yawDistance(float a, float b) {
+    float d = std::fabs(std::remainder(a - b, 360.0f));
+    return std::isfinite(d) ? d : INF_VALUE;
+}
+
+bool near(const char* what, float actual, float expected, float bound) {
+    if (std::fabs(actual - expected) <= bound) {
+        return true;
+    }
+    spdlog::error("{}: 解码得到 {}，期望 {}（误差上限 {}）", what, actual, expected, bound);
+    return false;
+}
+
+} // namespace
+
+bool TestCompactCodec::runAllTests() {
+    spdlog::info("开始测试量化编解码...");
+
+    if (!testRoundTripErrorBounds()) {
+        return false;
+    }
+
+    if (!testClampAndNonFinite()) {
+        return false;
+    }
+
+    if (!testAngles()) {
+        return false;
+    }
+
+    if (!testRejectWrongLength()) {
+        return false;
+    }
+
+    spdlog::info("量化编解码测试完成");
+    return true;
+}
+
+bool TestCompactCodec::testRoundTripErrorBounds() {
+    // 固定种子，覆盖整个世界范围内的取值
+    std::mt19937 rng(20250505);
+    std::uniform_real_distribution<float> xz(CompactCodec::WORLD_MIN_X, CompactCodec::WORLD_MAX_X);
+    std::uniform_real_distribution<float> y(CompactCodec::WORLD_MIN_Y, CompactCodec::WORLD_MAX_Y);
+    std::uniform_real_distribution<float> pitch(-90.0f, 90.0f);
+    std::uniform_real_distribution<float> yaw(0.0f, 360.0f);
+    std::uniform_real_distribution<float> speed(-CompactCodec::MAX_SPEED, CompactCodec::MAX_SPEED);
+
+    for (int i = 0; i < 10000; ++i) {
+        PlayerUpdateMessage in = makeUpdate(xz(rng), y(rng), xz(rng), pitch(rng), yaw(rng),
+                                            speed(rng), speed(rng), speed(rng));
+        in.set_is_grounded(i % 2 == 0);
+        in.set_health(static_cast<float>(i % 101) + 0.4f);
+        PlayerUpdateMessage out;
+        if (!roundTrip(in, out)) {
+            spdlog::error("PlayerUpdate 往返解码失败");
+            return false;
+        }
+        if (!near("position_x", out.position_x(), in.position_x(), HORIZONTAL_ERROR) ||
+            !near("position_y", out.position_y(), in.position_y(), VERTICAL_ERROR) ||
+            !near("position_z", out.position_z(), in.position_z(), HORIZONTAL_ERROR) ||
+            !near("rotation_x", out.rotation_x(), in.rotation_x(), PITCH_ERROR) ||
+            !near("rotation_y", yawDistance(out.rotation_y(), in.rotation_y()), 0.0f, YAW_ERROR) ||
+            !near("velocity_x", out.velocity_x(), in.velocity_x(), VELOCITY_ERROR) ||
+            !near("velocity_y", out.velocity_y(), in.velocity_y(), VELOCITY_ERROR) ||
+            !near("velocity_z", out.velocity_z(), in.velocity_z(), VELOCITY_ERROR) ||
+            !near("health", out.health(), static_cast<float>(i % 101), 0.0f)) {
+            return false;
+        }
+        if (out.is_grounded() != in.is_grounded() || out.rotation_z() != 0.0f) {
+            spdlog::error("着地标志或翻滚角往返后不符");
+            return false;
+        }
+
+        // 坐标+朝向的编码与 PlayerUpdate 共用同一布局
+        Vector3 position;
+        Vector3 rotation;
+        position.set_x(in.position_x());
+        position.set_y(in.position_y());
+        position.set_z(in.position_z());
+        rotation.set_x(in.rotation_x());
+        rotation.set_y(in.rotation_y());
+        std::string transform;
+        CompactCodec::encodeTransform(position, rotation, &transform);
+        Vector3 decoded_position;
+        Vector3 decoded_rotation;
+        if (transform.size() != CompactCodec::TRANSFORM_BYTES ||
+            !CompactCodec::decodeTransform(transform, &decoded_position, &decoded_rotation) ||
+            decoded_position.x() != out.position_x() || decoded_position.y() != out.position_y() ||
+            decoded_position.z() != out.position_z() || decoded_rotation.x() != out.rotation_x() ||
+            decoded_rotation.y() != out.rotation_y()) {
+            spdlog::error("坐标+朝向往返结果与 PlayerUpdate 不一致");
+            return false;
+        }
+    }
+
+    // 世界原点和零速度可以精确表示
+    PlayerUpdateMessage out;
+    if (!roundTrip(makeUpdate(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f), out) ||
+        !near("原点 x", out.position_x(), 0.0f, 0.0f) || !near("原点 z", out.position_z(), 0.0f, 0.0f) ||
+        !near("零速度", out.velocity_x(), 0.0f, 0.0f) || !near("零俯仰", out.rotation_x(), 0.0f, 0.0f)) {
+        return false;
+    }
+
+    // 速度在 ±MAX_SPEED 处精确还原
+    if (!roundTrip(makeUpdate(0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                              CompactCodec::MAX_SPEED, -CompactCodec::MAX_SPEED, CompactCodec::MAX_SPEED), out) ||
+        !near("+MAX_SPEED", out.velocity_x(), CompactCodec::MAX_SPEED, 0.0f) ||
+        !near("-MAX_SPEED", out.velocity_y(), -CompactCodec::MAX_SPEED, 0.0f)) {
+        return false;
+    }
+
+    spdlog::info("量化往返误差在文档精度内");
+    return true;
+}
+
+bool TestCompactCodec::testClampAndNonFinite() {
+    PlayerUpdateMessage out;
+
+    // 超出世界边界和最大速度的值截断到边界
+    if (!roundTrip(makeUpdate(1e6f, 1e6f, -1e6f, 0.0f, 0.0f, 100.0f, -100.0f, 1e30f), out) ||
+        !near("x 上界", out.position_x(), CompactCodec::WORLD_MAX_X, 0.0f) ||
+        !near("y 上界", out.position_y(), CompactCodec::WORLD_MAX_Y, 0.0f) ||
+        !near("z 下界", out.position_z(), CompactCodec::WORLD_MIN_Z, 0.0f) ||
+        !near("速度上界", out.velocity_x(), CompactCodec::MAX_SPEED, 0.0f) ||
+        !near("速度下界", out.velocity_y(), -CompactCodec::MAX_SPEED, 0.0f) ||
+        !near("极大速度", out.velocity_z(), CompactCodec::MAX_SPEED, 0.0f)) {
+        return false;
+    }
+    if (!roundTrip(makeUpdate(-1e6f, -1e6f, 1e6f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f), out) ||
+        !near("x 下界", out.position_x(), CompactCodec::WORLD_MIN_X, 0.0f) ||
+        !near("y 下界", out.position_y(), CompactCodec::WORLD_MIN_Y, 0.0f) ||
+        !near("z 上界", out.position_z(), CompactCodec::WORLD_MAX_Z, 0.0f)) {
+        return false;
+    }
+
+    // NaN 按下界处理，无穷大截断到对应边界，偏航角的非有限值按 0 处理；解码结果总是有限值
+    if (!roundTrip(makeUpdate(NAN_VALUE, INF_VALUE, -INF_VALUE, NAN_VALUE, NAN_VALUE,
+                              NAN_VALUE, INF_VALUE, -INF_VALUE), out) ||
+        !near("NaN x", out.position_x(), CompactCodec::WORLD_MIN_X, 0.0f) ||
+        !near("+inf y", out.position_y(), CompactCodec::WORLD_MAX_Y, 0.0f) ||
+        !near("-inf z", out.position_z(), CompactCodec::WORLD_MIN_Z, 0.0f) ||
+        !near("NaN 俯仰", out.rotation_x(), -90.0f, 0.0f) ||
+        !near("NaN 偏航", out.rotation_y(), 0.0f, 0.0f) ||
+        !near("NaN 速度", out.velocity_x(), -CompactCodec::MAX_SPEED, 0.0f) ||
+        !near("+inf 速度", out.velocity_y(), CompactCodec::MAX_SPEED, 0.0f) ||
+        !near("-inf 速度", out.velocity_z(), -CompactCodec::MAX_SPEED, 0.0f)) {
+        return false;
+    }
+    if (!roundTrip(makeUpdate(0.0f, 0.0f, 0.0f, INF_VALUE, -INF_VALUE, 0.0f, 0.0f, 0.0f), out) ||
+        !std::isfinite(out.rotation_x()) || !near("inf 偏航", out.rotation_y(), 0.0f, 0.0f)) {
+        spdlog::error("无穷大角度解码为非有限值");
+        return false;
+    }
+
+    // 负的和非有限的生命值按 0 处理
+    PlayerUpdateMessage in = makeUpdate(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    for (float health : {-5.0f, NAN_VALUE, -INF_VALUE}) {
+        in.set_health(health);
+        if (!roundTrip(in, out) || !near("生命值", out.health(), 0.0f, 0.0f)) {
+            return false;
+        }
+    }
+
+    spdlog::info("越界与非有限值按约定截断");
+    return true;
+}
+
+bool TestCompactCodec::testAngles() {
+    struct AngleCase {
+        float input;
+        float expected;
+    };
+    PlayerUpdateMessage out;
+
+    // 偏航角为周期量：0 和 360 编码相同，负角度和多圈折算到 [0, 360)
+    const AngleCase yaw_cases[] = {
+        {0.0f, 0.0f}, {360.0f, 0.0f}, {359.9f, 0.0f}, {-0.1f, 0.0f}, {720.0f, 0.0f},
+        {-90.0f, 270.0f}, {765.0f, 45.0f}, {180.0f, 180.0f}, {-3600.0f + 12.5f, 12.5f},
+    };
+    for (const auto& item : yaw_cases) {
+        if (!roundTrip(makeUpdate(0.0f, 0.0f, 0.0f, 0.0f, item.input, 0.0f, 0.0f, 0.0f), out)) {
+            return false;
+        }
+        if (out.rotation_y() < 0.0f || out.rotation_y() >= 360.0f ||
+            yawDistance(out.rotation_y(), item.expected) > YAW_ERROR) {
+            spdlog::error("偏航角 {} 解码得到 {}，期望 {}", item.input, out.rotation_y(), item.expected);
+            return false;
+        }
+    }
+    // 0 与 360 编码出的字节完全相同
+    CompactPlayerUpdate at_zero;
+    CompactPlayerUpdate at_full_turn;
+    CompactCodec::encodePlayerUpdate(makeUpdate(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f), &at_zero);
+    CompactCodec::encodePlayerUpdate(makeUpdate(0.0f, 0.0f, 0.0f, 0.0f, 360.0f, 0.0f, 0.0f, 0.0f), &at_full_turn);
+    if (at_zero.state() != at_full_turn.state()) {
+        spdlog::error("偏航角 0 与 360 的编码不同");
+        return false;
+    }
+
+    // 俯仰角可能以 [0, 360) 给出：先折算到 [-180, 180)，再截断到 [-90, 90]
+    const AngleCase pitch_cases[] = {
+        {10.0f, 10.0f}, {350.0f, -10.0f}, {300.0f, -60.0f}, {90.0f, 90.0f}, {270.0f, -90.0f},
+        {-90.0f, -90.0f}, {120.0f, 90.0f}, {200.0f, -90.0f}, {-30.0f, -30.0f}, {359.5f, -0.5f},
+    };
+    for (const auto& item : pitch_cases) {
+        if (!roundTrip(makeUpdate(0.0f, 0.0f, 0.0f, item.input, 0.0f, 0.0f, 0.0f, 0.0f), out) ||
+            !near("俯仰角", out.rotation_x(), item.expected, PITCH_ERROR)) {
+            spdlog::error("俯仰角输入 {}", item.input);
+            return false;
+        }
+    }
+
+    spdlog::info("偏航角回绕与俯仰角折算正确");
+    return true;
+}
+
+bool TestCompactCodec::testRejectWrongLength() {
+    CompactPlayerUpdate compact;
+    CompactCodec::encodePlayerUpdate(makeUpdate(1.0f, 2.0f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f), &compact);
+    std::string valid = compact.state();
+
+    PlayerUpdateMessage out;
+    for (size_t len : {size_t{0}, CompactCodec::PLAYER_UPDATE_BYTES - 1, CompactCodec::PLAYER_UPDATE_BYTES + 1}) {
+        std::string state = valid;
+        state.resize(len, '\0');
+        compact.set_state(state);
+        if (CompactCodec::decodePlayerUpdate(compact, &out)) {
+            spdlog::error("长度为 {} 的 state 未被拒绝", len);
+            return false;
+        }
+    }
+
+    Vector3 position;
+    Vector3 rotation;
+    for (size_t len : {size_t{0}, CompactCodec::TRANSFORM_BYTES - 1, CompactCodec::TRANSFORM_BYTES + 1}) {
+        if (CompactCodec::decodeTransform(std::string(len, '\0'), &position, &rotation)) {
+            spdlog::error("长度为 {} 的 compact_transform 未被拒绝", len);
+            return false;
+        }
+    }
+
+    spdlog::info("长度错误的编码被拒绝");
+    return true;
+}
+
+} // namespace test
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+namespace test {
+
+// 量化编解码的往返测试：误差不超过文档给出的精度，越界、非有限值和角度周期按约定处理
+class TestCompactCodec {
+public:
+    static bool runAllTests();
+
+private:
+    static bool testRoundTripErrorBounds();
+    static bool testClampAndNonFinite();
+    static bool testAngles();
+    static bool testRejectWrongLength();
+};
+
+} // namespace test
@@ -0,0 +1,320 @@
+#include "TestFrameCompressor.h"
+#include <arpa/inet.h>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <event2/bufferevent.h>
+#include <event2/event.h>
+#include <google/protobuf/io/coded_stream.h>
+#include "../net/Connection.h"
+#include "../net/FrameCompressor.h"
+
+namespace test {
+
+namespace {
+
+// 解压长度上限，与连接对入站帧的限制相同
+constexpr size_t MAX_LEN = 1024 * 1024;
+
+// 可压缩的消息体：字段名和数值反复出现，近似真实的消息内容
+std::string makeBody(size_t len) {
+    std::string body;
+    for (size_t i = 0; body.size() < len; ++i) {
+        body += "player " + std::to_string(i % 64) + " position " + std::to_string(i % 7) + ";";
+    }
+    body.resize(len);
+    return body;
+}
+
+std::string randomBytes(size_t len, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::string bytes(len, '\0');
+    for (auto& c : bytes) {
+        c = static_cast<char>(rng() & 0xff);
+    }
+    return bytes;
+}
+
+std::string varint(uint64_t value) {
+    uint8_t buffer[10];
+    uint8_t* end = google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(value, buffer);
+    return std::string(reinterpret_cast<char*>(buffer), end - buffer);
+}
+
+// 把压缩数据的原始长度前缀替换为 declared，deflate 数据不变
+std::string withDeclaredLength(const std::string& compressed, uint64_t declared) {
+    google::protobuf::io::CodedInputStream input(
+        reinterpret_cast<const uint8_t*>(compressed.data()), static_cast<int>(compressed.size()));
+    uint64_t raw_len = 0;
+    input.ReadVarint64(&raw_len);
+    return varint(declared) + compressed.substr(static_cast<size_t>(input.CurrentPosition()));
+}
+
+bool decompress(FrameCompressor& compressor, const std::string& data, size_t max_len, BufferSlice& out) {
+    return compressor.decompress(reinterpret_cast<const uint8_t*>(data.data()), data.size(), max_len, out);
+}
+
+// 解压结果与原文一致
+bool roundTrips(FrameCompressor& compressor, const std::string& body) {
+    std::string compressed;
+    if (!compressor.compress(reinterpret_cast<const uint8_t*>(body.data()), body.size(), compressed)) {
+        spdlog::error("{} 字节的可压缩消息体压缩失败", body.size());
+        return false;
+    }
+    BufferSlice out;
+    if (!decompress(compressor, compressed, body.size(), out) || out.size() != body.size() ||
+        std::memcmp(out.data(), body.data(), body.size()) != 0) {
+        spdlog::error("{} 字节的消息体解压后与原文不一致", body.size());
+        return false;
+    }
+    return true;
+}
+
+std::string compressOrEmpty(const std::string& body) {
+    std::string compressed;
+    FrameCompressor compressor;
+    compressor.compress(reinterpret_cast<const uint8_t*>(body.data()), body.size(), compressed);
+    return compressed;
+}
+
+std::string makeFrame(uint32_t flags, const std::string& body) {
+    uint32_t net_len = htonl(flags | static_cast<uint32_t>(body.size()));
+    return std::string(reinterpret_cast<const char*>(&net_len), sizeof(net_len)) + body;
+}
+
+std::string makeUpdate(uint32_t player_id) {
+    NetworkMessage pb_msg;
+    pb_msg.set_msg_id(MessageType::PLAYER_UPDATE);
+    pb_msg.set_player_id(player_id);
+    pb_msg.mutable_player_update()->set_position_x(static_cast<float>(player_id));
+    pb_msg.mutable_player_update()->set_health(100.0f);
+    return pb_msg.SerializeAsString();
+}
+
+// 带武器列表的属性消息，单条就足够压缩
+std::string makeAttributes(uint32_t player_id) {
+    NetworkMessage pb_msg;
+    pb_msg.set_msg_id(MessageType::PLAYER_ATTRIBUTE);
+    pb_msg.set_player_id(player_id);
+    auto* weapons = pb_msg.mutable_player_attribute()->mutable_weapons();
+    for (int i = 0; i < 20; ++i) {
+        (*weapons)["weapon_" + std::to_string(i)] = i;
+    }
+    return pb_msg.SerializeAsString();
+}
+
+// 测试用连接：一对 bufferevent 中的一端，另一端随对象释放
+struct TestConnection {
+    std::shared_ptr<Connection> conn;
+    struct bufferevent* peer = nullptr;
+
+    explicit TestConnection(struct event_base* base) {
+        struct bufferevent* pair[2];
+        bufferevent_pair_new(base, 0, pair);
+        conn = std::make_shared<Connection>(pair[0]);
+        conn->setId(1);
+        peer = pair[1];
+    }
+    ~TestConnection() {
+        conn.reset();
+        bufferevent_free(peer);
+    }
+
+    // 从对端写入数据并处理到没有待处理事件为止
+    void deliver(struct event_base* base, const std::string& bytes) {
+        bufferevent_write(peer, bytes.data(), bytes.size());
+        event_base_loop(base, EVLOOP_NONBLOCK);
+    }
+};
+
+bool checkCompressedFrames(struct event_base* base) {
+    TestConnection client(base);
+    std::vector<uint32_t> received;
+    bool parsed = true;
+    client.conn->setMessageCallback([&](const std::shared_ptr<Connection>&, const Message& msg) {
+        // 消息体引用解压结果，回调中仍可完整解析
+        const NetworkMessage* proto = msg.getProto();
+        parsed = parsed && proto && proto->player_id() == msg.getPlayerId();
+        received.push_back(msg.getPlayerId());
+    });
+
+    // 压缩的批次帧，分两次到达
+    MessageBatch batch;
+    std::vector<uint32_t> expected;
+    for (uint32_t player_id = 1; player_id <= 20; ++player_id) {
+        batch.add_messages(makeUpdate(player_id));
+        expected.push_back(player_id);
+    }
+    std::string compressed = compressOrEmpty(batch.SerializeAsString());
+    if (compressed.empty()) {
+        spdlog::error("批次帧消息体压缩失败");
+        return false;
+    }
+    std::string frame = makeFrame(FRAME_FLAG_BATCH | FRAME_FLAG_COMPRESSED, compressed);
+    client.deliver(base, frame.substr(0, frame.size() / 2));
+    if (!received.empty()) {
+        spdlog::error("不完整的压缩帧被提前处理");
+        return false;
+    }
+    client.deliver(base, frame.substr(frame.size() / 2));
+
+    // 压缩的单条消息帧
+    client.deliver(base, makeFrame(FRAME_FLAG_COMPRESSED, compressOrEmpty(makeAttributes(100))));
+    expected.push_back(100);
+
+    // 损坏的压缩帧只丢弃这一帧，之后的普通帧照常处理
+    client.deliver(base, makeFrame(FRAME_FLAG_BATCH | FRAME_FLAG_COMPRESSED, varint(64) + randomBytes(32, 1)));
+    client.deliver(base, makeFrame(0, makeUpdate(200)));
+    expected.push_back(200);
+
+    if (received != expected || !parsed) {
+        spdlog::error("压缩帧经连接收到 {} 条消息，期望 {} 条", received.size(), expected.size());
+        return false;
+    }
+    if (!client.conn->isConnected()) {
+        spdlog::error("损坏的压缩帧导致连接被关闭");
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool TestFrameCompressor::runAllTests() {
+    spdlog::info("开始测试帧压缩...");
+
+    if (!testRoundTrip()) {
+        return false;
+    }
+    if (!testDeclaredLengthTooLarge()) {
+        return false;
+    }
+    if (!testDeclaredLengthMismatch()) {
+        return false;
+    }
+    if (!testCorruptData()) {
+        return false;
+    }
+    if (!testCompressedBatchFrame()) {
+        return false;
+    }
+
+    spdlog::info("帧压缩测试完成");
+    return true;
+}
+
+bool TestFrameCompressor::testRoundTrip() {
+    // 同一实例连续处理多帧，每帧独立压缩和解压
+    FrameCompressor compressor;
+    for (size_t len : {64, 1000, 100000, 1000}) {
+        if (!roundTrips(compressor, makeBody(len))) {
+            return false;
+        }
+    }
+
+    // 不可压缩的数据放弃压缩
+    std::string noise = randomBytes(1000, 2);
+    std::string compressed;
+    if (compressor.compress(reinterpret_cast<const uint8_t*>(noise.data()), noise.size(), compressed)) {
+        spdlog::error("随机数据压缩后不应比原文短");
+        return false;
+    }
+
+    spdlog::info("压缩后解压与原文一致");
+    return true;
+}
+
+bool TestFrameCompressor::testDeclaredLengthTooLarge() {
+    FrameCompressor compressor;
+    std::string body = makeBody(1000);
+    std::string compressed = compressOrEmpty(body);
+    BufferSlice out;
+
+    // 声明长度超过上限时不分配缓冲区，直接拒绝
+    if (decompress(compressor, compressed, body.size() - 1, out) ||
+        decompress(compressor, withDeclaredLength(compressed, UINT64_MAX), MAX_LEN, out) ||
+        decompress(compressor, withDeclaredLength(compressed, MAX_LEN + 1),
+                   MAX_LEN, out)) {
+        spdlog::error("声明长度超过上限的压缩数据未被拒绝");
+        return false;
+    }
+    if (!decompress(compressor, compressed, body.size(), out) || out.size() != body.size()) {
+        spdlog::error("声明长度等于上限的压缩数据解压失败");
+        return false;
+    }
+
+    spdlog::info("声明长度超过上限的压缩数据被拒绝");
+    return true;
+}
+
+bool TestFrameCompressor::testDeclaredLengthMismatch() {
+    FrameCompressor compressor;
+    std::string body = makeBody(1000);
+    std::string compressed = compressOrEmpty(body);
+    BufferSlice out;
+
+    // 声明长度与实际解压长度不符，无论偏大还是偏小
+    for (uint64_t declared : {uint64_t{0}, uint64_t{1}, uint64_t{999}, uint64_t{1001}, uint64_t{4000}}) {
+        if (decompress(compressor, withDeclaredLength(compressed, declared), MAX_LEN, out)) {
+            spdlog::error("声明长度 {} 与实际长度 {} 不符的压缩数据未被拒绝", declared, body.size());
+            return false;
+        }
+    }
+
+    // 失败后同一实例仍能正常解压
+    if (!roundTrips(compressor, body)) {
+        return false;
+    }
+
+    spdlog::info("声明长度与实际长度不符的压缩数据被拒绝");
+    return true;
+}
+
+bool TestFrameCompressor::testCorruptData() {
+    FrameCompressor compressor;
+    std::string body = makeBody(1000);
+    std::string compressed = compressOrEmpty(body);
+    BufferSlice out;
+
+    struct CorruptCase {
+        const char* name;
+        std::string data;
+    };
+    const CorruptCase cases[] = {
+        {"空数据", ""},
+        {"截断的长度前缀", "\x80"},
+        {"只有长度前缀", varint(body.size())},
+        {"保留的块类型", varint(body.size()) + std::string(16, '\xff')},
+        {"随机数据", varint(body.size()) + randomBytes(64, 3)},
+        {"截断的 deflate 数据", compressed.substr(0, compressed.size() / 2)},
+        {"deflate 数据后有多余字节", compressed + "garbage"},
+    };
+    for (const auto& item : cases) {
+        if (decompress(compressor, item.data, MAX_LEN, out)) {
+            spdlog::error("{}: 损坏的压缩数据未被拒绝", item.name);
+            return false;
+        }
+    }
+    if (!roundTrips(compressor, body)) {
+        return false;
+    }
+
+    spdlog::info("损坏的压缩数据被拒绝");
+    return true;
+}
+
+bool TestFrameCompressor::testCompressedBatchFrame() {
+    struct event_base* base = event_base_new();
+    bool passed = checkCompressedFrames(base);
+    event_base_free(base);
+
+    if (passed) {
+        spdlog::info("压缩的批次帧经连接解压后逐条处理");
+    }
+    return passed;
+}
+
+} // namespace test
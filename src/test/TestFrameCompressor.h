@@ -0,0 +1,21 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+namespace test {
+
+// 帧压缩测试：压缩后能原样解压，声明长度越界或不符、数据损坏的帧被拒绝；
+// 压缩的批次帧经连接拆包、解压后逐条交给回调
+class TestFrameCompressor {
+public:
+    static bool runAllTests();
+
+private:
+    static bool testRoundTrip();
+    static bool testDeclaredLengthTooLarge();
+    static bool testDeclaredLengthMismatch();
+    static bool testCorruptData();
+    static bool testCompressedBatchFrame();
+};
+
+} // namespace test
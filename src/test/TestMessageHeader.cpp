@@ -0,0 +1,205 @@
+#include "TestMessageHeader.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../proto/Message.h"
+
+namespace test {
+
+namespace {
+
+// 按线格式手工拼出消息体，用于构造 protobuf 序列化不会产生的输入
+class WireWriter {
+public:
+    WireWriter& varint(uint64_t value) {
+        while (value >= 0x80) {
+            bytes_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        bytes_.push_back(static_cast<char>(value));
+        return *this;
+    }
+    WireWriter& tag(uint32_t field, uint32_t wire_type) {
+        return varint((static_cast<uint64_t>(field) << 3) | wire_type);
+    }
+    WireWriter& raw(const std::string& bytes) {
+        bytes_ += bytes;
+        return *this;
+    }
+    WireWriter& fill(size_t count) {
+        bytes_.append(count, '\x01');
+        return *this;
+    }
+    const std::string& bytes() const { return bytes_; }
+
+private:
+    std::string bytes_;
+};
+
+constexpr uint32_t WIRE_VARINT = 0;
+constexpr uint32_t WIRE_FIXED64 = 1;
+constexpr uint32_t WIRE_LENGTH = 2;
+constexpr uint32_t WIRE_START_GROUP = 3;
+constexpr uint32_t WIRE_END_GROUP = 4;
+constexpr uint32_t WIRE_FIXED32 = 5;
+
+constexpr uint32_t FIELD_MSG_ID = NetworkMessage::kMsgIdFieldNumber;
+constexpr uint32_t FIELD_PLAYER_ID = NetworkMessage::kPlayerIdFieldNumber;
+constexpr uint32_t FIELD_CAPABILITIES = NetworkMessage::kCapabilitiesFieldNumber;
+constexpr uint32_t FIELD_PLAYER_UPDATE = NetworkMessage::kPlayerUpdateFieldNumber;
+constexpr uint32_t FIELD_UNKNOWN = 100;
+
+struct HeaderCase {
+    const char* name;
+    std::string body;
+};
+
+std::vector<HeaderCase> buildCases() {
+    std::vector<HeaderCase> cases;
+
+    NetworkMessage full;
+    full.set_msg_id(MessageType::PLAYER_UPDATE);
+    full.set_player_id(123456);
+    full.set_timestamp(99);
+    full.set_capabilities(Capability::CAPABILITY_BATCH | Capability::CAPABILITY_COMPRESSION);
+    full.mutable_player_update()->set_position_x(1.5f);
+    cases.push_back({"空消息体", ""});
+    cases.push_back({"protobuf 序列化的完整消息", full.SerializeAsString()});
+
+    // 重复出现的字段以最后一次为准，中间夹着子消息
+    cases.push_back({"重复 msg_id", WireWriter()
+        .tag(FIELD_MSG_ID, WIRE_VARINT).varint(MessageType::PLAYER_JOIN)
+        .tag(FIELD_PLAYER_UPDATE, WIRE_LENGTH).varint(0)
+        .tag(FIELD_MSG_ID, WIRE_VARINT).varint(MessageType::PLAYER_LEAVE).bytes()});
+    cases.push_back({"重复 player_id", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(7)
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(8).bytes()});
+
+    // 各种线格式的未知字段
+    cases.push_back({"未知 varint 字段", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_VARINT).varint(UINT64_MAX)
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(5).bytes()});
+    cases.push_back({"未知 64 位定长字段", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_FIXED64).fill(8)
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(5).bytes()});
+    cases.push_back({"未知长度前缀字段", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_LENGTH).varint(3).fill(3)
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(5).bytes()});
+    cases.push_back({"未知 32 位定长字段", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_FIXED32).fill(4)
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(5).bytes()});
+    cases.push_back({"未知 group 字段", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_START_GROUP)
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(77)
+        .tag(FIELD_UNKNOWN + 1, WIRE_START_GROUP).tag(FIELD_UNKNOWN + 1, WIRE_END_GROUP)
+        .tag(FIELD_UNKNOWN, WIRE_END_GROUP)
+        .tag(FIELD_MSG_ID, WIRE_VARINT).varint(MessageType::PLAYER_STATE).bytes()});
+    cases.push_back({"group 结束标记不匹配", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_START_GROUP).tag(FIELD_UNKNOWN + 1, WIRE_END_GROUP).bytes()});
+    cases.push_back({"group 未结束", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_START_GROUP).tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(1).bytes()});
+    cases.push_back({"顶层出现 group 结束标记", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(1).tag(FIELD_UNKNOWN, WIRE_END_GROUP).bytes()});
+    for (int depth : {50, 101}) {
+        WireWriter nested;
+        for (int i = 0; i < depth; ++i) {
+            nested.tag(FIELD_UNKNOWN, WIRE_START_GROUP);
+        }
+        for (int i = 0; i < depth; ++i) {
+            nested.tag(FIELD_UNKNOWN, WIRE_END_GROUP);
+        }
+        cases.push_back({depth > 100 ? "超过嵌套上限的 group" : "嵌套 group", nested.bytes()});
+    }
+    cases.push_back({"线格式类型 6", WireWriter().tag(FIELD_UNKNOWN, 6).bytes()});
+    cases.push_back({"线格式类型 7", WireWriter().tag(FIELD_UNKNOWN, 7).bytes()});
+
+    // 已知字段使用了不同的线格式，按未知字段跳过
+    cases.push_back({"msg_id 为长度前缀", WireWriter()
+        .tag(FIELD_MSG_ID, WIRE_LENGTH).varint(1).varint(MessageType::PLAYER_JOIN).bytes()});
+    cases.push_back({"player_id 为 32 位定长", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_FIXED32).fill(4).bytes()});
+
+    // varint 边界
+    cases.push_back({"负数枚举（10 字节 varint）", WireWriter()
+        .tag(FIELD_MSG_ID, WIRE_VARINT).varint(static_cast<uint64_t>(int64_t{-1})).bytes()});
+    cases.push_back({"超出 32 位的 player_id 截断", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint((uint64_t{1} << 32) | 5).bytes()});
+    cases.push_back({"超出 32 位的 capabilities 截断", WireWriter()
+        .tag(FIELD_CAPABILITIES, WIRE_VARINT).varint((uint64_t{3} << 40) | 2).bytes()});
+    cases.push_back({"11 字节 varint", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).raw(std::string(10, '\x80')).raw(std::string(1, '\x01')).bytes()});
+    cases.push_back({"带多余 0 延续字节的 varint", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).raw("\x85\x80\x80\x00").bytes()});
+    cases.push_back({"截断的 varint 值", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).raw("\x85\x80").bytes()});
+    cases.push_back({"截断的 tag", WireWriter().raw("\x80").bytes()});
+    cases.push_back({"5 字节 tag 的高位被丢弃", WireWriter()
+        .raw("\xf1\x8c\xf2\x88\x5f").fill(8)
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(5).bytes()});
+    cases.push_back({"超过 5 字节的 tag", WireWriter()
+        .varint((uint64_t{1} << 35) | WIRE_VARINT).varint(1).bytes()});
+    cases.push_back({"高位丢弃后字段号为 0 的 tag", WireWriter()
+        .raw("\x80\x80\x80\x80\x10").varint(1).bytes()});
+
+    // 长度与定长字段越界
+    cases.push_back({"长度前缀越过消息末尾", WireWriter()
+        .tag(FIELD_PLAYER_UPDATE, WIRE_LENGTH).varint(10).fill(3).bytes()});
+    cases.push_back({"超大长度前缀", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_LENGTH).varint(UINT64_MAX).fill(3).bytes()});
+    cases.push_back({"截断的 64 位定长字段", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_FIXED64).fill(7).bytes()});
+    cases.push_back({"截断的 32 位定长字段", WireWriter()
+        .tag(FIELD_UNKNOWN, WIRE_FIXED32).fill(3).bytes()});
+
+    // 字段号为 0
+    cases.push_back({"tag 为 0", WireWriter().varint(0).bytes()});
+    cases.push_back({"字段号 0 的长度前缀", WireWriter().tag(0, WIRE_LENGTH).varint(0).bytes()});
+    cases.push_back({"消息末尾的 tag 为 0", WireWriter()
+        .tag(FIELD_PLAYER_ID, WIRE_VARINT).varint(1).varint(0).bytes()});
+    return cases;
+}
+
+} // namespace
+
+bool TestMessageHeader::runAllTests() {
+    spdlog::info("开始测试消息头快速解析...");
+
+    if (!testMatchesProtobuf()) {
+        return false;
+    }
+
+    spdlog::info("消息头快速解析测试完成");
+    return true;
+}
+
+bool TestMessageHeader::testMatchesProtobuf() {
+    bool passed = true;
+    for (const auto& item : buildCases()) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(item.body.data());
+        NetworkMessage expected;
+        bool expected_ok = expected.ParseFromArray(data, static_cast<int>(item.body.size()));
+        MessageHeader header;
+        bool ok = Message::peekHeader(data, item.body.size(), header);
+
+        if (ok != expected_ok) {
+            spdlog::error("{}: peekHeader {} 而 protobuf {}", item.name,
+                          ok ? "接受" : "拒绝", expected_ok ? "接受" : "拒绝");
+            passed = false;
+            continue;
+        }
+        if (ok && (static_cast<int>(header.type) != static_cast<int>(expected.msg_id()) ||
+                   header.player_id != expected.player_id() ||
+                   header.capabilities != expected.capabilities())) {
+            spdlog::error("{}: 消息头 ({}, {}, {}) 与 protobuf ({}, {}, {}) 不一致", item.name,
+                          static_cast<int>(header.type), header.player_id, header.capabilities,
+                          static_cast<int>(expected.msg_id()), expected.player_id(), expected.capabilities());
+            passed = false;
+        }
+    }
+    if (passed) {
+        spdlog::info("消息头快速解析与 protobuf 一致");
+    }
+    return passed;
+}
+
+} // namespace test
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+namespace test {
+
+// Message::peekHeader 与 protobuf 完整解析的一致性测试：同一段线格式两者须同时接受或同时拒绝，
+// 接受时读出的 msg_id、player_id、capabilities 相同
+class TestMessageHeader {
+public:
+    static bool runAllTests();
+
+private:
+    static bool testMatchesProtobuf();
+};
+
+} // namespace test
@@ -0,0 +1,243 @@
+#include "TestOutboundQueue.h"
+#include <arpa/inet.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <event2/buffer.h>
+#include <event2/bufferevent.h>
+#include <event2/event.h>
+#include "../net/Connection.h"
+#include "../net/OutboundQueue.h"
+#include "../net/SharedFrame.h"
+
+namespace test {
+
+namespace {
+
+constexpr size_t COMPRESS_THRESHOLD = 512;
+
+// 测试用连接：一对 bufferevent 中的一端，对端不读取，写出的数据留在连接的输出缓冲区
+struct TestConnection {
+    std::shared_ptr<Connection> conn;
+    struct bufferevent* bev = nullptr;
+    struct bufferevent* peer = nullptr;
+
+    TestConnection(struct event_base* base, ConnectionId id, uint32_t capabilities) {
+        struct bufferevent* pair[2];
+        bufferevent_pair_new(base, 0, pair);
+        conn = std::make_shared<Connection>(pair[0]);
+        conn->setId(id);
+        conn->addCapabilities(capabilities);
+        conn->setCompressionThreshold(COMPRESS_THRESHOLD);
+        bev = pair[0];
+        peer = pair[1];
+    }
+    ~TestConnection() {
+        conn.reset();
+        bufferevent_free(peer);
+    }
+
+    // 输出缓冲区的各个数据块（bufferevent pair 的输出缓冲区头部被冻结，不能 copyout）
+    std::vector<struct evbuffer_iovec> chunks() const {
+        struct evbuffer* buffer = bufferevent_get_output(bev);
+        int count = evbuffer_peek(buffer, -1, nullptr, nullptr, 0);
+        std::vector<struct evbuffer_iovec> result(count > 0 ? count : 0);
+        evbuffer_peek(buffer, -1, nullptr, result.data(), count);
+        return result;
+    }
+
+    std::string output() const {
+        std::string bytes;
+        for (const auto& chunk : chunks()) {
+            bytes.append(static_cast<const char*>(chunk.iov_base), chunk.iov_len);
+        }
+        return bytes;
+    }
+
+    // 输出缓冲区中是否有一块恰好指向 [data, data + len)，即以引用挂入而非拷贝
+    bool references(const uint8_t* data, size_t len) const {
+        for (const auto& chunk : chunks()) {
+            if (chunk.iov_base == data && chunk.iov_len == len) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// 小消息：批次中直接拷贝
+SharedFrame* makeSmallFrame(uint32_t player_id) {
+    NetworkMessage pb_msg;
+    pb_msg.set_msg_id(MessageType::PLAYER_UPDATE);
+    pb_msg.set_player_id(player_id);
+    pb_msg.mutable_player_update()->set_position_x(1.0f);
+    return SharedFrame::fromProto(pb_msg);
+}
+
+// 超过压缩阈值、可压缩的大消息，模拟广播给所有连接的快照
+SharedFrame* makeLargeFrame() {
+    NetworkMessage pb_msg;
+    pb_msg.set_msg_id(MessageType::PLAYER_ATTRIBUTE);
+    pb_msg.set_player_id(100);
+    auto* weapons = pb_msg.mutable_player_attribute()->mutable_weapons();
+    for (int i = 0; i < 64; ++i) {
+        (*weapons)["weapon_" + std::to_string(i)] = i;
+    }
+    return SharedFrame::fromProto(pb_msg);
+}
+
+void pushFrame(OutboundQueue& queue, const TestConnection& target, SharedFrame* frame) {
+    frame->retain();
+    queue.push(OutboundQueue::Item{target.conn, frame, 0, OutboundQueue::Kind::FRAME});
+}
+
+std::string bodyOf(const SharedFrame* frame) {
+    return std::string(reinterpret_cast<const char*>(frame->data()) + sizeof(uint32_t),
+                       frame->size() - sizeof(uint32_t));
+}
+
+// 逐帧拆开输出，返回各帧的标志和消息体
+std::vector<std::pair<uint32_t, std::string>> splitFrames(const std::string& bytes) {
+    std::vector<std::pair<uint32_t, std::string>> frames;
+    size_t pos = 0;
+    while (pos + sizeof(uint32_t) <= bytes.size()) {
+        uint32_t net_len = 0;
+        bytes.copy(reinterpret_cast<char*>(&net_len), sizeof(net_len), pos);
+        uint32_t header = ntohl(net_len);
+        size_t len = header & FRAME_LENGTH_MASK;
+        frames.emplace_back(header & FRAME_FLAGS_MASK, bytes.substr(pos + sizeof(uint32_t), len));
+        pos += sizeof(uint32_t) + len;
+    }
+    return frames;
+}
+
+bool checkBatchReferences(struct event_base* base) {
+    TestConnection first(base, 1, Capability::CAPABILITY_BATCH);
+    TestConnection second(base, 2, Capability::CAPABILITY_BATCH);
+    SharedFrame* small_a = makeSmallFrame(1);
+    SharedFrame* large = makeLargeFrame();
+    SharedFrame* small_b = makeSmallFrame(2);
+
+    // 同一共享帧经出站队列合入两个连接各自的批次帧
+    OutboundQueue queue([]() {});
+    for (const TestConnection* target : {&first, &second}) {
+        pushFrame(queue, *target, small_a);
+        pushFrame(queue, *target, large);
+        pushFrame(queue, *target, small_b);
+    }
+    queue.drain();
+
+    bool passed = true;
+    const uint8_t* large_body = large->data() + sizeof(uint32_t);
+    for (const TestConnection* target : {&first, &second}) {
+        if (!target->references(large_body, large->size() - sizeof(uint32_t))) {
+            spdlog::error("连接 {} 的批次帧拷贝了共享帧的消息体", target->conn->getId());
+            passed = false;
+            continue;
+        }
+        auto frames = splitFrames(target->output());
+        MessageBatch batch;
+        if (frames.size() != 1 || frames[0].first != FRAME_FLAG_BATCH || !batch.ParseFromString(frames[0].second) ||
+            batch.messages_size() != 3 || batch.messages(0) != bodyOf(small_a) ||
+            batch.messages(1) != bodyOf(large) || batch.messages(2) != bodyOf(small_b)) {
+            spdlog::error("连接 {} 的批次帧内容不符", target->conn->getId());
+            passed = false;
+        }
+    }
+    if (large->compressed() == large) {
+        spdlog::error("测试用的大消息不可压缩");
+        passed = false;
+    }
+
+    small_a->release();
+    large->release();
+    small_b->release();
+    return passed;
+}
+
+bool checkCompressedFrameShared(struct event_base* base) {
+    uint32_t capabilities = Capability::CAPABILITY_BATCH | Capability::CAPABILITY_COMPRESSION;
+    TestConnection first(base, 1, capabilities);
+    TestConnection second(base, 2, capabilities);
+    SharedFrame* small_a = makeSmallFrame(1);
+    SharedFrame* small_b = makeSmallFrame(2);
+    SharedFrame* small_c = makeSmallFrame(3);
+    SharedFrame* large = makeLargeFrame();
+
+    OutboundQueue queue([]() {});
+    for (const TestConnection* target : {&first, &second}) {
+        pushFrame(queue, *target, small_a);
+        pushFrame(queue, *target, small_b);
+        pushFrame(queue, *target, large);
+        pushFrame(queue, *target, small_c);
+    }
+    queue.drain();
+
+    // 两个连接都直接引用大消息唯一的压缩版本，压缩只做一次
+    bool passed = true;
+    SharedFrame* compressed = large->compressed();
+    for (const TestConnection* target : {&first, &second}) {
+        if (compressed == large || !target->references(compressed->data(), compressed->size())) {
+            spdlog::error("连接 {} 没有共用大消息的压缩版本", target->conn->getId());
+            passed = false;
+            continue;
+        }
+        // 压缩帧前后的普通帧仍按顺序发出：前两条合成批次帧，最后一条单独一帧
+        auto frames = splitFrames(target->output());
+        MessageBatch batch;
+        if (frames.size() != 3 || frames[0].first != FRAME_FLAG_BATCH || !batch.ParseFromString(frames[0].second) ||
+            batch.messages_size() != 2 || batch.messages(0) != bodyOf(small_a) || batch.messages(1) != bodyOf(small_b) ||
+            frames[1].first != FRAME_FLAG_COMPRESSED || frames[1].second != bodyOf(compressed) ||
+            frames[2].first != 0 || frames[2].second != bodyOf(small_c)) {
+            spdlog::error("连接 {} 的输出帧顺序或内容不符", target->conn->getId());
+            passed = false;
+        }
+    }
+
+    small_a->release();
+    small_b->release();
+    small_c->release();
+    large->release();
+    return passed;
+}
+
+} // namespace
+
+bool TestOutboundQueue::runAllTests() {
+    spdlog::info("开始测试出站队列...");
+
+    if (!testBatchReferencesSharedFrame()) {
+        return false;
+    }
+    if (!testCompressedFrameSharedAcrossBatches()) {
+        return false;
+    }
+
+    spdlog::info("出站队列测试完成");
+    return true;
+}
+
+bool TestOutboundQueue::testBatchReferencesSharedFrame() {
+    struct event_base* base = event_base_new();
+    bool passed = checkBatchReferences(base);
+    event_base_free(base);
+
+    if (passed) {
+        spdlog::info("批次帧引用共享帧的消息体，不拷贝");
+    }
+    return passed;
+}
+
+bool TestOutboundQueue::testCompressedFrameSharedAcrossBatches() {
+    struct event_base* base = event_base_new();
+    bool passed = checkCompressedFrameShared(base);
+    event_base_free(base);
+
+    if (passed) {
+        spdlog::info("需要压缩的共享帧单独发送，各连接共用一份压缩结果");
+    }
+    return passed;
+}
+
+} // namespace test
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+namespace test {
+
+// 出站队列测试：批次帧直接引用共享帧的消息体，不拷贝；
+// 需要压缩的共享帧不并入批次，多个连接共用同一份压缩结果
+class TestOutboundQueue {
+public:
+    static bool runAllTests();
+
+private:
+    static bool testBatchReferencesSharedFrame();
+    static bool testCompressedFrameSharedAcrossBatches();
+};
+
+} // namespace test
@@ -0,0 +1,308 @@
+#include "TestSnapshotManager.h"
+#include <cmath>
+#include <memory>
+#include <string>
+#include <event2/bufferevent.h>
+#include <event2/event.h>
+#include <google/protobuf/util/message_differencer.h>
+#include "../game/SnapshotManager.h"
+#include "../proto/CompactCodec.h"
+
+namespace test {
+
+namespace {
+
+PlayerStateMessage makePlayer(uint32_t player_id, float x, float yaw, float health, uint32_t team_id) {
+    PlayerStateMessage player;
+    player.set_player_id(player_id);
+    player.mutable_position()->set_x(x);
+    player.mutable_position()->set_y(1.0f);
+    player.mutable_position()->set_z(-x);
+    player.mutable_rotation()->set_x(10.0f);
+    player.mutable_rotation()->set_y(yaw);
+    player.mutable_attributes()->set_player_id(player_id);
+    player.mutable_attributes()->set_health(health);
+    player.set_is_alive(health > 0.0f);
+    player.set_team_id(team_id);
+    return player;
+}
+
+// 基线快照：玩家 1、2、3
+SnapshotManager::Snapshot makeBaseline() {
+    SnapshotManager::Snapshot snapshot;
+    snapshot.sequence = 7;
+    snapshot.players.push_back(makePlayer(1, 10.0f, 90.0f, 100.0f, 1));
+    snapshot.players.push_back(makePlayer(2, 20.0f, 180.0f, 80.0f, 1));
+    snapshot.players.push_back(makePlayer(3, 30.0f, 270.0f, 60.0f, 2));
+    return snapshot;
+}
+
+// 相对基线：玩家 1 移动并清除了属性，玩家 2 不变，玩家 3 移除，玩家 4 新出现
+SnapshotManager::Snapshot makeCurrent() {
+    SnapshotManager::Snapshot snapshot;
+    snapshot.sequence = 8;
+    snapshot.players.push_back(makePlayer(1, 12.5f, 90.0f, 100.0f, 1));
+    snapshot.players.back().clear_attributes();
+    snapshot.players.push_back(makePlayer(2, 20.0f, 180.0f, 80.0f, 1));
+    snapshot.players.push_back(makePlayer(4, -40.0f, 45.0f, 0.0f, 2));
+    return snapshot;
+}
+
+bool sameSnapshot(const SnapshotManager::Snapshot& a, const SnapshotManager::Snapshot& b) {
+    if (a.sequence != b.sequence || a.players.size() != b.players.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.players.size(); ++i) {
+        if (!google::protobuf::util::MessageDifferencer::Equals(a.players[i], b.players[i])) {
+            spdlog::error("玩家 {} 的状态不一致: {} / {}", a.players[i].player_id(),
+                          a.players[i].ShortDebugString(), b.players[i].ShortDebugString());
+            return false;
+        }
+    }
+    return true;
+}
+
+// 测试用连接：一对 bufferevent 中的一端，另一端随对象释放
+struct TestConnection {
+    std::shared_ptr<Connection> conn;
+    struct bufferevent* peer = nullptr;
+
+    TestConnection(struct event_base* base, ConnectionId id) {
+        struct bufferevent* pair[2];
+        bufferevent_pair_new(base, 0, pair);
+        conn = std::make_shared<Connection>(pair[0]);
+        conn->setId(id);
+        peer = pair[1];
+    }
+    ~TestConnection() {
+        conn.reset();
+        bufferevent_free(peer);
+    }
+};
+
+Message makeMessage(MessageType type, uint32_t player_id, float x = 0.0f) {
+    NetworkMessage pb_msg;
+    pb_msg.set_msg_id(type);
+    pb_msg.set_player_id(player_id);
+    if (type == MessageType::PLAYER_UPDATE) {
+        pb_msg.mutable_player_update()->set_position_x(x);
+        pb_msg.mutable_player_update()->set_health(100.0f);
+    }
+    std::string body = pb_msg.SerializeAsString();
+    Message msg;
+    msg.deserializeBody(reinterpret_cast<const uint8_t*>(body.data()), body.size());
+    return msg;
+}
+
+// 玩家当前的 x 坐标，没有坐标时为 NaN
+float positionOf(SnapshotManager& snapshots, uint32_t player_id) {
+    PlayerStateMessage* state = snapshots.mutablePlayer(player_id, nullptr);
+    return state->has_position() ? state->position().x() : NAN;
+}
+
+bool checkPlayerBinding(const std::shared_ptr<Connection>& a, const std::shared_ptr<Connection>& b) {
+    SnapshotManager snapshots;
+
+    // 加入时绑定 player_id，已被其他在线连接占用的 player_id 不能再加入
+    if (snapshots.onMessage(a, makeMessage(MessageType::PLAYER_JOIN, 10)) ||
+        !snapshots.onMessage(b, makeMessage(MessageType::PLAYER_JOIN, 10)) ||
+        snapshots.onMessage(b, makeMessage(MessageType::PLAYER_JOIN, 20)) ||
+        !snapshots.isBoundTo(a, 10) || !snapshots.isBoundTo(b, 20)) {
+        spdlog::error("加入时的 player_id 绑定不符");
+        return false;
+    }
+
+    // 只接受绑定连接的移动，冒用或未加入的 player_id 被丢弃
+    snapshots.onMessage(a, makeMessage(MessageType::PLAYER_UPDATE, 10, 1.0f));
+    if (!snapshots.onMessage(b, makeMessage(MessageType::PLAYER_UPDATE, 10, 99.0f)) ||
+        !snapshots.onMessage(b, makeMessage(MessageType::PLAYER_UPDATE, 30, 99.0f)) ||
+        positionOf(snapshots, 10) != 1.0f || !std::isnan(positionOf(snapshots, 30))) {
+        spdlog::error("冒用 player_id 的 PLAYER_UPDATE 未被丢弃");
+        return false;
+    }
+
+    // 离开同样只对绑定连接生效
+    if (!snapshots.onMessage(b, makeMessage(MessageType::PLAYER_LEAVE, 10)) || positionOf(snapshots, 10) != 1.0f) {
+        spdlog::error("冒用 player_id 的 PLAYER_LEAVE 未被丢弃");
+        return false;
+    }
+    if (snapshots.onMessage(a, makeMessage(MessageType::PLAYER_LEAVE, 10)) ||
+        snapshots.isBoundTo(a, 10) || !std::isnan(positionOf(snapshots, 10))) {
+        spdlog::error("PLAYER_LEAVE 未移除玩家");
+        return false;
+    }
+
+    // 离开后 player_id 可由其他连接加入，换用新 ID 时原玩家离开
+    snapshots.onMessage(b, makeMessage(MessageType::PLAYER_UPDATE, 20, 2.0f));
+    if (snapshots.onMessage(b, makeMessage(MessageType::PLAYER_JOIN, 10)) ||
+        !snapshots.isBoundTo(b, 10) || snapshots.isBoundTo(b, 20) || !std::isnan(positionOf(snapshots, 20))) {
+        spdlog::error("离开后重新加入失败");
+        return false;
+    }
+    if (snapshots.getStats().rejected != 4) {
+        spdlog::error("丢弃计数为 {}，期望 4", snapshots.getStats().rejected);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool TestSnapshotManager::runAllTests() {
+    spdlog::info("开始测试世界快照...");
+
+    if (!testDeltaRoundTrip()) {
+        return false;
+    }
+
+    if (!testCompactDelta()) {
+        return false;
+    }
+
+    if (!testBaselineMismatch()) {
+        return false;
+    }
+
+    if (!testPlayerBinding()) {
+        return false;
+    }
+
+    spdlog::info("世界快照测试完成");
+    return true;
+}
+
+bool TestSnapshotManager::testDeltaRoundTrip() {
+    SnapshotManager::Snapshot baseline = makeBaseline();
+    SnapshotManager::Snapshot current = makeCurrent();
+
+    // 完整快照：不需要基线
+    WorldSnapshot full;
+    SnapshotManager::encodeDelta(nullptr, current, false, &full);
+    SnapshotManager::Snapshot decoded;
+    if (full.baseline() != 0 || full.entities_size() != 3 || full.removed_size() != 0 ||
+        !SnapshotManager::applyDelta(nullptr, full, &decoded) || !sameSnapshot(decoded, current)) {
+        spdlog::error("完整快照往返失败");
+        return false;
+    }
+
+    // 增量：只包含变化的实体和字段，以及移除的实体
+    WorldSnapshot delta;
+    SnapshotManager::encodeDelta(&baseline, current, false, &delta);
+    if (delta.baseline() != baseline.sequence || delta.sequence() != current.sequence ||
+        delta.entities_size() != 2 || delta.removed_size() != 1 || delta.removed(0) != 3) {
+        spdlog::error("增量快照内容不符: {}", delta.ShortDebugString());
+        return false;
+    }
+    const EntityDelta& moved = delta.entities(0);
+    uint32_t expected_changed = (1u << PlayerStateMessage::kPositionFieldNumber) |
+                                (1u << PlayerStateMessage::kAttributesFieldNumber);
+    if (moved.state().player_id() != 1 || moved.changed() != expected_changed ||
+        moved.state().has_rotation() || moved.state().has_attributes()) {
+        spdlog::error("增量中玩家 1 的字段不符: {}", moved.ShortDebugString());
+        return false;
+    }
+    if (!SnapshotManager::applyDelta(&baseline, delta, &decoded) || !sameSnapshot(decoded, current)) {
+        spdlog::error("增量快照往返失败");
+        return false;
+    }
+
+    // 没有变化时增量为空
+    WorldSnapshot empty;
+    SnapshotManager::Snapshot same = current;
+    same.sequence = 9;
+    SnapshotManager::encodeDelta(&current, same, false, &empty);
+    if (empty.entities_size() != 0 || empty.removed_size() != 0 ||
+        !SnapshotManager::applyDelta(&current, empty, &decoded) || !sameSnapshot(decoded, same)) {
+        spdlog::error("无变化的增量快照往返失败");
+        return false;
+    }
+
+    spdlog::info("增量快照往返一致");
+    return true;
+}
+
+bool TestSnapshotManager::testCompactDelta() {
+    SnapshotManager::Snapshot baseline = makeBaseline();
+    SnapshotManager::Snapshot current = makeCurrent();
+
+    // 坐标和朝向以 compact_transform 发送，还原后在量化精度内，翻滚角为 0
+    WorldSnapshot delta;
+    SnapshotManager::encodeDelta(&baseline, current, true, &delta);
+    for (const auto& entity : delta.entities()) {
+        if (entity.state().has_position() || entity.state().has_rotation() ||
+            entity.state().compact_transform().size() != CompactCodec::TRANSFORM_BYTES) {
+            spdlog::error("紧凑增量中仍包含完整坐标: {}", entity.ShortDebugString());
+            return false;
+        }
+    }
+    SnapshotManager::Snapshot decoded;
+    if (!SnapshotManager::applyDelta(&baseline, delta, &decoded) || decoded.players.size() != current.players.size()) {
+        spdlog::error("紧凑增量快照往返失败");
+        return false;
+    }
+    for (size_t i = 0; i < decoded.players.size(); ++i) {
+        const PlayerStateMessage& expected = current.players[i];
+        const PlayerStateMessage& actual = decoded.players[i];
+        if (actual.player_id() != expected.player_id() ||
+            std::fabs(actual.position().x() - expected.position().x()) > 0.002f ||
+            std::fabs(actual.position().y() - expected.position().y()) > 0.008f ||
+            std::fabs(actual.position().z() - expected.position().z()) > 0.002f ||
+            std::fabs(actual.rotation().x() - expected.rotation().x()) > 0.4f ||
+            std::fabs(actual.rotation().y() - expected.rotation().y()) > 0.2f ||
+            actual.rotation().z() != 0.0f ||
+            actual.has_attributes() != expected.has_attributes() ||
+            actual.is_alive() != expected.is_alive() || actual.team_id() != expected.team_id()) {
+            spdlog::error("紧凑增量还原的玩家状态不符: {} / {}", actual.ShortDebugString(), expected.ShortDebugString());
+            return false;
+        }
+    }
+
+    spdlog::info("紧凑增量快照往返在量化精度内");
+    return true;
+}
+
+bool TestSnapshotManager::testBaselineMismatch() {
+    SnapshotManager::Snapshot baseline = makeBaseline();
+    SnapshotManager::Snapshot current = makeCurrent();
+    WorldSnapshot delta;
+    SnapshotManager::encodeDelta(&baseline, current, false, &delta);
+
+    // 没有基线，或基线序号与增量不符时拒绝
+    SnapshotManager::Snapshot decoded;
+    SnapshotManager::Snapshot other = baseline;
+    other.sequence = baseline.sequence + 1;
+    if (SnapshotManager::applyDelta(nullptr, delta, &decoded) ||
+        SnapshotManager::applyDelta(&other, delta, &decoded)) {
+        spdlog::error("基线不符的增量快照未被拒绝");
+        return false;
+    }
+
+    // 损坏的 compact_transform 使整个增量被拒绝
+    SnapshotManager::encodeDelta(&baseline, current, true, &delta);
+    delta.mutable_entities(0)->mutable_state()->mutable_compact_transform()->resize(3);
+    if (SnapshotManager::applyDelta(&baseline, delta, &decoded)) {
+        spdlog::error("compact_transform 长度错误的增量快照未被拒绝");
+        return false;
+    }
+
+    spdlog::info("基线不符的增量快照被拒绝");
+    return true;
+}
+
+bool TestSnapshotManager::testPlayerBinding() {
+    struct event_base* base = event_base_new();
+    bool passed;
+    {
+        TestConnection a(base, 1);
+        TestConnection b(base, 2);
+        passed = checkPlayerBinding(a.conn, b.conn);
+    }
+    event_base_free(base);
+
+    if (passed) {
+        spdlog::info("移动和离开消息只对绑定的玩家生效");
+    }
+    return passed;
+}
+
+} // namespace test
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+namespace test {
+
+// 世界快照测试：增量编码经 applyDelta 还原后与当前快照一致；
+// 移动和离开消息只对发送连接加入时绑定的 player_id 生效
+class TestSnapshotManager {
+public:
+    static bool runAllTests();
+
+private:
+    static bool testDeltaRoundTrip();
+    static bool testCompactDelta();
+    static bool testBaselineMismatch();
+    static bool testPlayerBinding();
+};
+
+} // namespace test
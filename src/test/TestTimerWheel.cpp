@@ -0,0 +1,281 @@
+#include "TestTimerWheel.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+#include "../core/TimerWheel.h"
+
+namespace test {
+
+namespace {
+
+constexpr uint64_t SLOTS = 64;
+// 4 层 × 6 位能表示的最大延迟（tick）
+constexpr uint64_t MAX_TICKS = (1ULL << 24) - 1;
+constexpr uint64_t NOT_FIRED = UINT64_MAX;
+
+// 以 1ms 为 tick 的时间轮，时间以构造时刻起的 tick 数表示：
+// 在 tick t 以 delay 挂入的定时器恰好在 tick t + delay + 1 触发
+struct WheelClock {
+    TimerWheel wheel{1};
+    uint64_t base = TimerWheel::nowMs();
+    uint64_t now = 0;
+
+    WheelClock() { wheel.advance(base); }
+
+    size_t advanceTo(uint64_t tick) {
+        now = tick;
+        return wheel.advance(base + tick);
+    }
+    // 从当前 tick 起到 fire_at 触发所需的延迟
+    uint64_t delayUntil(uint64_t fire_at) const { return fire_at - now - 1; }
+    // 下一个 block 整数倍的绝对 tick 换算成相对 tick
+    uint64_t nextBoundary(uint64_t block) const { return ((base + now) / block + 1) * block - base; }
+};
+
+// 在当前 tick 挂入一批到期 tick 恰好落在各层块边界前后的定时器，逐个到期 tick 推进并核对
+bool checkBoundaries(WheelClock& clock) {
+    std::vector<uint64_t> targets;
+    for (uint64_t block : {SLOTS, SLOTS * SLOTS, SLOTS * SLOTS * SLOTS}) {
+        uint64_t boundary = clock.nextBoundary(block);
+        for (uint64_t at : {boundary - 1, boundary, boundary + 1, boundary + 3 * block + 5,
+                            clock.now + block - 1, clock.now + block, clock.now + block + 1}) {
+            if (at > clock.now) {
+                targets.push_back(at);
+            }
+        }
+    }
+    targets.push_back(clock.now + 1);
+    targets.push_back(clock.now + MAX_TICKS);
+
+    std::vector<TimerNode> nodes(targets.size() + 1);
+    std::vector<uint64_t> fired(nodes.size(), NOT_FIRED);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].setCallback([&clock, &fired, i]() { fired[i] = clock.now; });
+    }
+    for (size_t i = 0; i < targets.size(); ++i) {
+        clock.wheel.schedule(nodes[i], clock.delayUntil(targets[i]));
+    }
+    // 超出范围的延迟截断为最大值
+    targets.push_back(clock.now + MAX_TICKS);
+    clock.wheel.schedule(nodes.back(), 1ULL << 40);
+
+    // 每个到期 tick 的前一 tick 和当 tick 各推进一次，提前或推后触发都会被发现
+    std::set<uint64_t> steps;
+    for (uint64_t at : targets) {
+        steps.insert(at - 1);
+        steps.insert(at);
+    }
+    for (uint64_t step : steps) {
+        clock.advanceTo(step);
+    }
+
+    for (size_t i = 0; i < targets.size(); ++i) {
+        if (fired[i] != targets[i]) {
+            spdlog::error("定时器应在 tick {} 触发，实际为 {}", targets[i],
+                          fired[i] == NOT_FIRED ? std::string("未触发") : std::to_string(fired[i]));
+            return false;
+        }
+    }
+    if (clock.wheel.size() != 0) {
+        spdlog::error("全部触发后时间轮中仍有 {} 个定时器", clock.wheel.size());
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool TestTimerWheel::runAllTests() {
+    spdlog::info("开始测试时间轮...");
+
+    if (!testLevelBoundaries()) {
+        return false;
+    }
+    if (!testRescheduleInCallback()) {
+        return false;
+    }
+    if (!testCallbackDestroysNode()) {
+        return false;
+    }
+    if (!testExpireBudget()) {
+        return false;
+    }
+
+    spdlog::info("时间轮测试完成");
+    return true;
+}
+
+bool TestTimerWheel::testLevelBoundaries() {
+    WheelClock clock;
+    if (!checkBoundaries(clock)) {
+        return false;
+    }
+
+    // 再从第 2 层块边界前几个 tick 处挂入一轮，各层槽下标与上一轮不同
+    clock.advanceTo(clock.nextBoundary(SLOTS * SLOTS) - 3);
+    if (!checkBoundaries(clock)) {
+        return false;
+    }
+
+    spdlog::info("跨层边界的定时器在到期 tick 准确触发");
+    return true;
+}
+
+bool TestTimerWheel::testRescheduleInCallback() {
+    WheelClock clock;
+
+    // 周期定时器在回调中重置自己，第一次触发时挂入一个 0 延迟的新节点
+    TimerNode periodic, late;
+    std::vector<uint64_t> periodic_fired;
+    periodic.setCallback([&]() {
+        periodic_fired.push_back(clock.now);
+        if (periodic_fired.size() < 3) {
+            clock.wheel.schedule(periodic, 9);
+        }
+        if (periodic_fired.size() == 1) {
+            clock.wheel.schedule(late, 0);
+        }
+    });
+    uint64_t late_fired = NOT_FIRED;
+    late.setCallback([&]() { late_fired = clock.now; });
+
+    // 同一 tick 到期的两个节点互相取消：先触发的一方取消已到期、等待触发的另一方
+    TimerNode first, second;
+    int pair_fired = 0;
+    first.setCallback([&]() { ++pair_fired; clock.wheel.cancel(second); });
+    second.setCallback([&]() { ++pair_fired; clock.wheel.cancel(first); });
+
+    // 重置后立刻取消的节点不再触发
+    TimerNode pending;
+    bool pending_fired = false;
+    pending.setCallback([&]() { pending_fired = true; });
+    clock.wheel.schedule(pending, 4);
+    clock.wheel.schedule(pending, 100);
+    clock.wheel.cancel(pending);
+
+    clock.wheel.schedule(periodic, 9);
+    clock.wheel.schedule(first, 14);
+    clock.wheel.schedule(second, 14);
+    for (uint64_t tick = 1; tick <= 200; ++tick) {
+        clock.advanceTo(tick);
+    }
+
+    if (periodic_fired != std::vector<uint64_t>{10, 20, 30}) {
+        spdlog::error("在回调中重置的定时器触发了 {} 次，触发时刻不符", periodic_fired.size());
+        return false;
+    }
+    // 回调中以 0 延迟挂入的节点在下一个 tick 触发，不在本次推进中触发
+    if (late_fired != 11) {
+        spdlog::error("回调中挂入的定时器应在 tick 11 触发，实际为 {}", late_fired);
+        return false;
+    }
+    if (pair_fired != 1 || pending_fired) {
+        spdlog::error("已取消的定时器仍被触发");
+        return false;
+    }
+    if (clock.wheel.size() != 0) {
+        spdlog::error("全部触发后时间轮中仍有 {} 个定时器", clock.wheel.size());
+        return false;
+    }
+
+    spdlog::info("回调中重置和取消定时器生效");
+    return true;
+}
+
+bool TestTimerWheel::testCallbackDestroysNode() {
+    WheelClock clock;
+
+    // 回调销毁自身节点，以及同一 tick 到期、尚未触发的另一个节点
+    auto self = std::make_unique<TimerNode>();
+    auto other = std::make_unique<TimerNode>();
+    int fired = 0;
+    self->setCallback([&]() {
+        ++fired;
+        self.reset();
+        other.reset();
+    });
+    other->setCallback([&]() {
+        ++fired;
+        self.reset();
+        other.reset();
+    });
+    TimerNode survivor;
+    bool survivor_fired = false;
+    survivor.setCallback([&]() { survivor_fired = true; });
+
+    clock.wheel.schedule(*self, 4);
+    clock.wheel.schedule(*other, 4);
+    clock.wheel.schedule(survivor, 4);
+    size_t count = clock.advanceTo(5);
+
+    if (fired != 1 || self || other || !survivor_fired || count != 2 || clock.wheel.size() != 0) {
+        spdlog::error("回调销毁节点后触发 {} 次（期望 1），推进返回 {}，剩余 {} 个定时器",
+                      fired, count, clock.wheel.size());
+        return false;
+    }
+
+    // 时间轮先于节点销毁时，节点析构不再访问时间轮
+    auto wheel = std::make_unique<TimerWheel>(1);
+    TimerNode orphan;
+    wheel->schedule(orphan, 10);
+    wheel.reset();
+    if (orphan.isActive()) {
+        spdlog::error("时间轮销毁后节点仍处于挂入状态");
+        return false;
+    }
+
+    spdlog::info("回调中销毁节点安全");
+    return true;
+}
+
+bool TestTimerWheel::testExpireBudget() {
+    WheelClock clock;
+    clock.wheel.setExpireBudget(3);
+
+    std::vector<TimerNode> nodes(10);
+    std::vector<int> fired(nodes.size() + 1, 0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].setCallback([&fired, i]() { ++fired[i]; });
+        clock.wheel.schedule(nodes[i], 0);
+    }
+
+    // 同一 tick 到期的 10 个定时器，每次推进最多触发 3 个，时间不前进也继续触发剩余的
+    if (clock.advanceTo(1) != 3 || clock.advanceTo(1) != 3 || clock.wheel.size() != 4) {
+        spdlog::error("按预算推进后剩余 {} 个定时器，期望 4", clock.wheel.size());
+        return false;
+    }
+
+    // 等待触发的定时器可以取消；之后到期的定时器与遗留的一起按预算触发
+    auto waiting = std::find(fired.begin(), fired.begin() + nodes.size(), 0) - fired.begin();
+    clock.wheel.cancel(nodes[waiting]);
+    TimerNode later;
+    later.setCallback([&fired]() { ++fired.back(); });
+    clock.wheel.schedule(later, 1);
+    if (clock.advanceTo(3) != 3 || clock.advanceTo(4) != 1 || clock.advanceTo(5) != 0) {
+        spdlog::error("跨多次推进的到期回调数量不符");
+        return false;
+    }
+    for (size_t i = 0; i < fired.size(); ++i) {
+        if (fired[i] != (static_cast<ptrdiff_t>(i) == waiting ? 0 : 1)) {
+            spdlog::error("定时器 {} 触发了 {} 次", i, fired[i]);
+            return false;
+        }
+    }
+
+    // 预算为 0 时一次触发全部到期的定时器
+    clock.wheel.setExpireBudget(0);
+    for (auto& node : nodes) {
+        clock.wheel.schedule(node, 0);
+    }
+    if (clock.advanceTo(6) != nodes.size() || clock.wheel.size() != 0) {
+        spdlog::error("不限预算时未一次触发全部定时器");
+        return false;
+    }
+
+    spdlog::info("超出预算的到期回调在之后的推进中触发");
+    return true;
+}
+
+} // namespace test
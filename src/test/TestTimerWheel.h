@@ -0,0 +1,20 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+namespace test {
+
+// 时间轮测试：跨层边界的定时器在到期 tick 准确触发，回调中重置、取消和销毁节点安全，
+// 超出预算的到期回调留到之后的推进中触发
+class TestTimerWheel {
+public:
+    static bool runAllTests();
+
+private:
+    static bool testLevelBoundaries();
+    static bool testRescheduleInCallback();
+    static bool testCallbackDestroysNode();
+    static bool testExpireBudget();
+};
+
+} // namespace test
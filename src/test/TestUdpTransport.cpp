@@ -0,0 +1,263 @@
+#include "TestUdpTransport.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <arpa/inet.h>
+#include <endian.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../core/EventLoop.h"
+#include "../net/TcpServer.h"
+#include "../net/UdpServer.h"
+#include "../net/ConnectionPool.h"
+#include "../game/CppEngine.h"
+#include "../game/SnapshotManager.h"
+
+namespace test {
+
+namespace {
+
+constexpr uint16_t TEST_PORT = 18765;
+constexpr uint32_t TEST_PLAYER_ID = 42;
+
+// 在当前线程上驱动事件循环，直到条件满足或超时
+template <typename Pred>
+bool pumpUntil(EventLoop& loop, Pred pred, int timeout_ms = 2000) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        event_base_loop(loop.getBase(), EVLOOP_NONBLOCK);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+struct sockaddr_in loopbackAddr(uint16_t port) {
+    struct sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+    return addr;
+}
+
+bool sendFrame(int fd, const NetworkMessage& msg) {
+    std::string body = msg.SerializeAsString();
+    uint32_t net_len = htonl(static_cast<uint32_t>(body.size()));
+    std::string frame(reinterpret_cast<const char*>(&net_len), sizeof(net_len));
+    frame += body;
+    return send(fd, frame.data(), frame.size(), 0) == static_cast<ssize_t>(frame.size());
+}
+
+// 非阻塞地读入 TCP 数据，凑够一帧时解析到 out
+bool tryReadFrame(int fd, std::string& buffer, NetworkMessage& out) {
+    char chunk[4096];
+    ssize_t n;
+    while ((n = recv(fd, chunk, sizeof(chunk), MSG_DONTWAIT)) > 0) {
+        buffer.append(chunk, static_cast<size_t>(n));
+    }
+    if (buffer.size() < sizeof(uint32_t)) {
+        return false;
+    }
+    uint32_t net_len = 0;
+    std::memcpy(&net_len, buffer.data(), sizeof(net_len));
+    size_t len = ntohl(net_len) & FRAME_LENGTH_MASK;
+    if (buffer.size() < sizeof(uint32_t) + len) {
+        return false;
+    }
+    bool ok = out.ParseFromArray(buffer.data() + sizeof(uint32_t), static_cast<int>(len));
+    buffer.erase(0, sizeof(uint32_t) + len);
+    return ok;
+}
+
+bool sendDatagram(int fd, uint64_t token, const NetworkMessage& msg) {
+    uint64_t net_token = htobe64(token);
+    std::string datagram(reinterpret_cast<const char*>(&net_token), sizeof(net_token));
+    datagram += msg.SerializeAsString();
+    struct sockaddr_in to = loopbackAddr(TEST_PORT);
+    return sendto(fd, datagram.data(), datagram.size(), 0, (struct sockaddr*)&to, sizeof(to)) ==
+           static_cast<ssize_t>(datagram.size());
+}
+
+NetworkMessage makePlayerUpdate(float x) {
+    NetworkMessage msg;
+    msg.set_msg_id(MessageType::PLAYER_UPDATE);
+    msg.set_player_id(TEST_PLAYER_ID);
+    PlayerUpdateMessage* update = msg.mutable_player_update();
+    update->set_position_x(x);
+    update->set_position_y(2.0f);
+    update->set_position_z(3.0f);
+    update->set_health(100.0f);
+    return msg;
+}
+
+// UDP 线程上收到的消息
+struct UdpReceived {
+    std::mutex mutex;
+    size_t count = 0;
+    ConnectionId conn_id = INVALID_CONNECTION_ID;
+    uint32_t player_id = 0;
+    float position_x = 0.0f;
+};
+
+} // namespace
+
+bool TestUdpTransport::runAllTests() {
+    spdlog::info("开始测试 UDP 通道...");
+
+    if (!testBindUpdateAndSnapshot()) {
+        return false;
+    }
+
+    spdlog::info("UDP 通道测试完成");
+    return true;
+}
+
+bool TestUdpTransport::testBindUpdateAndSnapshot() {
+    EventLoop loop;
+    if (!loop.init()) {
+        spdlog::error("事件循环初始化失败");
+        return false;
+    }
+
+    // 与 GameServer 相同的组装方式：TCP 处理 UDP_BIND 和快照订阅，UDP 只投递 PLAYER_UPDATE
+    TcpServer tcp_server(loop, "127.0.0.1", TEST_PORT);
+    auto udp_server = std::make_shared<UdpServer>("127.0.0.1", TEST_PORT);
+    CppEngine engine;
+    SnapshotManager snapshots;
+    engine.setUdpServer(udp_server);
+    snapshots.setUdpServer(udp_server);
+
+    tcp_server.setMessageCallback([&](const std::shared_ptr<Connection>& conn, const Message& msg) {
+        if (!snapshots.onMessage(conn, msg)) {
+            engine.handleMessage(conn, msg);
+        }
+    });
+    UdpReceived received;
+    udp_server->setMessageCallback([&](const std::shared_ptr<Connection>& conn, const Message& msg) {
+        // 运行在 UDP 线程上：记录后交给循环线程更新世界状态
+        const NetworkMessage* pb_msg = msg.getProto();
+        {
+            std::lock_guard<std::mutex> lock(received.mutex);
+            received.count++;
+            received.conn_id = conn->getId();
+            received.player_id = msg.getPlayerId();
+            received.position_x = pb_msg ? pb_msg->player_update().position_x() : 0.0f;
+        }
+        loop.post([&snapshots, conn, msg]() { snapshots.onMessage(conn, msg); });
+    });
+
+    if (!udp_server->start() || !tcp_server.start()) {
+        spdlog::error("启动测试服务器失败");
+        udp_server->stop();
+        return false;
+    }
+
+    int tcp_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int udp_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in server_addr = loopbackAddr(TEST_PORT);
+    auto cleanup = [&]() {
+        ::close(tcp_fd);
+        ::close(udp_fd);
+        tcp_server.stop();
+        udp_server->stop();
+    };
+    auto fail = [&](const char* what) {
+        spdlog::error("UDP 通道测试失败: {}", what);
+        cleanup();
+        return false;
+    };
+
+    if (connect(tcp_fd, (struct sockaddr*)&server_addr, sizeof(server_addr)) < 0 ||
+        !pumpUntil(loop, []() { return ConnectionPool::getInstance().getConnectionCount() == 1; })) {
+        return fail("TCP 连接未建立");
+    }
+    auto server_conn = (*ConnectionPool::getInstance().getSnapshot())[0];
+
+    // 加入并经 TCP 请求 UDP 会话令牌
+    NetworkMessage join;
+    join.set_msg_id(MessageType::PLAYER_JOIN);
+    join.set_player_id(TEST_PLAYER_ID);
+    NetworkMessage bind_request;
+    bind_request.set_msg_id(MessageType::UDP_BIND);
+    bind_request.set_player_id(TEST_PLAYER_ID);
+    if (!sendFrame(tcp_fd, join) || !sendFrame(tcp_fd, bind_request)) {
+        return fail("发送 UDP_BIND 请求失败");
+    }
+    std::string tcp_buffer;
+    NetworkMessage bind_reply;
+    if (!pumpUntil(loop, [&]() { return tryReadFrame(tcp_fd, tcp_buffer, bind_reply); }) ||
+        bind_reply.msg_id() != MessageType::UDP_BIND || bind_reply.udp_bind().token() == 0 ||
+        bind_reply.udp_bind().port() != TEST_PORT) {
+        return fail("未收到 UDP_BIND 响应");
+    }
+    uint64_t token = bind_reply.udp_bind().token();
+
+    // 错误令牌的数据报被丢弃
+    if (!sendDatagram(udp_fd, token + 1, makePlayerUpdate(9.0f))) {
+        return fail("发送数据报失败");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+        std::lock_guard<std::mutex> lock(received.mutex);
+        if (received.count != 0) {
+            return fail("错误令牌的数据报被投递");
+        }
+    }
+
+    // 带令牌的 PLAYER_UPDATE 以所属 TCP 连接为身份到达消息回调
+    if (!sendDatagram(udp_fd, token, makePlayerUpdate(1.5f))) {
+        return fail("发送数据报失败");
+    }
+    bool delivered = pumpUntil(loop, [&]() {
+        std::lock_guard<std::mutex> lock(received.mutex);
+        return received.count == 1;
+    });
+    {
+        std::lock_guard<std::mutex> lock(received.mutex);
+        if (!delivered || received.conn_id != server_conn->getId() ||
+            received.player_id != TEST_PLAYER_ID || received.position_x != 1.5f) {
+            return fail("PLAYER_UPDATE 数据报未到达消息回调");
+        }
+    }
+
+    // 订阅快照：已绑定 UDP 地址的会话经 UDP 收到包含该玩家位置的完整快照
+    NetworkMessage subscribe;
+    subscribe.set_msg_id(MessageType::SNAPSHOT_ACK);
+    subscribe.mutable_snapshot_ack()->set_sequence(0);
+    if (!sendFrame(tcp_fd, subscribe) ||
+        !pumpUntil(loop, [&]() { return snapshots.getClientCount() == 1; })) {
+        return fail("快照订阅未生效");
+    }
+    // 数据报中的更新经 post() 回到循环线程后才写入世界状态
+    pumpUntil(loop, []() { return false; }, 20);
+    snapshots.publish();
+
+    char datagram[65536];
+    struct timeval timeout{1, 0};
+    setsockopt(udp_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ssize_t n = recv(udp_fd, datagram, sizeof(datagram), 0);
+    NetworkMessage snapshot;
+    if (n <= 0 || !snapshot.ParseFromArray(datagram, static_cast<int>(n)) ||
+        snapshot.msg_id() != MessageType::WORLD_SNAPSHOT) {
+        return fail("未经 UDP 收到快照");
+    }
+    const WorldSnapshot& world = snapshot.world_snapshot();
+    if (world.baseline() != 0 || world.entities_size() != 1 ||
+        world.entities(0).state().player_id() != TEST_PLAYER_ID ||
+        world.entities(0).state().position().x() != 1.5f) {
+        return fail("快照内容与上报的位置不符");
+    }
+
+    cleanup();
+    spdlog::info("UDP 通道测试通过");
+    return true;
+}
+
+} // namespace test
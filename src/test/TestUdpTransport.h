@@ -0,0 +1,16 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+namespace test {
+
+// UDP 通道的本机回环测试：经 TCP 完成 UDP_BIND，再用令牌发送 PLAYER_UPDATE 数据报并接收快照
+class TestUdpTransport {
+public:
+    static bool runAllTests();
+
+private:
+    static bool testBindUpdateAndSnapshot();
+};
+
+} // namespace test